@@ -172,6 +172,7 @@ static const CGFloat kDividerDefaultAlpha = (CGFloat)0.12;
   [self.view addSubview:self.tableView];
   [self.view addSubview:self.header];
   [self.view addSubview:self.headerDividerView];
+  [self.view mdc_elevationHierarchyDidChange];
 }
 
 - (void)viewWillLayoutSubviews {
@@ -235,6 +236,7 @@ static const CGFloat kDividerDefaultAlpha = (CGFloat)0.12;
   self.mdc_bottomSheetPresentationController.dismissOnBackgroundTap =
       self.transitionController.dismissOnBackgroundTap;
   [self.view layoutIfNeeded];
+  [self.view mdc_elevationHierarchyDidChange];
 }
 
 - (BOOL)accessibilityPerformEscape {
@@ -66,14 +66,21 @@ static const CGFloat kInkAlpha = (CGFloat)0.16;
                                            UITraitCollection *_Nullable previousTraitCollection) {
       if ([actionSheet.traitCollection
               hasDifferentColorAppearanceComparedToTraitCollection:previousTraitCollection]) {
-        [actionSheet applyBackgroundColorToActionSheet:actionSheet withColorScheme:colorScheme];
+        id<MDCColorScheming> resolvedScheme =
+            [MDCSemanticColorScheme resolvedColorScheme:colorScheme
+                                    withTraitCollection:actionSheet.traitCollection];
+        [actionSheet applyBackgroundColorToActionSheet:actionSheet withColorScheme:resolvedScheme];
       }
     };
     self.mdc_elevationDidChangeBlock =
         ^(id<MDCElevatable> _Nonnull object, CGFloat absoluteElevation) {
           if ([object isKindOfClass:[MDCActionSheetController class]]) {
             MDCActionSheetController *actionSheet = (MDCActionSheetController *)object;
-            [actionSheet applyBackgroundColorToActionSheet:actionSheet withColorScheme:colorScheme];
+            id<MDCColorScheming> resolvedScheme =
+                [MDCSemanticColorScheme resolvedColorScheme:colorScheme
+                                        withTraitCollection:actionSheet.traitCollection];
+            [actionSheet applyBackgroundColorToActionSheet:actionSheet
+                                           withColorScheme:resolvedScheme];
           }
         };
   }
@@ -194,6 +194,18 @@ static NSString *const kMDCBannerViewImageViewImageKeyPath = @"image";
   return self.divider.backgroundColor;
 }
 
+- (void)didMoveToSuperview {
+  [super didMoveToSuperview];
+
+  [self mdc_elevationHierarchyDidChange];
+}
+
+- (void)didMoveToWindow {
+  [super didMoveToWindow];
+
+  [self mdc_elevationHierarchyDidChange];
+}
+
 - (CGFloat)mdc_currentElevation {
   return 0;
 }
@@ -16,6 +16,7 @@
 
 #import <MaterialComponents/MaterialButtons+Theming.h>
 #import <MaterialComponents/MaterialButtons.h>
+#import <MaterialComponents/MaterialColorScheme.h>
 #import <MaterialComponents/MaterialElevation.h>
 #import <MaterialComponents/MaterialTypography.h>
 
@@ -59,15 +60,20 @@ static CGFloat const kDividerOpacity = (CGFloat)0.12;
         ^(id<MDCElevatable> _Nonnull object, CGFloat absoluteElevation) {
           if ([object isKindOfClass:[MDCBannerView class]]) {
             MDCBannerView *bannerView = (MDCBannerView *)object;
-            UIColor *elevationSurfaceColor = [colorScheme.surfaceColor
+            id<MDCColorScheming> resolvedScheme =
+                [MDCSemanticColorScheme resolvedColorScheme:colorScheme
+                                        withTraitCollection:bannerView.traitCollection];
+            bannerView.backgroundColor = [resolvedScheme.surfaceColor
                 mdc_resolvedColorWithTraitCollection:bannerView.traitCollection
                                            elevation:bannerView.mdc_absoluteElevation];
-            bannerView.backgroundColor = elevationSurfaceColor;
           }
         };
     self.traitCollectionDidChangeBlock = ^(MDCBannerView *_Nonnull bannerView,
                                            UITraitCollection *_Nullable previousTraitCollection) {
-      bannerView.backgroundColor = [colorScheme.surfaceColor
+      id<MDCColorScheming> resolvedScheme =
+          [MDCSemanticColorScheme resolvedColorScheme:colorScheme
+                                  withTraitCollection:bannerView.traitCollection];
+      bannerView.backgroundColor = [resolvedScheme.surfaceColor
           mdc_resolvedColorWithTraitCollection:bannerView.traitCollection
                        previousTraitCollection:previousTraitCollection
                                      elevation:bannerView.mdc_absoluteElevation];
@@ -449,6 +449,18 @@ static const int kMDCButtonAnimationDuration = 200;
 
 #pragma mark - MDCElevation
 
+- (void)didMoveToSuperview {
+  [super didMoveToSuperview];
+
+  [self mdc_elevationHierarchyDidChange];
+}
+
+- (void)didMoveToWindow {
+  [super didMoveToWindow];
+
+  [self mdc_elevationHierarchyDidChange];
+}
+
 - (CGFloat)mdc_currentElevation {
   return self.elevation;
 }
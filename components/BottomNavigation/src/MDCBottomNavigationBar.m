@@ -810,6 +810,18 @@ static NSString *const kOfAnnouncement = @"of";
 
 #pragma mark - MDCElevation
 
+- (void)didMoveToSuperview {
+  [super didMoveToSuperview];
+
+  [self mdc_elevationHierarchyDidChange];
+}
+
+- (void)didMoveToWindow {
+  [super didMoveToWindow];
+
+  [self mdc_elevationHierarchyDidChange];
+}
+
 - (CGFloat)mdc_currentElevation {
   return self.elevation;
 }
@@ -65,6 +65,7 @@
     [self.view addSubview:self.contentViewController.view];
     [self.contentViewController didMoveToParentViewController:self];
   }
+  [self.view mdc_elevationHierarchyDidChange];
 }
 
 - (void)viewWillAppear:(BOOL)animated {
@@ -77,6 +78,7 @@
 
   self.mdc_bottomSheetPresentationController.dismissOnBackgroundTap =
       _transitionController.dismissOnBackgroundTap;
+  [self.view mdc_elevationHierarchyDidChange];
 
   [self.contentViewController.view layoutIfNeeded];
 }
@@ -14,18 +14,40 @@
 
 #import <UIKit/UIKit.h>
 
-@interface MDCSheetBehavior : UIDynamicBehavior
+/**
+ * Springs a dynamic item's center to a target point.
+ *
+ * The item follows the closed-form solution of a damped spring, evaluated once per frame of a
+ * display link while the behavior is running. Because the position is a function of the elapsed
+ * time only, the trajectory does not depend on the frame rate, and it can be stepped without a run
+ * loop with @c -advanceByTimeInterval:. Once the item comes to rest it is placed exactly on
+ * @c targetPoint and the behavior stops.
+ */
+@interface MDCSheetBehavior : NSObject
 
 /**
  * The final center-point for the item to arrive at.
+ *
+ * Changing the target of a running behavior keeps the item's current position and velocity.
  */
 @property(nonatomic) CGPoint targetPoint;
 
 /**
- * The initial velocity for the behavior.
+ * The initial velocity for the behavior, in points per second.
+ *
+ * Setting the velocity restarts the spring from the item's current center.
  */
 @property(nonatomic) CGPoint velocity;
 
+/**
+ * Called after every step that moves the item, including the final step that places the item on
+ * @c targetPoint.
+ */
+@property(nonatomic, copy, nullable) void (^action)(void);
+
+/** Whether the behavior is moving the item on every frame. */
+@property(nonatomic, readonly, getter=isRunning) BOOL running;
+
 /**
  * Initializes a @c MDCSheetBehavior.
  * @param item The dynamic item (a view) to apply the sheet behavior to.
@@ -34,4 +56,16 @@
 
 - (nonnull instancetype)init NS_UNAVAILABLE;
 
+/** Starts moving the item on every frame. Has no effect if the behavior is already running. */
+- (void)start;
+
+/** Stops moving the item, leaving it where it is. */
+- (void)stop;
+
+/**
+ * Moves the item to where the spring is @c interval seconds later, and stops the behavior if the
+ * item has come to rest. This is called on every frame while the behavior is running.
+ */
+- (void)advanceByTimeInterval:(NSTimeInterval)interval;
+
 @end
@@ -14,44 +14,163 @@
 
 #import "MDCSheetBehavior.h"
 
+#import <QuartzCore/QuartzCore.h>
+
+// The spring previously configured on a UIAttachmentBehavior: oscillation frequency in Hz and
+// damping ratio.
+static const double kSheetSpringFrequency = 3.5;
+static const double kSheetSpringDampingRatio = 0.4;
+
+// The linear resistance previously configured on a UIDynamicItemBehavior, which slows the item down
+// by this fraction of its velocity per second.
+static const double kSheetResistance = 10;
+
+// The item is at rest once it is this close to the target and this slow.
+static const double kSheetRestDistance = 0.5;
+static const double kSheetRestSpeed = 5;
+
+/** The position and velocity of a spring along one axis, relative to its rest position. */
+typedef struct {
+  double position;
+  double velocity;
+} MDCSheetSpringState;
+
+/**
+ Solves x'' + 2 * decay * x' + naturalFrequency^2 * x = 0 for the given initial state, where the
+ decay combines the spring's damping and the item's resistance.
+ */
+static MDCSheetSpringState MDCSheetSpringStateAtTime(MDCSheetSpringState initialState,
+                                                     double time) {
+  const double naturalFrequency = 2 * M_PI * kSheetSpringFrequency;
+  const double decay = kSheetSpringDampingRatio * naturalFrequency + kSheetResistance / 2;
+
+  double x0 = initialState.position;
+  double v0 = initialState.velocity;
+  double discriminant = decay * decay - naturalFrequency * naturalFrequency;
+  MDCSheetSpringState state;
+  if (discriminant < 0) {
+    // Underdamped: the item overshoots the target and oscillates around it.
+    double dampedFrequency = sqrt(-discriminant);
+    double envelope = exp(-decay * time);
+    double cosine = cos(dampedFrequency * time);
+    double sine = sin(dampedFrequency * time);
+    state.position = envelope * (x0 * cosine + (v0 + decay * x0) / dampedFrequency * sine);
+    state.velocity =
+        envelope * (v0 * cosine - (naturalFrequency * naturalFrequency * x0 + decay * v0) /
+                                      dampedFrequency * sine);
+  } else if (discriminant == 0) {
+    double envelope = exp(-decay * time);
+    double slope = v0 + decay * x0;
+    state.position = envelope * (x0 + slope * time);
+    state.velocity = envelope * (v0 - decay * slope * time);
+  } else {
+    double fastRoot = -decay - sqrt(discriminant);
+    double slowRoot = -decay + sqrt(discriminant);
+    double slowCoefficient = (v0 - fastRoot * x0) / (slowRoot - fastRoot);
+    double fastCoefficient = x0 - slowCoefficient;
+    double slowTerm = slowCoefficient * exp(slowRoot * time);
+    double fastTerm = fastCoefficient * exp(fastRoot * time);
+    state.position = slowTerm + fastTerm;
+    state.velocity = slowRoot * slowTerm + fastRoot * fastTerm;
+  }
+  return state;
+}
+
+static BOOL MDCSheetSpringStateIsAtRest(MDCSheetSpringState state) {
+  return fabs(state.position) <= kSheetRestDistance && fabs(state.velocity) <= kSheetRestSpeed;
+}
+
 @interface MDCSheetBehavior ()
-@property(nonatomic) UIAttachmentBehavior *attachmentBehavior;
-@property(nonatomic) UIDynamicItemBehavior *itemBehavior;
 @property(nonatomic) id<UIDynamicItem> item;
 @end
 
-@implementation MDCSheetBehavior
+@implementation MDCSheetBehavior {
+  CADisplayLink *_displayLink;
+  CFTimeInterval _previousFrameTime;
+
+  // The spring along each axis when it was last restarted, and the time since then.
+  MDCSheetSpringState _initialStateX;
+  MDCSheetSpringState _initialStateY;
+  NSTimeInterval _elapsedTime;
+  CGPoint _currentVelocity;
+}
 
 - (instancetype)initWithItem:(id<UIDynamicItem>)item {
   self = [super init];
   if (self) {
     _item = item;
-    _attachmentBehavior = [[UIAttachmentBehavior alloc] initWithItem:self.item
-                                                    attachedToAnchor:CGPointZero];
-    _attachmentBehavior.frequency = (CGFloat)3.5;
-    _attachmentBehavior.damping = (CGFloat)0.4;
-    _attachmentBehavior.length = 0;
-    [self addChildBehavior:_attachmentBehavior];
-
-    _itemBehavior = [[UIDynamicItemBehavior alloc] initWithItems:@[ self.item ]];
-    _itemBehavior.density = 100;
-    _itemBehavior.resistance = 10;
-    [self addChildBehavior:_itemBehavior];
   }
   return self;
 }
 
 - (void)setTargetPoint:(CGPoint)targetPoint {
   _targetPoint = targetPoint;
-  self.attachmentBehavior.anchorPoint = targetPoint;
+  [self restartWithVelocity:_currentVelocity];
 }
 
 - (void)setVelocity:(CGPoint)velocity {
   _velocity = velocity;
-  CGPoint currentVelocity = [self.itemBehavior linearVelocityForItem:self.item];
-  CGPoint velocityDelta =
-      CGPointMake(velocity.x - currentVelocity.x, velocity.y - currentVelocity.y);
-  [self.itemBehavior addLinearVelocity:velocityDelta forItem:self.item];
+  [self restartWithVelocity:velocity];
+}
+
+- (void)restartWithVelocity:(CGPoint)velocity {
+  CGPoint center = self.item.center;
+  _initialStateX = (MDCSheetSpringState){center.x - self.targetPoint.x, velocity.x};
+  _initialStateY = (MDCSheetSpringState){center.y - self.targetPoint.y, velocity.y};
+  _elapsedTime = 0;
+  _currentVelocity = velocity;
+}
+
+#pragma mark - Stepping
+
+- (BOOL)isRunning {
+  return _displayLink != nil;
+}
+
+- (void)start {
+  if (_displayLink) {
+    return;
+  }
+  _previousFrameTime = 0;
+  _displayLink = [CADisplayLink displayLinkWithTarget:self
+                                             selector:@selector(displayLinkDidFire:)];
+  [_displayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+}
+
+- (void)stop {
+  [_displayLink invalidate];
+  _displayLink = nil;
+  _currentVelocity = CGPointZero;
+}
+
+- (void)displayLinkDidFire:(CADisplayLink *)displayLink {
+  CFTimeInterval frameTime = displayLink.timestamp;
+  if (@available(iOS 10.0, *)) {
+    frameTime = displayLink.targetTimestamp;
+  }
+  NSTimeInterval interval =
+      _previousFrameTime > 0 ? frameTime - _previousFrameTime : displayLink.duration;
+  _previousFrameTime = frameTime;
+  [self advanceByTimeInterval:interval];
+}
+
+- (void)advanceByTimeInterval:(NSTimeInterval)interval {
+  _elapsedTime += interval;
+  MDCSheetSpringState stateX = MDCSheetSpringStateAtTime(_initialStateX, _elapsedTime);
+  MDCSheetSpringState stateY = MDCSheetSpringStateAtTime(_initialStateY, _elapsedTime);
+
+  BOOL atRest = MDCSheetSpringStateIsAtRest(stateX) && MDCSheetSpringStateIsAtRest(stateY);
+  if (atRest) {
+    self.item.center = self.targetPoint;
+    [self stop];
+  } else {
+    self.item.center = CGPointMake(self.targetPoint.x + (CGFloat)stateX.position,
+                                   self.targetPoint.y + (CGFloat)stateY.position);
+    _currentVelocity = CGPointMake((CGFloat)stateX.velocity, (CGFloat)stateY.velocity);
+  }
+  if (self.action) {
+    self.action();
+  }
 }
 
 @end
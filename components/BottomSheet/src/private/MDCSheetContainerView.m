@@ -32,7 +32,6 @@ static const CGFloat kSheetBounceBuffer = 150;
 @property(nonatomic) MDCDraggableView *sheet;
 @property(nonatomic) UIView *contentView;
 
-@property(nonatomic) UIDynamicAnimator *animator;
 @property(nonatomic) MDCSheetBehavior *sheetBehavior;
 @property(nonatomic) BOOL isDragging;
 @property(nonatomic) CGFloat originalPreferredSheetHeight;
@@ -74,8 +73,6 @@ static const CGFloat kSheetBounceBuffer = 150;
     [_sheet addSubview:_contentView];
     [self addSubview:_sheet];
 
-    _animator = [[UIDynamicAnimator alloc] initWithReferenceView:self];
-
     [scrollView addObserver:self
                  forKeyPath:kContentSizeKey
                     options:NSKeyValueObservingOptionNew | NSKeyValueObservingOptionOld
@@ -85,20 +82,12 @@ static const CGFloat kSheetBounceBuffer = 150;
                                                  name:UIAccessibilityVoiceOverStatusChanged
                                                object:nil];
 
-    // Add the keyboard notifications.
-    NSArray *notificationNames = @[
-      MDCKeyboardWatcherKeyboardWillShowNotification,
-      MDCKeyboardWatcherKeyboardWillHideNotification,
-      MDCKeyboardWatcherKeyboardWillChangeFrameNotification
-    ];
-
-    for (NSString *name in notificationNames) {
-      [[NSNotificationCenter defaultCenter]
-          addObserver:self
-             selector:@selector(keyboardStateChangedWithNotification:)
-                 name:name
-               object:nil];
-    }
+    // Add the keyboard notification.
+    [[NSNotificationCenter defaultCenter]
+        addObserver:self
+           selector:@selector(keyboardStateChangedWithNotification:)
+               name:MDCKeyboardWatcherKeyboardWillUpdateNotification
+             object:nil];
 
     // Since we handle the SafeAreaInsets ourselves through the contentInset property, we disable
     // the adjustment behavior to prevent accounting for it twice.
@@ -132,7 +121,7 @@ static const CGFloat kSheetBounceBuffer = 150;
     }
     [self animatePaneWithInitialVelocity:CGPointZero];
   } else {
-    [self.animator removeAllBehaviors];
+    [self.sheetBehavior stop];
     self.sheetBehavior = nil;
   }
 }
@@ -217,7 +206,7 @@ static const CGFloat kSheetBounceBuffer = 150;
 
 // Slides the sheet position downwards, so the right amount peeks above the bottom of the superview.
 - (void)updateSheetFrame {
-  [self.animator removeAllBehaviors];
+  [self.sheetBehavior stop];
 
   CGRect sheetRect = self.bounds;
   sheetRect.origin.y = CGRectGetMaxY(self.bounds) - [self truncatedPreferredSheetHeight];
@@ -280,7 +269,7 @@ static const CGFloat kSheetBounceBuffer = 150;
   self.sheetBehavior.action = ^{
     [weakSelf sheetBehaviorDidUpdate];
   };
-  [self.animator addBehavior:self.sheetBehavior];
+  [self.sheetBehavior start];
 }
 
 // Calculates the snap-point for the view to spring to.
@@ -309,10 +298,10 @@ static const CGFloat kSheetBounceBuffer = 150;
 - (void)sheetBehaviorDidUpdate {
   // If sheet has been dragged off the bottom, we can trigger a dismiss.
   if (self.sheetState == MDCSheetStateClosed &&
-      CGRectGetMinY(self.sheet.frame) > CGRectGetMaxY(self.bounds)) {
+      CGRectGetMinY(self.sheet.frame) >= CGRectGetMaxY(self.bounds)) {
     [self.delegate sheetContainerViewDidHide:self];
 
-    [self.animator removeAllBehaviors];
+    [self.sheetBehavior stop];
 
     // Reset the state to preferred once we are dismissed.
     self.sheetState = MDCSheetStatePreferred;
@@ -381,7 +370,7 @@ static const CGFloat kSheetBounceBuffer = 150;
 }
 
 - (void)draggableViewBeganDragging:(__unused MDCDraggableView *)view {
-  [self.animator removeAllBehaviors];
+  [self.sheetBehavior stop];
   self.isDragging = YES;
 }
 
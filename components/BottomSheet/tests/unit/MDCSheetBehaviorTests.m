@@ -0,0 +1,239 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#import <XCTest/XCTest.h>
+
+#import "../../src/private/MDCSheetBehavior.h"
+
+static const NSTimeInterval kFrameInterval = 1.0 / 60.0;
+static const NSUInteger kMaximumFrameCount = 240;
+
+/**
+ The sheet's previous UIKit Dynamics configuration: a UIAttachmentBehavior with a frequency of 3.5Hz
+ and a damping of 0.4, and a UIDynamicItemBehavior with a resistance of 10.
+ */
+static const CGFloat kLegacyFrequency = (CGFloat)3.5;
+static const CGFloat kLegacyDamping = (CGFloat)0.4;
+static const CGFloat kLegacyResistance = 10;
+
+/** The state of the legacy behavior along one axis, relative to the target. */
+typedef struct {
+  CGFloat position;
+  CGFloat velocity;
+} MDCSheetBehaviorTestsLegacyState;
+
+/**
+ Steps the legacy force model the way a physics engine does: semi-implicit Euler, with the
+ resistance applied as a velocity damping after the spring force.
+ */
+static MDCSheetBehaviorTestsLegacyState MDCSheetBehaviorTestsLegacyStep(
+    MDCSheetBehaviorTestsLegacyState state, CGFloat step) {
+  CGFloat naturalFrequency = 2 * (CGFloat)M_PI * kLegacyFrequency;
+  CGFloat acceleration = -naturalFrequency * naturalFrequency * state.position -
+                         2 * kLegacyDamping * naturalFrequency * state.velocity;
+  state.velocity = (state.velocity + step * acceleration) / (1 + step * kLegacyResistance);
+  state.position += step * state.velocity;
+  return state;
+}
+
+static BOOL MDCSheetBehaviorTestsLegacyIsAtRest(MDCSheetBehaviorTestsLegacyState state) {
+  return fabs(state.position) <= (CGFloat)0.5 && fabs(state.velocity) <= 5;
+}
+
+@interface MDCSheetBehaviorTests : XCTestCase
+@property(nonatomic, strong, nullable) UIView *item;
+@property(nonatomic, strong, nullable) MDCSheetBehavior *behavior;
+@end
+
+@implementation MDCSheetBehaviorTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.item = [[UIView alloc] initWithFrame:CGRectMake(0, 0, 320, 480)];
+  self.behavior = [[MDCSheetBehavior alloc] initWithItem:self.item];
+}
+
+- (void)tearDown {
+  [self.behavior stop];
+  self.behavior = nil;
+  self.item = nil;
+
+  [super tearDown];
+}
+
+/** Springs the item from @c startY with @c velocity towards a target at (160, 300). */
+- (void)startFromY:(CGFloat)startY velocity:(CGFloat)velocity {
+  self.item.center = CGPointMake(160, startY);
+  self.behavior.targetPoint = CGPointMake(160, 300);
+  self.behavior.velocity = CGPointMake(0, velocity);
+  [self.behavior start];
+}
+
+/** Advances the behavior one frame at a time and returns the item's offset from the target. */
+- (NSArray<NSNumber *> *)trajectoryFromY:(CGFloat)startY velocity:(CGFloat)velocity {
+  [self startFromY:startY velocity:velocity];
+  NSMutableArray<NSNumber *> *trajectory = [NSMutableArray array];
+  for (NSUInteger frame = 0; frame < kMaximumFrameCount && self.behavior.isRunning; ++frame) {
+    [self.behavior advanceByTimeInterval:kFrameInterval];
+    [trajectory addObject:@(self.item.center.y - self.behavior.targetPoint.y)];
+  }
+  return trajectory;
+}
+
+/** Returns the legacy behavior's offset from the target on every frame until it comes to rest. */
+- (NSArray<NSNumber *> *)legacyTrajectoryFromY:(CGFloat)startY
+                                      velocity:(CGFloat)velocity
+                                 stepsPerFrame:(NSUInteger)stepsPerFrame {
+  MDCSheetBehaviorTestsLegacyState state = {startY - 300, velocity};
+  CGFloat step = (CGFloat)kFrameInterval / stepsPerFrame;
+  NSMutableArray<NSNumber *> *trajectory = [NSMutableArray array];
+  for (NSUInteger frame = 0; frame < kMaximumFrameCount; ++frame) {
+    for (NSUInteger substep = 0; substep < stepsPerFrame; ++substep) {
+      state = MDCSheetBehaviorTestsLegacyStep(state, step);
+    }
+    [trajectory addObject:@(state.position)];
+    if (MDCSheetBehaviorTestsLegacyIsAtRest(state)) {
+      break;
+    }
+  }
+  return trajectory;
+}
+
+- (void)testTrajectoryMatchesTheLegacyForceModel {
+  CGFloat starts[] = {600, 100, 400, -100};
+  CGFloat velocities[] = {0, 0, -2000, 1500};
+  for (NSUInteger index = 0; index < sizeof(starts) / sizeof(starts[0]); ++index) {
+    // When
+    NSArray<NSNumber *> *trajectory = [self trajectoryFromY:starts[index]
+                                                   velocity:velocities[index]];
+    NSArray<NSNumber *> *legacyTrajectory = [self legacyTrajectoryFromY:starts[index]
+                                                               velocity:velocities[index]
+                                                          stepsPerFrame:100];
+
+    // Then
+    NSUInteger frameCount = MIN(trajectory.count, legacyTrajectory.count);
+    for (NSUInteger frame = 0; frame < frameCount; ++frame) {
+      XCTAssertEqualWithAccuracy(trajectory[frame].doubleValue, legacyTrajectory[frame].doubleValue,
+                                 1, @"Start %@, frame %@", @(starts[index]), @(frame));
+    }
+  }
+}
+
+- (void)testSettlesWithinAFrameOfTheLegacyBehavior {
+  CGFloat starts[] = {600, 100, 400, -100};
+  CGFloat velocities[] = {0, 0, -2000, 1500};
+  for (NSUInteger index = 0; index < sizeof(starts) / sizeof(starts[0]); ++index) {
+    // When
+    NSArray<NSNumber *> *trajectory = [self trajectoryFromY:starts[index]
+                                                   velocity:velocities[index]];
+    NSArray<NSNumber *> *legacyTrajectory = [self legacyTrajectoryFromY:starts[index]
+                                                               velocity:velocities[index]
+                                                          stepsPerFrame:1];
+
+    // Then
+    XCTAssertFalse(self.behavior.isRunning);
+    XCTAssertEqualWithAccuracy((double)trajectory.count, (double)legacyTrajectory.count, 1,
+                               @"Start %@", @(starts[index]));
+  }
+}
+
+- (void)testOvershootIsCloseToTheLegacyBehavior {
+  // When
+  NSArray<NSNumber *> *trajectory = [self trajectoryFromY:600 velocity:0];
+  NSArray<NSNumber *> *legacyTrajectory = [self legacyTrajectoryFromY:600
+                                                             velocity:0
+                                                        stepsPerFrame:1];
+
+  // Then
+  double overshoot = [[trajectory valueForKeyPath:@"@min.self"] doubleValue];
+  double legacyOvershoot = [[legacyTrajectory valueForKeyPath:@"@min.self"] doubleValue];
+  XCTAssertLessThan(overshoot, 0);
+  XCTAssertEqualWithAccuracy(overshoot, legacyOvershoot, fabs(legacyOvershoot) * 0.2);
+}
+
+- (void)testStopsExactlyOnTheTarget {
+  // Given
+  __block NSUInteger actionCount = 0;
+  self.behavior.action = ^{
+    actionCount += 1;
+  };
+
+  // When
+  NSArray<NSNumber *> *trajectory = [self trajectoryFromY:600 velocity:500];
+
+  // Then
+  XCTAssertFalse(self.behavior.isRunning);
+  XCTAssertLessThan(trajectory.count, kMaximumFrameCount);
+  XCTAssertTrue(CGPointEqualToPoint(self.item.center, self.behavior.targetPoint));
+  XCTAssertEqual(actionCount, trajectory.count);
+}
+
+- (void)testTrajectoryDoesNotDependOnTheFrameRate {
+  // Given
+  [self startFromY:600 velocity:-800];
+  UIView *fastItem = [[UIView alloc] initWithFrame:self.item.bounds];
+  MDCSheetBehavior *fastBehavior = [[MDCSheetBehavior alloc] initWithItem:fastItem];
+  fastItem.center = CGPointMake(160, 600);
+  fastBehavior.targetPoint = CGPointMake(160, 300);
+  fastBehavior.velocity = CGPointMake(0, -800);
+
+  // When
+  for (NSUInteger frame = 0; frame < 12; ++frame) {
+    [self.behavior advanceByTimeInterval:kFrameInterval];
+    [fastBehavior advanceByTimeInterval:kFrameInterval / 2];
+    [fastBehavior advanceByTimeInterval:kFrameInterval / 2];
+
+    // Then
+    XCTAssertEqualWithAccuracy(self.item.center.y, fastItem.center.y, 0.0001);
+  }
+}
+
+- (void)testChangingTheTargetKeepsTheItemMoving {
+  // Given
+  [self startFromY:600 velocity:0];
+  for (NSUInteger frame = 0; frame < 5; ++frame) {
+    [self.behavior advanceByTimeInterval:kFrameInterval];
+  }
+  CGPoint centerBeforeRetargeting = self.item.center;
+
+  // When
+  self.behavior.targetPoint = centerBeforeRetargeting;
+  [self.behavior advanceByTimeInterval:kFrameInterval];
+
+  // Then
+  XCTAssertTrue(self.behavior.isRunning);
+  XCTAssertLessThan(self.item.center.y, centerBeforeRetargeting.y);
+}
+
+- (void)testSettingTheVelocityRestartsFromTheCurrentCenter {
+  // Given
+  [self startFromY:600 velocity:0];
+  for (NSUInteger frame = 0; frame < 5; ++frame) {
+    [self.behavior advanceByTimeInterval:kFrameInterval];
+  }
+  CGPoint centerBeforeRestarting = self.item.center;
+
+  // When
+  self.behavior.targetPoint = centerBeforeRestarting;
+  self.behavior.velocity = CGPointZero;
+  [self.behavior advanceByTimeInterval:kFrameInterval];
+
+  // Then
+  XCTAssertFalse(self.behavior.isRunning);
+  XCTAssertTrue(CGPointEqualToPoint(self.item.center, centerBeforeRestarting));
+}
+
+@end
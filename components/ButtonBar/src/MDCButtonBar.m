@@ -16,6 +16,7 @@
 
 #import <MDFInternationalization/MDFInternationalization.h>
 
+#import "MDCButtonBarButton.h"
 #import "MaterialApplication.h"
 #import "MaterialButtons.h"
 #import "private/MDCAppBarButtonBarBuilder.h"
@@ -29,9 +30,19 @@ static char *const kKVOContextMDCButtonBar = "kKVOContextMDCButtonBar";
 // This is required because @selector(enabled) throws a compiler warning of unrecognized selector.
 static NSString *const kEnabledSelector = @"enabled";
 
+/** The cached fitting width of a button view. */
+typedef struct {
+  BOOL isValid;
+  /** The control state the width was measured in, as the title font may differ per state. */
+  UIControlState state;
+  CGFloat width;
+} MDCButtonBarCachedWidth;
+
 @implementation MDCButtonBar {
   id _buttonItemsLock;
   NSArray<__kindof UIView *> *_buttonViews;
+  /** An MDCButtonBarCachedWidth for each of the button views. */
+  NSMutableData *_buttonViewWidths;
   UIColor *_inkColor;
   MDCAppBarButtonBarBuilder *_defaultBuilder;
 }
@@ -82,70 +93,49 @@ static NSString *const kEnabledSelector = @"enabled";
 }
 
 - (CGSize)sizeThatFits:(CGSize)size shouldLayout:(BOOL)shouldLayout {
+  NSUInteger buttonViewCount = _buttonViews.count;
   CGFloat totalWidth = 0;
+  for (NSUInteger index = 0; index < buttonViewCount; ++index) {
+    totalWidth += [self widthOfButtonViewAtIndex:index];
+  }
+
+  CGFloat maxHeight = kButtonBarMaxHeight;
+  CGFloat minHeight = kButtonBarMinHeight;
+  CGFloat height = MIN(MAX(size.height, minHeight), maxHeight);
 
-  CGFloat edge;
-  switch (self.mdf_effectiveUserInterfaceLayoutDirection) {
-    case UIUserInterfaceLayoutDirectionLeftToRight:
-      edge = 0;
-      break;
-    case UIUserInterfaceLayoutDirectionRightToLeft:
-      edge = size.width;
-      break;
+  if (shouldLayout) {
+    [self layoutButtonViewsInSize:size];
   }
+  return CGSizeMake(totalWidth, height);
+}
+
+- (void)layoutButtonViewsInSize:(CGSize)size {
+  BOOL isRTL =
+      self.mdf_effectiveUserInterfaceLayoutDirection == UIUserInterfaceLayoutDirectionRightToLeft;
+  CGFloat edge = isRTL ? size.width : 0;
 
   BOOL shouldAlignBaselines = _buttonTitleBaseline > 0;
+  BOOL isTrailing = self.layoutPosition == MDCButtonBarLayoutPositionTrailing;
 
-  NSEnumerator<__kindof UIView *> *positionedButtonViews =
-      self.layoutPosition == MDCButtonBarLayoutPositionTrailing
-          ? [_buttonViews reverseObjectEnumerator]
-          : [_buttonViews objectEnumerator];
-
-  for (UIView *view in positionedButtonViews) {
-    CGFloat width = view.frame.size.width;
-
-    // There's a finite number of buttons that can reasonably be shown in a button bar, so this
-    // linear-time lookup cost is minimal.
-    NSUInteger index = [_buttonViews indexOfObject:view];
-    if (index < [_items count]) {
-      UIBarButtonItem *item = _items[index];
-      if (item.width > 0) {
-        width = item.width;
-      } else {
-        width = [view sizeThatFits:CGSizeMake(CGFLOAT_MAX, CGFLOAT_MAX)].width;
-      }
-    }
+  NSUInteger buttonViewCount = _buttonViews.count;
+  for (NSUInteger position = 0; position < buttonViewCount; ++position) {
+    NSUInteger index = isTrailing ? buttonViewCount - 1 - position : position;
+    UIView *view = _buttonViews[index];
+    CGFloat width = [self widthOfButtonViewAtIndex:index];
 
-    switch (self.mdf_effectiveUserInterfaceLayoutDirection) {
-      case UIUserInterfaceLayoutDirectionLeftToRight:
-        break;
-      case UIUserInterfaceLayoutDirectionRightToLeft:
-        edge -= width;
-        break;
+    if (isRTL) {
+      edge -= width;
     }
-    if (shouldLayout) {
-      view.frame = CGRectMake(edge, 0, width, size.height);
-
-      if (shouldAlignBaselines && [view isKindOfClass:[UIButton class]]) {
-        if ([(UIButton *)view titleForState:UIControlStateNormal].length > 0) {
-          [self alignButtonBaseline:(UIButton *)view];
-        }
+    view.frame = CGRectMake(edge, 0, width, size.height);
+    if (shouldAlignBaselines && [view isKindOfClass:[UIButton class]]) {
+      if ([(UIButton *)view titleForState:UIControlStateNormal].length > 0) {
+        [self alignButtonBaseline:(UIButton *)view];
       }
     }
-    switch (self.mdf_effectiveUserInterfaceLayoutDirection) {
-      case UIUserInterfaceLayoutDirectionLeftToRight:
-        edge += width;
-        break;
-      case UIUserInterfaceLayoutDirectionRightToLeft:
-        break;
+    if (!isRTL) {
+      edge += width;
     }
-    totalWidth += width;
   }
-
-  CGFloat maxHeight = kButtonBarMaxHeight;
-  CGFloat minHeight = kButtonBarMinHeight;
-  CGFloat height = MIN(MAX(size.height, minHeight), maxHeight);
-  return CGSizeMake(totalWidth, height);
 }
 
 - (CGSize)sizeThatFits:(CGSize)size {
@@ -174,6 +164,9 @@ static NSString *const kEnabledSelector = @"enabled";
 - (void)traitCollectionDidChange:(UITraitCollection *)previousTraitCollection {
   [super traitCollectionDidChange:previousTraitCollection];
 
+  // Dynamic Type and size class changes may change the fonts and insets of the buttons.
+  [self invalidateButtonViewWidths];
+
   const BOOL isPad = [[UIDevice currentDevice] userInterfaceIdiom] == UIUserInterfaceIdiomPad;
   if (isPad &&
       self.traitCollection.horizontalSizeClass != previousTraitCollection.horizontalSizeClass) {
@@ -195,6 +188,52 @@ static NSString *const kEnabledSelector = @"enabled";
 
 #pragma mark - Private
 
+/**
+ Returns the width the button view at @c index is laid out with.
+
+ The fitting widths of the bar's own buttons are cached until their item's title or image, their
+ font or their control state change. Custom views are measured every time, as they may change
+ their size without the button bar knowing.
+ */
+- (CGFloat)widthOfButtonViewAtIndex:(NSUInteger)index {
+  UIView *view = _buttonViews[index];
+  if (index >= _items.count) {
+    return view.frame.size.width;
+  }
+  UIBarButtonItem *item = _items[index];
+  if (item.width > 0) {
+    return item.width;
+  }
+  if (![view isKindOfClass:[MDCButtonBarButton class]]) {
+    return [self measureWidthOfButtonView:view];
+  }
+
+  UIControlState state = ((MDCButtonBarButton *)view).state;
+  MDCButtonBarCachedWidth *cachedWidth =
+      (MDCButtonBarCachedWidth *)_buttonViewWidths.mutableBytes + index;
+  if (!cachedWidth->isValid || cachedWidth->state != state) {
+    cachedWidth->width = [self measureWidthOfButtonView:view];
+    cachedWidth->state = state;
+    cachedWidth->isValid = YES;
+  }
+  return cachedWidth->width;
+}
+
+- (void)invalidateWidthOfButtonViewAtIndex:(NSUInteger)index {
+  if (index < _buttonViews.count) {
+    ((MDCButtonBarCachedWidth *)_buttonViewWidths.mutableBytes)[index].isValid = NO;
+  }
+}
+
+- (void)invalidateButtonViewWidths {
+  [_buttonViewWidths resetBytesInRange:NSMakeRange(0, _buttonViewWidths.length)];
+}
+
+/** Returns the fitting width of @c view, without consulting the width cache. */
+- (CGFloat)measureWidthOfButtonView:(UIView *)view {
+  return [view sizeThatFits:CGSizeMake(CGFLOAT_MAX, CGFLOAT_MAX)].width;
+}
+
 - (void)updateButtonTitleColors {
   for (UIView *viewObj in _buttonViews) {
     if ([viewObj isKindOfClass:[MDCButton class]]) {
@@ -286,6 +325,7 @@ static NSString *const kEnabledSelector = @"enabled";
 
         } else if ([keyPath isEqualToString:NSStringFromSelector(@selector(image))]) {
           [button setImage:newValue forState:UIControlStateNormal];
+          [self invalidateWidthOfButtonViewAtIndex:itemIndex];
           [self invalidateIntrinsicContentSize];
 
         } else if ([keyPath isEqualToString:NSStringFromSelector(@selector(tag))]) {
@@ -296,6 +336,7 @@ static NSString *const kEnabledSelector = @"enabled";
 
         } else if ([keyPath isEqualToString:NSStringFromSelector(@selector(title))]) {
           [button setTitle:newValue forState:UIControlStateNormal];
+          [self invalidateWidthOfButtonViewAtIndex:itemIndex];
           [self invalidateIntrinsicContentSize];
 
         } else {
@@ -445,6 +486,9 @@ static NSString *const kEnabledSelector = @"enabled";
       button.uppercaseTitle = uppercasesButtonTitles;
     }
   }
+  [self invalidateButtonViewWidths];
+  [self invalidateIntrinsicContentSize];
+  [self setNeedsLayout];
 }
 
 - (void)setButtonsTitleFont:(UIFont *)font forState:(UIControlState)state {
@@ -457,14 +501,10 @@ static NSString *const kEnabledSelector = @"enabled";
       [button setTitleFont:font forState:state];
 
       if (i < [_items count]) {
-        UIBarButtonItem *item = _items[i];
+        [self invalidateWidthOfButtonViewAtIndex:i];
 
         CGRect frame = button.frame;
-        if (item.width > 0) {
-          frame.size.width = item.width;
-        } else {
-          frame.size.width = [button sizeThatFits:CGSizeMake(CGFLOAT_MAX, CGFLOAT_MAX)].width;
-        }
+        frame.size.width = [self widthOfButtonViewAtIndex:i];
         button.frame = frame;
 
         [self invalidateIntrinsicContentSize];
@@ -505,6 +545,11 @@ static NSString *const kEnabledSelector = @"enabled";
 #pragma clang diagnostic pop
 
 - (void)setButtonTitleBaseline:(CGFloat)buttonTitleBaseline {
+  // The navigation bar sets the baseline in every layout pass, e.g. in every frame of a header
+  // height animation; only a changed baseline requires laying out the buttons again.
+  if (_buttonTitleBaseline == buttonTitleBaseline) {
+    return;
+  }
   _buttonTitleBaseline = buttonTitleBaseline;
 
   [self setNeedsLayout];
@@ -550,6 +595,8 @@ static NSString *const kEnabledSelector = @"enabled";
     [view removeFromSuperview];
   }
   _buttonViews = [self viewsForItems:_items];
+  _buttonViewWidths =
+      [NSMutableData dataWithLength:_buttonViews.count * sizeof(MDCButtonBarCachedWidth)];
 
   [self invalidateIntrinsicContentSize];
   [self setNeedsLayout];
@@ -0,0 +1,162 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialButtonBar.h"
+#import "MaterialButtons.h"
+
+@interface MDCButtonBar (WidthCacheTesting)
+- (CGFloat)measureWidthOfButtonView:(UIView *)view;
+@end
+
+/** A button bar that counts how many times it measures its button views. */
+@interface MeasurementCountingButtonBar : MDCButtonBar
+@property(nonatomic, assign) NSUInteger buttonViewMeasurementCount;
+@end
+
+@implementation MeasurementCountingButtonBar
+
+- (CGFloat)measureWidthOfButtonView:(UIView *)view {
+  self.buttonViewMeasurementCount += 1;
+  return [super measureWidthOfButtonView:view];
+}
+
+@end
+
+@interface ButtonBarWidthCacheTests : XCTestCase
+@property(nonatomic, strong, nullable) MDCButtonBar *buttonBar;
+@property(nonatomic, strong, nullable) UIBarButtonItem *item;
+@end
+
+@implementation ButtonBarWidthCacheTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.item = [[UIBarButtonItem alloc] initWithTitle:@"Edit"
+                                               style:UIBarButtonItemStylePlain
+                                              target:nil
+                                              action:nil];
+  self.buttonBar = [[MDCButtonBar alloc] init];
+  self.buttonBar.items = @[ self.item ];
+}
+
+- (void)tearDown {
+  self.buttonBar = nil;
+  self.item = nil;
+
+  [super tearDown];
+}
+
+- (CGFloat)fittingWidth {
+  return [self.buttonBar sizeThatFits:CGSizeMake(CGFLOAT_MAX, CGFLOAT_MAX)].width;
+}
+
+- (MDCButton *)button {
+  for (UIView *view in self.buttonBar.subviews) {
+    if ([view isKindOfClass:[MDCButton class]]) {
+      return (MDCButton *)view;
+    }
+  }
+  return nil;
+}
+
+- (void)testChangingTheItemTitleRemeasuresTheButton {
+  // Given
+  CGFloat shortTitleWidth = [self fittingWidth];
+
+  // When
+  self.item.title = @"Edit all of the selected items";
+
+  // Then
+  XCTAssertGreaterThan([self fittingWidth], shortTitleWidth);
+}
+
+- (void)testChangingTheTitleCasingRemeasuresTheButton {
+  // Given
+  CGFloat uppercaseWidth = [self fittingWidth];
+
+  // When
+  self.buttonBar.uppercasesButtonTitles = NO;
+
+  // Then
+  XCTAssertNotEqualWithAccuracy([self fittingWidth], uppercaseWidth, 0.001);
+}
+
+- (void)testChangingTheButtonStateRemeasuresTheButton {
+  // Given
+  [self.buttonBar setButtonsTitleFont:[UIFont systemFontOfSize:40]
+                             forState:UIControlStateSelected];
+  CGFloat normalWidth = [self fittingWidth];
+
+  // When
+  [self button].selected = YES;
+
+  // Then
+  XCTAssertGreaterThan([self fittingWidth], normalWidth);
+}
+
+- (void)testLayingOutAtNewHeightsWithTheSameBaselineDoesNotMeasureAgain {
+  // Given
+  MeasurementCountingButtonBar *buttonBar = [[MeasurementCountingButtonBar alloc] init];
+  buttonBar.items = @[
+    self.item, [[UIBarButtonItem alloc] initWithTitle:@"Share"
+                                                style:UIBarButtonItemStylePlain
+                                               target:nil
+                                               action:nil]
+  ];
+  buttonBar.frame = CGRectMake(0, 0, 200, 56);
+  buttonBar.buttonTitleBaseline = 30;
+  [buttonBar layoutIfNeeded];
+  NSUInteger buttonViewMeasurementCount = buttonBar.buttonViewMeasurementCount;
+
+  // When
+  for (NSUInteger frame = 0; frame < 60; ++frame) {
+    buttonBar.frame = CGRectMake(0, 0, 200, 56 + (CGFloat)frame * 2);
+    buttonBar.buttonTitleBaseline = 30;
+    [buttonBar layoutIfNeeded];
+  }
+
+  // Then
+  XCTAssertEqual(buttonViewMeasurementCount, 2U);
+  XCTAssertEqual(buttonBar.buttonViewMeasurementCount, buttonViewMeasurementCount);
+}
+
+- (void)testCachedWidthsMatchTheButtonFittingWidths {
+  // Given
+  self.buttonBar.items = @[
+    self.item, [[UIBarButtonItem alloc] initWithTitle:@"Share"
+                                                style:UIBarButtonItemStylePlain
+                                               target:nil
+                                               action:nil]
+  ];
+  CGSize size = [self.buttonBar sizeThatFits:CGSizeMake(CGFLOAT_MAX, CGFLOAT_MAX)];
+
+  // When
+  self.buttonBar.frame = CGRectMake(0, 0, size.width, size.height);
+  [self.buttonBar layoutIfNeeded];
+
+  // Then
+  CGFloat totalWidth = 0;
+  for (UIView *view in self.buttonBar.subviews) {
+    CGFloat fittingWidth = [view sizeThatFits:CGSizeMake(CGFLOAT_MAX, CGFLOAT_MAX)].width;
+    XCTAssertEqualWithAccuracy(CGRectGetWidth(view.frame), fittingWidth, 0.001);
+    totalWidth += fittingWidth;
+  }
+  XCTAssertEqualWithAccuracy(size.width, totalWidth, 0.001);
+}
+
+@end
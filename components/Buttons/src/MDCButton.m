@@ -796,6 +796,18 @@ static NSAttributedString *uppercaseAttributedString(NSAttributedString *string)
 
 #pragma mark - MaterialElevation
 
+- (void)didMoveToSuperview {
+  [super didMoveToSuperview];
+
+  [self mdc_elevationHierarchyDidChange];
+}
+
+- (void)didMoveToWindow {
+  [super didMoveToWindow];
+
+  [self mdc_elevationHierarchyDidChange];
+}
+
 - (CGFloat)mdc_currentElevation {
   return [self elevationForState:self.state];
 }
@@ -18,6 +18,9 @@
 /**
  This category is used to style MDCButtons instances to a specific Material style which can be found
  within the [Material Guidelines](https://material.io/design/components/buttons.html).
+
+ Applying an @c MDCFrozenContainerScheme that was already applied to the button in the same style
+ does nothing, which makes re-theming reused cells cheap.
  */
 @interface MDCButton (MaterialTheming)
 
@@ -0,0 +1,58 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MaterialButtons.h"
+#import "MaterialContainerScheme.h"
+
+/** The Material button styles a compiled theme can apply. */
+typedef NS_ENUM(NSInteger, MDCButtonThemeVariant) {
+  /** The style applied by @c -[MDCButton applyContainedThemeWithScheme:]. */
+  MDCButtonThemeVariantContained,
+  /** The style applied by @c -[MDCButton applyOutlinedThemeWithScheme:]. */
+  MDCButtonThemeVariantOutlined,
+  /** The style applied by @c -[MDCButton applyTextThemeWithScheme:]. */
+  MDCButtonThemeVariantText,
+};
+
+/**
+ A button theme resolved from a container scheme once, for applying to many buttons.
+
+ The @c MDCButton+MaterialTheming methods compile a theme for every call. Applying one compiled
+ theme instead reads the scheme, and creates the derived colors, font and shape generator, only
+ once. Use it when theming many buttons with the same scheme, e.g. one per cell of a long list.
+
+ The compiled theme does not observe the scheme; compile a new one when the scheme changes.
+ Buttons themed by the same compiled theme share its shape generator, which must not be mutated.
+ */
+__attribute__((objc_subclassing_restricted)) @interface MDCButtonCompiledTheme : NSObject
+
+/** The style this theme applies. */
+@property(nonatomic, readonly) MDCButtonThemeVariant variant;
+
+/**
+ Resolves the given style from @c scheme.
+
+ @param scheme A container scheme instance containing any desired customizations to the theming
+ system.
+ @param variant The button style to resolve.
+ */
+- (nonnull instancetype)initWithScheme:(nonnull id<MDCContainerScheming>)scheme
+                               variant:(MDCButtonThemeVariant)variant NS_DESIGNATED_INITIALIZER;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+/** Applies the resolved style to @c button. */
+- (void)applyToButton:(nonnull MDCButton *)button;
+
+@end
@@ -0,0 +1,208 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCButtonCompiledTheme.h"
+#import "MDCButtonThemedScheme.h"
+
+#import <MaterialComponents/MaterialButtons+ShapeThemer.h>
+#import <MaterialComponents/MaterialShadowElevations.h>
+
+/** The largest value of the control states that themes assign per-state values to. */
+static const NSUInteger kMaximumStateValue = UIControlStateNormal | UIControlStateSelected |
+                                             UIControlStateHighlighted | UIControlStateDisabled;
+
+/** The per-state properties a theme resets before assigning its own values. */
+typedef NS_OPTIONS(NSUInteger, MDCButtonCompiledThemeResetMask) {
+  MDCButtonCompiledThemeResetBackgroundColor = 1 << 0,
+  MDCButtonCompiledThemeResetTitleColor = 1 << 1,
+  MDCButtonCompiledThemeResetImageTintColor = 1 << 2,
+  MDCButtonCompiledThemeResetBorderColor = 1 << 3,
+};
+
+@implementation MDCButtonCompiledTheme {
+  MDCButtonCompiledThemeResetMask _resetMask;
+
+  UIColor *_normalBackgroundColor;
+  UIColor *_disabledBackgroundColor;
+  UIColor *_normalContentColor;
+  UIColor *_disabledContentColor;
+  UIColor *_normalBorderColor;
+  UIColor *_inkColor;
+
+  UIFont *_titleFont;
+
+  /** Shared by all themed buttons. Nil when the scheme has no shape scheme. */
+  MDCRectangleShapeGenerator *_shapeGenerator;
+
+  BOOL _hasStateElevations;
+  MDCShadowElevation _normalElevation;
+  MDCShadowElevation _highlightedElevation;
+  MDCShadowElevation _disabledElevation;
+
+  CGFloat _borderWidth;
+}
+
+- (instancetype)initWithScheme:(id<MDCContainerScheming>)scheme
+                       variant:(MDCButtonThemeVariant)variant {
+  self = [super init];
+  if (self) {
+    _variant = variant;
+    [self resolveColorsFromScheme:scheme];
+    [self resolveTypographyFromScheme:scheme];
+    [self resolveShapeFromScheme:scheme];
+    [self resolveElevationsAndBorder];
+  }
+  return self;
+}
+
+#pragma mark - Resolving
+
+- (void)resolveColorsFromScheme:(id<MDCContainerScheming>)scheme {
+  id<MDCColorScheming> colorScheme = scheme.colorScheme;
+  if (!colorScheme) {
+    colorScheme =
+        [[MDCSemanticColorScheme alloc] initWithDefaults:MDCColorSchemeDefaultsMaterial201804];
+  }
+
+  _disabledContentColor = [colorScheme.onSurfaceColor colorWithAlphaComponent:(CGFloat)0.38];
+  switch (_variant) {
+    case MDCButtonThemeVariantContained:
+      _resetMask = MDCButtonCompiledThemeResetBackgroundColor |
+                   MDCButtonCompiledThemeResetTitleColor |
+                   MDCButtonCompiledThemeResetImageTintColor;
+      _normalBackgroundColor = colorScheme.primaryColor;
+      _disabledBackgroundColor = [colorScheme.onSurfaceColor colorWithAlphaComponent:(CGFloat)0.12];
+      _normalContentColor = colorScheme.onPrimaryColor;
+      _inkColor = [colorScheme.onPrimaryColor colorWithAlphaComponent:(CGFloat)0.32];
+      break;
+    case MDCButtonThemeVariantOutlined:
+      _resetMask = MDCButtonCompiledThemeResetBackgroundColor |
+                   MDCButtonCompiledThemeResetTitleColor |
+                   MDCButtonCompiledThemeResetImageTintColor |
+                   MDCButtonCompiledThemeResetBorderColor;
+      _normalBackgroundColor = UIColor.clearColor;
+      _normalContentColor = colorScheme.primaryColor;
+      _normalBorderColor = [colorScheme.onSurfaceColor colorWithAlphaComponent:(CGFloat)0.12];
+      _inkColor = [colorScheme.primaryColor colorWithAlphaComponent:(CGFloat)0.12];
+      break;
+    case MDCButtonThemeVariantText:
+      _resetMask =
+          MDCButtonCompiledThemeResetBackgroundColor | MDCButtonCompiledThemeResetTitleColor;
+      _normalBackgroundColor = UIColor.clearColor;
+      _disabledBackgroundColor = UIColor.clearColor;
+      _normalContentColor = colorScheme.primaryColor;
+      _inkColor = [colorScheme.primaryColor colorWithAlphaComponent:(CGFloat)0.16];
+      break;
+  }
+}
+
+- (void)resolveTypographyFromScheme:(id<MDCContainerScheming>)scheme {
+  id<MDCTypographyScheming> typographyScheme = scheme.typographyScheme;
+  if (!typographyScheme) {
+    typographyScheme =
+        [[MDCTypographyScheme alloc] initWithDefaults:MDCTypographySchemeDefaultsMaterial201804];
+  }
+  _titleFont = typographyScheme.button;
+}
+
+- (void)resolveShapeFromScheme:(id<MDCContainerScheming>)scheme {
+  id<MDCShapeScheming> shapeScheme = scheme.shapeScheme;
+  if (!shapeScheme) {
+    return;
+  }
+  _shapeGenerator = [[MDCRectangleShapeGenerator alloc] init];
+  _shapeGenerator.topLeftCorner = shapeScheme.smallComponentShape.topLeftCorner;
+  _shapeGenerator.topRightCorner = shapeScheme.smallComponentShape.topRightCorner;
+  _shapeGenerator.bottomLeftCorner = shapeScheme.smallComponentShape.bottomLeftCorner;
+  _shapeGenerator.bottomRightCorner = shapeScheme.smallComponentShape.bottomRightCorner;
+}
+
+- (void)resolveElevationsAndBorder {
+  switch (_variant) {
+    case MDCButtonThemeVariantContained:
+      _hasStateElevations = YES;
+      _normalElevation = MDCShadowElevationRaisedButtonResting;
+      _highlightedElevation = MDCShadowElevationRaisedButtonPressed;
+      _disabledElevation = MDCShadowElevationNone;
+      break;
+    case MDCButtonThemeVariantOutlined:
+      _borderWidth = 1;
+      break;
+    case MDCButtonThemeVariantText:
+      break;
+  }
+}
+
+#pragma mark - Applying
+
+- (void)applyToButton:(MDCButton *)button {
+  MDCButtonCompiledThemeResetMask resetMask = _resetMask;
+  BOOL isText = _variant == MDCButtonThemeVariantText;
+  BOOL isOutlined = _variant == MDCButtonThemeVariantOutlined;
+
+  // A single pass over the states replaces the separate reset loops of the scheme-based path.
+  for (NSUInteger state = 0; state <= kMaximumStateValue; ++state) {
+    if (resetMask & MDCButtonCompiledThemeResetBackgroundColor) {
+      [button setBackgroundColor:nil forState:state];
+    }
+    if (resetMask & MDCButtonCompiledThemeResetTitleColor) {
+      [button setTitleColor:nil forState:state];
+    }
+    if (resetMask & MDCButtonCompiledThemeResetImageTintColor) {
+      [button setImageTintColor:nil forState:state];
+    }
+    if (resetMask & MDCButtonCompiledThemeResetBorderColor) {
+      [button setBorderColor:nil forState:state];
+    }
+    [button setTitleFont:nil forState:state];
+    if (isText) {
+      [button setElevation:MDCShadowElevationNone forState:state];
+    }
+    if (isOutlined) {
+      [button setBorderWidth:_borderWidth forState:state];
+    }
+  }
+
+  [button setBackgroundColor:_normalBackgroundColor forState:UIControlStateNormal];
+  if (_disabledBackgroundColor) {
+    [button setBackgroundColor:_disabledBackgroundColor forState:UIControlStateDisabled];
+  }
+  [button setTitleColor:_normalContentColor forState:UIControlStateNormal];
+  [button setTitleColor:_disabledContentColor forState:UIControlStateDisabled];
+  [button setImageTintColor:_normalContentColor forState:UIControlStateNormal];
+  [button setImageTintColor:_disabledContentColor forState:UIControlStateDisabled];
+  if (_normalBorderColor) {
+    [button setBorderColor:_normalBorderColor forState:UIControlStateNormal];
+  }
+  button.disabledAlpha = 1;
+  button.inkColor = _inkColor;
+
+  if (_shapeGenerator) {
+    button.shapeGenerator = _shapeGenerator;
+  } else {
+    button.layer.cornerRadius = (CGFloat)4;
+  }
+
+  [button setTitleFont:_titleFont forState:UIControlStateNormal];
+
+  if (_hasStateElevations) {
+    [button setElevation:_normalElevation forState:UIControlStateNormal];
+    [button setElevation:_highlightedElevation forState:UIControlStateHighlighted];
+    [button setElevation:_disabledElevation forState:UIControlStateDisabled];
+  }
+  button.minimumSize = CGSizeMake(0, 36);
+  MDCButtonSetThemedScheme(button, nil, _variant);
+}
+
+@end
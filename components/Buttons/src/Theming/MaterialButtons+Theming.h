@@ -13,4 +13,5 @@
 // limitations under the License.
 
 #import "MDCButton+MaterialTheming.h"
+#import "MDCButtonCompiledTheme.h"
 #import "MDCFloatingButton+MaterialTheming.h"
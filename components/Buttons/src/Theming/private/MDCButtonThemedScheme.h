@@ -0,0 +1,36 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#import <MaterialComponents/MaterialButtons.h>
+#import "MDCButtonCompiledTheme.h"
+#import "MaterialContainerScheme.h"
+
+/**
+ Returns YES if @c button was last themed with @c scheme in the @c variant style.
+
+ Only frozen schemes are recorded, so this always returns NO for other schemes.
+ */
+FOUNDATION_EXTERN BOOL MDCButtonIsThemedWithScheme(MDCButton *_Nonnull button,
+                                                   id<MDCContainerScheming> _Nonnull scheme,
+                                                   MDCButtonThemeVariant variant);
+
+/**
+ Records that @c button was themed with @c scheme in the @c variant style.
+
+ Pass nil for @c scheme when the button was themed without a scheme.
+ */
+FOUNDATION_EXTERN void MDCButtonSetThemedScheme(MDCButton *_Nonnull button,
+                                                id<MDCContainerScheming> _Nullable scheme,
+                                                MDCButtonThemeVariant variant);
@@ -0,0 +1,45 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#import "MDCButtonThemedScheme.h"
+
+#import <objc/runtime.h>
+
+static char kMDCButtonThemedSchemeKey;
+static char kMDCButtonThemedVariantKey;
+
+BOOL MDCButtonIsThemedWithScheme(MDCButton *button, id<MDCContainerScheming> scheme,
+                                 MDCButtonThemeVariant variant) {
+  if (objc_getAssociatedObject(button, &kMDCButtonThemedSchemeKey) != scheme) {
+    return NO;
+  }
+  NSNumber *themedVariant = objc_getAssociatedObject(button, &kMDCButtonThemedVariantKey);
+  return themedVariant.integerValue == variant;
+}
+
+void MDCButtonSetThemedScheme(MDCButton *button, id<MDCContainerScheming> scheme,
+                              MDCButtonThemeVariant variant) {
+  // Only frozen schemes can't change after theming, so other schemes must always be re-applied.
+  if (![(id)scheme isKindOfClass:[MDCFrozenContainerScheme class]]) {
+    scheme = nil;
+  }
+  if (!scheme && !objc_getAssociatedObject(button, &kMDCButtonThemedSchemeKey)) {
+    return;
+  }
+  objc_setAssociatedObject(button, &kMDCButtonThemedSchemeKey, scheme,
+                           OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+  objc_setAssociatedObject(button, &kMDCButtonThemedVariantKey, scheme ? @(variant) : nil,
+                           OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+}
@@ -0,0 +1,133 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+import XCTest
+
+import MaterialComponents.MaterialButtons
+import MaterialComponents.MaterialContainerScheme
+import MaterialComponents.MaterialShapeScheme
+import MaterialComponents.MaterialButtons_Theming
+
+class ButtonsCompiledThemeTests: XCTestCase {
+
+  static let benchmarkButtonCount = 1000
+  static let allStates: [UIControl.State] = (0...15).map { UIControl.State(rawValue: $0) }
+
+  func applySchemeTheme(
+    _ variant: MDCButtonThemeVariant, scheme: MDCContainerScheming, to button: MDCButton
+  ) {
+    switch variant {
+    case .contained:
+      button.applyContainedTheme(withScheme: scheme)
+    case .outlined:
+      button.applyOutlinedTheme(withScheme: scheme)
+    case .text:
+      button.applyTextTheme(withScheme: scheme)
+    @unknown default:
+      XCTFail("Unknown variant \(variant)")
+    }
+  }
+
+  /// Asserts that both buttons look the same in every state themes assign values to.
+  func assertButton(_ button: MDCButton, matches expected: MDCButton) {
+    for state in ButtonsCompiledThemeTests.allStates {
+      XCTAssertEqual(button.backgroundColor(for: state), expected.backgroundColor(for: state))
+      XCTAssertEqual(button.titleColor(for: state), expected.titleColor(for: state))
+      XCTAssertEqual(button.imageTintColor(for: state), expected.imageTintColor(for: state))
+      XCTAssertEqual(button.borderColor(for: state), expected.borderColor(for: state))
+      XCTAssertEqual(button.borderWidth(for: state), expected.borderWidth(for: state))
+      XCTAssertEqual(button.titleFont(for: state), expected.titleFont(for: state))
+      XCTAssertEqual(button.elevation(for: state), expected.elevation(for: state))
+    }
+    XCTAssertEqual(button.inkColor, expected.inkColor)
+    XCTAssertEqual(button.disabledAlpha, expected.disabledAlpha)
+    XCTAssertEqual(button.minimumSize, expected.minimumSize)
+    XCTAssertEqual(button.layer.cornerRadius, expected.layer.cornerRadius)
+    let size = CGSize(width: 88, height: 36)
+    XCTAssertEqual(
+      button.shapeGenerator?.path(for: size), expected.shapeGenerator?.path(for: size))
+  }
+
+  func assertCompiledThemeMatchesSchemeTheme(scheme: MDCContainerScheming) {
+    for variant in [MDCButtonThemeVariant.contained, .outlined, .text] {
+      // Given
+      let expectedButton = MDCButton()
+      let button = MDCButton()
+      let compiledTheme = MDCButtonCompiledTheme(scheme: scheme, variant: variant)
+
+      // When
+      applySchemeTheme(variant, scheme: scheme, to: expectedButton)
+      compiledTheme.apply(to: button)
+
+      // Then
+      assertButton(button, matches: expectedButton)
+    }
+  }
+
+  func testCompiledThemeMatchesSchemeTheme() {
+    assertCompiledThemeMatchesSchemeTheme(scheme: MDCContainerScheme())
+  }
+
+  func testCompiledThemeMatchesSchemeThemeWithShapeScheme() {
+    let scheme = MDCContainerScheme()
+    scheme.shapeScheme = MDCShapeScheme()
+    assertCompiledThemeMatchesSchemeTheme(scheme: scheme)
+  }
+
+  func testCompiledThemeReplacesAnotherVariant() {
+    // Given
+    let scheme = MDCContainerScheme()
+    scheme.shapeScheme = MDCShapeScheme()
+    let expectedButton = MDCButton()
+    let button = MDCButton()
+    expectedButton.applyOutlinedTheme(withScheme: scheme)
+    button.applyOutlinedTheme(withScheme: scheme)
+
+    // When
+    expectedButton.applyTextTheme(withScheme: scheme)
+    MDCButtonCompiledTheme(scheme: scheme, variant: .text).apply(to: button)
+
+    // Then
+    assertButton(button, matches: expectedButton)
+  }
+
+  func testThemingManyButtonsWithSchemePerformance() {
+    // Given
+    let scheme = MDCContainerScheme()
+    scheme.shapeScheme = MDCShapeScheme()
+    let buttons = (0..<ButtonsCompiledThemeTests.benchmarkButtonCount).map { _ in MDCButton() }
+
+    // When
+    measure {
+      for button in buttons {
+        button.applyContainedTheme(withScheme: scheme)
+      }
+    }
+  }
+
+  func testThemingManyButtonsWithCompiledThemePerformance() {
+    // Given
+    let scheme = MDCContainerScheme()
+    scheme.shapeScheme = MDCShapeScheme()
+    let buttons = (0..<ButtonsCompiledThemeTests.benchmarkButtonCount).map { _ in MDCButton() }
+
+    // When
+    measure {
+      let compiledTheme = MDCButtonCompiledTheme(scheme: scheme, variant: .contained)
+      for button in buttons {
+        compiledTheme.apply(to: button)
+      }
+    }
+  }
+}
@@ -0,0 +1,107 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+import XCTest
+
+import MaterialComponents.MaterialButtons
+import MaterialComponents.MaterialColorScheme
+import MaterialComponents.MaterialContainerScheme
+import MaterialComponents.MaterialShapeScheme
+import MaterialComponents.MaterialButtons_Theming
+
+class ButtonsFrozenSchemeThemingTests: XCTestCase {
+
+  static let reusedCellCount = 20
+  static let reuseCount = 1000
+
+  func testReapplyingAFrozenSchemeSkipsTheming() {
+    // Given
+    let scheme = MDCFrozenContainerScheme(scheme: MDCContainerScheme())
+    let button = MDCButton()
+    button.applyContainedTheme(withScheme: scheme)
+    button.setBackgroundColor(.orange, for: .normal)
+
+    // When
+    button.applyContainedTheme(withScheme: scheme)
+
+    // Then
+    XCTAssertEqual(button.backgroundColor(for: .normal), .orange)
+  }
+
+  func testApplyingAFrozenSchemeInAnotherStyleThemes() {
+    // Given
+    let scheme = MDCFrozenContainerScheme(scheme: MDCContainerScheme())
+    let button = MDCButton()
+    button.applyContainedTheme(withScheme: scheme)
+
+    // When
+    button.applyTextTheme(withScheme: scheme)
+
+    // Then
+    XCTAssertEqual(button.backgroundColor(for: .normal), .clear)
+  }
+
+  func testReapplyingAMutableSchemeThemes() {
+    // Given
+    let scheme = MDCContainerScheme()
+    let button = MDCButton()
+    button.applyContainedTheme(withScheme: scheme)
+    button.setBackgroundColor(.orange, for: .normal)
+
+    // When
+    button.applyContainedTheme(withScheme: scheme)
+
+    // Then
+    XCTAssertEqual(button.backgroundColor(for: .normal), scheme.colorScheme.primaryColor)
+  }
+
+  func testReapplyingAFrozenSchemeAfterAnotherThemeThemes() {
+    // Given
+    let scheme = MDCFrozenContainerScheme(scheme: MDCContainerScheme())
+    let button = MDCButton()
+    button.applyContainedTheme(withScheme: scheme)
+    button.applyContainedTheme(
+      withColorScheme: MDCSemanticColorScheme(defaults: .materialDark201907))
+
+    // When
+    button.applyContainedTheme(withScheme: scheme)
+
+    // Then
+    XCTAssertEqual(button.backgroundColor(for: .normal), scheme.colorScheme.primaryColor)
+  }
+
+  /// Themes the buttons of reused cells the way a collection view data source does.
+  func reuseCells(scheme: MDCContainerScheming) {
+    let buttons =
+      (0..<ButtonsFrozenSchemeThemingTests.reusedCellCount).map { _ in MDCButton() }
+    measure {
+      for reuse in 0..<ButtonsFrozenSchemeThemingTests.reuseCount {
+        buttons[reuse % buttons.count].applyContainedTheme(withScheme: scheme)
+      }
+    }
+  }
+
+  func testCellReuseWithMutableSchemePerformance() {
+    let scheme = MDCContainerScheme()
+    scheme.shapeScheme = MDCShapeScheme()
+    reuseCells(scheme: scheme)
+  }
+
+  func testCellReuseWithFrozenSchemePerformance() {
+    let scheme = MDCContainerScheme()
+    scheme.shapeScheme = MDCShapeScheme()
+    reuseCells(scheme: MDCFrozenContainerScheme(scheme: scheme))
+  }
+}
@@ -364,6 +364,18 @@ static const BOOL MDCCardIsInteractableDefault = YES;
   }
 }
 
+- (void)didMoveToSuperview {
+  [super didMoveToSuperview];
+
+  [self mdc_elevationHierarchyDidChange];
+}
+
+- (void)didMoveToWindow {
+  [super didMoveToWindow];
+
+  [self mdc_elevationHierarchyDidChange];
+}
+
 - (CGFloat)mdc_currentElevation {
   return [self shadowElevationForState:self.state];
 }
@@ -644,6 +644,18 @@ static const BOOL MDCCardCellIsInteractableDefault = YES;
   }
 }
 
+- (void)didMoveToSuperview {
+  [super didMoveToSuperview];
+
+  [self mdc_elevationHierarchyDidChange];
+}
+
+- (void)didMoveToWindow {
+  [super didMoveToWindow];
+
+  [self mdc_elevationHierarchyDidChange];
+}
+
 - (CGFloat)mdc_currentElevation {
   return [self shadowElevationForState:self.state];
 }
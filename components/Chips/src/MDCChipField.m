@@ -16,8 +16,10 @@
 
 #import <MDFInternationalization/MDFInternationalization.h>
 
+#import "MaterialGlyphCache.h"
 #import "MaterialMath.h"
 #import "MaterialTextFields.h"
+#import "private/MDCChipView+Private.h"
 
 NSString *const MDCEmptyTextString = @"";
 NSString *const MDCChipDelimiterSpace = @" ";
@@ -31,6 +33,24 @@ static const CGFloat MDCChipFieldClearButtonSquareWidthHeight = 24;
 static const CGFloat MDCChipFieldClearImageSquareWidthHeight = 18;
 static const UIKeyboardType MDCChipFieldDefaultKeyboardType = UIKeyboardTypeEmailAddress;
 
+/** The size of a chip that has to be measured before it can be flowed. */
+static const CGSize MDCChipFieldUnmeasuredChipSize = {-1, -1};
+
+/** The measured size and flowed position of a chip in the chip field. */
+typedef struct MDCChipFieldChipLayout {
+  /** The chip's size, or MDCChipFieldUnmeasuredChipSize. */
+  CGSize size;
+
+  /** The width @c size was limited to when the chip was measured. */
+  CGFloat maxWidth;
+
+  /** The chip's frame, in left-to-right coordinates. */
+  CGRect frame;
+
+  /** The row the chip was flowed onto. */
+  NSUInteger row;
+} MDCChipFieldChipLayout;
+
 const CGFloat MDCChipFieldDefaultMinTextFieldWidth = 60;
 const UIEdgeInsets MDCChipFieldDefaultContentEdgeInsets = {
     MDCChipFieldVerticalInset, MDCChipFieldHorizontalInset, MDCChipFieldVerticalInset,
@@ -115,6 +135,21 @@ const UIEdgeInsets MDCChipFieldDefaultContentEdgeInsets = {
 
 @implementation MDCChipField {
   NSMutableArray<MDCChipView *> *_chips;
+
+  // The layout of each chip, in the same order as _chips. Chips are only measured again when they
+  // are added or their size may have changed, and only the chips after the first changed one are
+  // flowed again.
+  MDCChipFieldChipLayout *_chipLayouts;
+  NSUInteger _chipLayoutsCapacity;
+  NSUInteger _flowedChipCount;
+
+  // The chips that reported a change in size since the last layout pass.
+  NSHashTable<MDCChipView *> *_chipsWithInvalidSizes;
+
+  // The values the cached chip frames were calculated with.
+  CGFloat _chipLayoutsFieldWidth;
+  CGFloat _chipLayoutsChipHeight;
+  UIEdgeInsets _chipLayoutsContentEdgeInsets;
 }
 
 - (instancetype)initWithFrame:(CGRect)frame {
@@ -160,10 +195,12 @@ const UIEdgeInsets MDCChipFieldDefaultContentEdgeInsets = {
 
 - (void)dealloc {
   [[NSNotificationCenter defaultCenter] removeObserver:self];
+  free(_chipLayouts);
 }
 
 - (void)commonMDCChipFieldInit {
   _chips = [NSMutableArray array];
+  _chipsWithInvalidSizes = [NSHashTable weakObjectsHashTable];
   _delimiter = MDCChipFieldDelimiterDefault;
   _minTextFieldWidth = MDCChipFieldDefaultMinTextFieldWidth;
   _contentEdgeInsets = MDCChipFieldDefaultContentEdgeInsets;
@@ -180,11 +217,12 @@ const UIEdgeInsets MDCChipFieldDefaultContentEdgeInsets = {
       self.mdf_effectiveUserInterfaceLayoutDirection == UIUserInterfaceLayoutDirectionRightToLeft;
 
   // Calculate the frames for all the chips and set them.
-  NSArray *chipFrames = [self chipFramesForSize:standardizedBounds.size];
-  for (NSUInteger index = 0; index < _chips.count; index++) {
+  const MDCChipFieldChipLayout *chipLayouts = [self chipLayoutsForSize:standardizedBounds.size];
+  NSUInteger chipCount = _chips.count;
+  for (NSUInteger index = 0; index < chipCount; index++) {
     MDCChipView *chip = _chips[index];
 
-    CGRect chipFrame = [chipFrames[index] CGRectValue];
+    CGRect chipFrame = chipLayouts[index].frame;
     if (isRTL) {
       chipFrame = MDFRectFlippedHorizontally(chipFrame, CGRectGetWidth(self.bounds));
     }
@@ -192,7 +230,7 @@ const UIEdgeInsets MDCChipFieldDefaultContentEdgeInsets = {
   }
 
   // Get the last chip frame and calculate the text field frame from that.
-  CGRect lastChipFrame = [chipFrames.lastObject CGRectValue];
+  CGRect lastChipFrame = chipCount > 0 ? chipLayouts[chipCount - 1].frame : CGRectZero;
   CGRect textFieldFrame = [self frameForTextFieldForLastChipFrame:lastChipFrame
                                                     chipFieldSize:standardizedBounds.size];
   if (isRTL) {
@@ -222,8 +260,9 @@ const UIEdgeInsets MDCChipFieldDefaultContentEdgeInsets = {
 }
 
 - (CGSize)sizeThatFits:(CGSize)size {
-  NSArray *chipFrames = [self chipFramesForSize:size];
-  CGRect lastChipFrame = [chipFrames.lastObject CGRectValue];
+  const MDCChipFieldChipLayout *chipLayouts = [self chipLayoutsForSize:size];
+  NSUInteger chipCount = _chips.count;
+  CGRect lastChipFrame = chipCount > 0 ? chipLayouts[chipCount - 1].frame : CGRectZero;
   CGRect textFieldFrame = [self frameForTextFieldForLastChipFrame:lastChipFrame chipFieldSize:size];
 
   // Calculate the required size off the text field.
@@ -251,6 +290,7 @@ const UIEdgeInsets MDCChipFieldDefaultContentEdgeInsets = {
   }
 
   _chips = [chips mutableCopy];
+  [self resetChipLayouts];
   for (MDCChipView *chip in _chips) {
     [self addChipSubview:chip];
   }
@@ -278,6 +318,7 @@ const UIEdgeInsets MDCChipFieldDefaultContentEdgeInsets = {
   // Clients calling |addChip| directly programmatically are expected to handle such restrictions
   // themselves rather than using |chipField:shouldAddChip| to prevent chips from being added.
   [_chips addObject:chip];
+  [self insertChipLayoutAtIndex:_chips.count - 1];
   [self addChipSubview:chip];
   if ([self.delegate respondsToSelector:@selector(chipField:didAddChip:)]) {
     [self.delegate chipField:self didAddChip:chip];
@@ -290,7 +331,15 @@ const UIEdgeInsets MDCChipFieldDefaultContentEdgeInsets = {
 }
 
 - (void)removeChip:(MDCChipView *)chip {
+  NSUInteger index = [_chips indexOfObject:chip];
+  NSUInteger previousChipCount = _chips.count;
   [_chips removeObject:chip];
+  if (_chips.count + 1 == previousChipCount) {
+    [self removeChipLayoutAtIndex:index];
+  } else if (_chips.count != previousChipCount) {
+    // The chip was in the field more than once.
+    [self resetChipLayouts];
+  }
   [self removeChipSubview:chip];
   if ([self.delegate respondsToSelector:@selector(chipField:didRemoveChip:)]) {
     [self.delegate chipField:self didRemoveChip:chip];
@@ -338,6 +387,13 @@ const UIEdgeInsets MDCChipFieldDefaultContentEdgeInsets = {
   }
 }
 
+- (void)traitCollectionDidChange:(UITraitCollection *)previousTraitCollection {
+  [super traitCollectionDidChange:previousTraitCollection];
+
+  // The chips' fonts may have changed along with the preferred content size category.
+  [self resetChipLayouts];
+}
+
 - (void)setContentEdgeInsets:(UIEdgeInsets)contentEdgeInsets {
   if (!UIEdgeInsetsEqualToEdgeInsets(_contentEdgeInsets, contentEdgeInsets)) {
     _contentEdgeInsets = contentEdgeInsets;
@@ -404,15 +460,15 @@ const UIEdgeInsets MDCChipFieldDefaultContentEdgeInsets = {
   CGSize clearButtonSize =
       CGSizeMake(MDCChipFieldClearImageSquareWidthHeight, MDCChipFieldClearImageSquareWidthHeight);
 
-  CGRect bounds = CGRectMake(0, 0, clearButtonSize.width, clearButtonSize.height);
-  UIGraphicsBeginImageContextWithOptions(bounds.size, false, 0);
-  [UIColor.grayColor setFill];
-  [MDCPathForClearButtonImageFrame(bounds) fill];
-  UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
-  UIGraphicsEndImageContext();
-
-  image = [image imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
-  return image;
+  // Every chip shows the same glyph, so they all share one bitmap.
+  MDCGlyphDrawingBlock drawingBlock = ^(CGRect bounds) {
+    [UIColor.grayColor setFill];
+    [MDCPathForClearButtonImageFrame(bounds) fill];
+  };
+  return [[MDCGlyphCache sharedCache] templateImageForGlyphNamed:@"ic_clear"
+                                                            size:clearButtonSize
+                                                           scale:0
+                                                    drawingBlock:drawingBlock];
 }
 
 static inline UIBezierPath *MDCPathForClearButtonImageFrame(CGRect frame) {
@@ -618,6 +674,8 @@ static inline UIBezierPath *MDCPathForClearButtonImageFrame(CGRect frame) {
 #pragma mark - Private
 
 - (void)removeChipSubview:(MDCChipView *)chip {
+  chip.intrinsicContentSizeInvalidationHandler = nil;
+  [_chipsWithInvalidSizes removeObject:chip];
   [chip removeFromSuperview];
   [chip removeTarget:chip.superview
                 action:@selector(chipTapped:)
@@ -625,6 +683,10 @@ static inline UIBezierPath *MDCPathForClearButtonImageFrame(CGRect frame) {
 }
 
 - (void)addChipSubview:(MDCChipView *)chip {
+  __weak MDCChipField *weakSelf = self;
+  chip.intrinsicContentSizeInvalidationHandler = ^(MDCChipView *invalidatedChip) {
+    [weakSelf chipDidInvalidateIntrinsicContentSize:invalidatedChip];
+  };
   if (chip.superview != self) {
     [chip addTarget:self
                   action:@selector(chipTapped:)
@@ -662,32 +724,126 @@ static inline UIBezierPath *MDCPathForClearButtonImageFrame(CGRect frame) {
 
 #pragma mark - Sizing
 
-- (NSArray<NSValue *> *)chipFramesForSize:(CGSize)size {
-  NSMutableArray *chipFrames = [NSMutableArray arrayWithCapacity:self.chips.count];
-  CGFloat chipFieldMaxX = size.width - self.contentEdgeInsets.right;
-  CGFloat maxWidth = size.width - self.contentEdgeInsets.left - self.contentEdgeInsets.right;
-  NSUInteger row = 0;
-  CGFloat currentOriginX = self.contentEdgeInsets.left;
+- (void)ensureChipLayoutsCapacity:(NSUInteger)capacity {
+  if (capacity <= _chipLayoutsCapacity) {
+    return;
+  }
+  NSUInteger newCapacity = MAX(capacity, MAX(2 * _chipLayoutsCapacity, (NSUInteger)16));
+  _chipLayouts = realloc(_chipLayouts, newCapacity * sizeof(MDCChipFieldChipLayout));
+  _chipLayoutsCapacity = newCapacity;
+}
 
-  for (MDCChipView *chip in self.chips) {
-    CGSize chipSize = [chip sizeThatFits:CGSizeMake(maxWidth, self.chipHeight)];
-    chipSize.width = MIN(chipSize.width, maxWidth);
+/** Discards the cached layouts of all chips. */
+- (void)resetChipLayouts {
+  NSUInteger chipCount = _chips.count;
+  [self ensureChipLayoutsCapacity:chipCount];
+  for (NSUInteger index = 0; index < chipCount; index++) {
+    _chipLayouts[index].size = MDCChipFieldUnmeasuredChipSize;
+  }
+  _flowedChipCount = 0;
+}
+
+/** Makes room for the layout of a chip that was inserted into @c _chips at @c index. */
+- (void)insertChipLayoutAtIndex:(NSUInteger)index {
+  NSUInteger chipCount = _chips.count;
+  [self ensureChipLayoutsCapacity:chipCount];
+  memmove(&_chipLayouts[index + 1], &_chipLayouts[index],
+          (chipCount - 1 - index) * sizeof(MDCChipFieldChipLayout));
+  _chipLayouts[index].size = MDCChipFieldUnmeasuredChipSize;
+  _flowedChipCount = MIN(_flowedChipCount, index);
+}
+
+/** Removes the layout of a chip that was removed from @c _chips at @c index. */
+- (void)removeChipLayoutAtIndex:(NSUInteger)index {
+  memmove(&_chipLayouts[index], &_chipLayouts[index + 1],
+          (_chips.count - index) * sizeof(MDCChipFieldChipLayout));
+  _flowedChipCount = MIN(_flowedChipCount, index);
+}
+
+/** Remembers that @c chip has to be measured again before the next layout pass. */
+- (void)chipDidInvalidateIntrinsicContentSize:(MDCChipView *)chip {
+  [_chipsWithInvalidSizes addObject:chip];
+  [self invalidateIntrinsicContentSize];
+  [self setNeedsLayout];
+}
+
+/** Marks the chip at @c index as needing to be measured and flowed again. */
+- (void)invalidateChipLayoutAtIndex:(NSUInteger)index {
+  _chipLayouts[index].size = MDCChipFieldUnmeasuredChipSize;
+  _flowedChipCount = MIN(_flowedChipCount, index);
+}
+
+/**
+ Returns the layouts of all chips for a chip field of the given size. The returned array holds one
+ entry per chip and is only valid until the chips change.
+ */
+- (const MDCChipFieldChipLayout *)chipLayoutsForSize:(CGSize)size {
+  UIEdgeInsets contentEdgeInsets = self.contentEdgeInsets;
+  CGFloat chipHeight = self.chipHeight;
+  NSUInteger chipCount = _chips.count;
+  if (chipHeight != _chipLayoutsChipHeight) {
+    // Every chip is measured against the chip height.
+    [self resetChipLayouts];
+    _chipLayoutsChipHeight = chipHeight;
+  }
+  if (size.width != _chipLayoutsFieldWidth ||
+      !UIEdgeInsetsEqualToEdgeInsets(contentEdgeInsets, _chipLayoutsContentEdgeInsets)) {
+    // Each chip keeps its size unless it no longer fits, or was limited by the old width.
+    _flowedChipCount = 0;
+    _chipLayoutsFieldWidth = size.width;
+    _chipLayoutsContentEdgeInsets = contentEdgeInsets;
+  }
+  if (_chipsWithInvalidSizes.count > 0) {
+    for (NSUInteger index = 0; index < chipCount; index++) {
+      if ([_chipsWithInvalidSizes containsObject:_chips[index]]) {
+        [self invalidateChipLayoutAtIndex:index];
+      }
+    }
+    [_chipsWithInvalidSizes removeAllObjects];
+  }
+
+  CGFloat chipFieldMaxX = size.width - contentEdgeInsets.right;
+  CGFloat maxWidth = size.width - contentEdgeInsets.left - contentEdgeInsets.right;
+  NSUInteger row = 0;
+  CGFloat currentOriginX = contentEdgeInsets.left;
+
+  // Resume flowing after the last chip whose frame is still valid.
+  if (_flowedChipCount > 0) {
+    MDCChipFieldChipLayout previousChipLayout = _chipLayouts[_flowedChipCount - 1];
+    row = previousChipLayout.row;
+    currentOriginX = CGRectGetMaxX(previousChipLayout.frame) + MDCChipFieldHorizontalMargin;
+  }
+
+  for (NSUInteger index = _flowedChipCount; index < chipCount; index++) {
+    MDCChipFieldChipLayout *chipLayout = &_chipLayouts[index];
+    BOOL wasLimitedByOtherWidth =
+        chipLayout->size.width >= chipLayout->maxWidth && chipLayout->maxWidth != maxWidth;
+    if (CGSizeEqualToSize(chipLayout->size, MDCChipFieldUnmeasuredChipSize) ||
+        chipLayout->size.width > maxWidth || wasLimitedByOtherWidth) {
+      CGSize chipSize = [_chips[index] sizeThatFits:CGSizeMake(maxWidth, chipHeight)];
+      chipSize.width = MIN(chipSize.width, maxWidth);
+      chipLayout->size = chipSize;
+      chipLayout->maxWidth = maxWidth;
+    }
+    CGSize chipSize = chipLayout->size;
 
     CGFloat availableWidth = chipFieldMaxX - currentOriginX;
     // Check if the chip will fit on the current line.  If it won't fit and the available width
     // is the maximum width, it won't fit on any line. Put it on the current one and move on.
     if (chipSize.width > availableWidth &&
-        availableWidth < (chipFieldMaxX - self.contentEdgeInsets.right)) {
+        availableWidth < (chipFieldMaxX - contentEdgeInsets.right)) {
       row++;
-      currentOriginX = self.contentEdgeInsets.left;
+      currentOriginX = contentEdgeInsets.left;
     }
     CGFloat currentOriginY =
-        self.contentEdgeInsets.top + (row * (self.chipHeight + MDCChipFieldVerticalMargin));
+        contentEdgeInsets.top + (row * (chipHeight + MDCChipFieldVerticalMargin));
     CGRect chipFrame = CGRectMake(currentOriginX, currentOriginY, chipSize.width, chipSize.height);
-    [chipFrames addObject:[NSValue valueWithCGRect:chipFrame]];
+    chipLayout->frame = chipFrame;
+    chipLayout->row = row;
     currentOriginX = CGRectGetMaxX(chipFrame) + MDCChipFieldHorizontalMargin;
   }
-  return [chipFrames copy];
+  _flowedChipCount = chipCount;
+  return _chipLayouts;
 }
 
 - (CGRect)frameForTextFieldForLastChipFrame:(CGRect)lastChipFrame
@@ -99,6 +99,32 @@ static inline CGSize CGSizeShrinkWithInsets(CGSize size, UIEdgeInsets edgeInsets
                     size.height - UIEdgeInsetsVertical(edgeInsets));
 }
 
+/** A title label that tells its chip when the size of its text may have changed. */
+@interface MDCChipViewTitleLabel : UILabel
+@end
+
+@implementation MDCChipViewTitleLabel
+
+- (void)invalidateIntrinsicContentSize {
+  [super invalidateIntrinsicContentSize];
+  [self.superview invalidateIntrinsicContentSize];
+}
+
+@end
+
+/** An image view that tells its chip when the size of its image may have changed. */
+@interface MDCChipViewImageView : UIImageView
+@end
+
+@implementation MDCChipViewImageView
+
+- (void)invalidateIntrinsicContentSize {
+  [super invalidateIntrinsicContentSize];
+  [self.superview invalidateIntrinsicContentSize];
+}
+
+@end
+
 @interface MDCChipView ()
 @property(nonatomic, readonly) CGRect contentRect;
 @property(nonatomic, readonly, strong) MDCShapedShadowLayer *layer;
@@ -182,13 +208,13 @@ static inline CGSize CGSizeShrinkWithInsets(CGSize size, UIEdgeInsets edgeInsets
 
     _rippleView = [[MDCStatefulRippleView alloc] initWithFrame:self.bounds];
 
-    _imageView = [[UIImageView alloc] init];
+    _imageView = [[MDCChipViewImageView alloc] init];
     [self addSubview:_imageView];
 
-    _selectedImageView = [[UIImageView alloc] init];
+    _selectedImageView = [[MDCChipViewImageView alloc] init];
     [self addSubview:_selectedImageView];
 
-    _titleLabel = [[UILabel alloc] init];
+    _titleLabel = [[MDCChipViewTitleLabel alloc] init];
     // If we are using the default (system) font loader, retrieve the
     // font from the UIFont standardFont API.
     if ([MDCTypography.fontLoader isKindOfClass:[MDCSystemFontLoader class]]) {
@@ -323,6 +349,37 @@ static inline CGSize CGSizeShrinkWithInsets(CGSize size, UIEdgeInsets edgeInsets
   if (accessoryView) {
     [self insertSubview:accessoryView aboveSubview:_titleLabel];
   }
+  [self invalidateIntrinsicContentSize];
+}
+
+- (void)setContentPadding:(UIEdgeInsets)contentPadding {
+  _contentPadding = contentPadding;
+  [self invalidateIntrinsicContentSize];
+  [self setNeedsLayout];
+}
+
+- (void)setImagePadding:(UIEdgeInsets)imagePadding {
+  _imagePadding = imagePadding;
+  [self invalidateIntrinsicContentSize];
+  [self setNeedsLayout];
+}
+
+- (void)setAccessoryPadding:(UIEdgeInsets)accessoryPadding {
+  _accessoryPadding = accessoryPadding;
+  [self invalidateIntrinsicContentSize];
+  [self setNeedsLayout];
+}
+
+- (void)setTitlePadding:(UIEdgeInsets)titlePadding {
+  _titlePadding = titlePadding;
+  [self invalidateIntrinsicContentSize];
+  [self setNeedsLayout];
+}
+
+- (void)setMinimumSize:(CGSize)minimumSize {
+  _minimumSize = minimumSize;
+  [self invalidateIntrinsicContentSize];
+  [self setNeedsLayout];
 }
 
 - (nullable UIColor *)backgroundColorForState:(UIControlState)state {
@@ -390,6 +447,18 @@ static inline CGSize CGSizeShrinkWithInsets(CGSize size, UIEdgeInsets edgeInsets
   self.layer.shapedBorderWidth = [self borderWidthForState:self.state];
 }
 
+- (void)didMoveToSuperview {
+  [super didMoveToSuperview];
+
+  [self mdc_elevationHierarchyDidChange];
+}
+
+- (void)didMoveToWindow {
+  [super didMoveToWindow];
+
+  [self mdc_elevationHierarchyDidChange];
+}
+
 - (CGFloat)mdc_currentElevation {
   return [self elevationForState:self.state];
 }
@@ -536,6 +605,7 @@ static inline CGSize CGSizeShrinkWithInsets(CGSize size, UIEdgeInsets edgeInsets
   }
   self.titleLabel.font = titleFont;
 
+  [self invalidateIntrinsicContentSize];
   [self setNeedsLayout];
 }
 
@@ -613,10 +683,15 @@ static inline CGSize CGSizeShrinkWithInsets(CGSize size, UIEdgeInsets edgeInsets
 }
 
 - (void)setSelected:(BOOL)selected {
+  BOOL selectionChanged = self.selected != selected;
   [super setSelected:selected];
 
   self.rippleView.selected = selected;
   [self updateState];
+  if (selectionChanged) {
+    // Chips with a selected image grow when they are selected.
+    [self invalidateIntrinsicContentSize];
+  }
   [self setNeedsLayout];
 }
 
@@ -802,6 +877,13 @@ static inline CGSize CGSizeShrinkWithInsets(CGSize size, UIEdgeInsets edgeInsets
   return [self sizeThatFits:CGSizeMake(CGFLOAT_MAX, CGFLOAT_MAX)];
 }
 
+- (void)invalidateIntrinsicContentSize {
+  [super invalidateIntrinsicContentSize];
+  if (self.intrinsicContentSizeInvalidationHandler) {
+    self.intrinsicContentSizeInvalidationHandler(self);
+  }
+}
+
 - (void)willMoveToSuperview:(UIView *)newSuperview {
   [super willMoveToSuperview:newSuperview];
   [self.inkView cancelAllAnimationsAnimated:NO];
@@ -14,6 +14,17 @@
 
 #import "MDCChipView.h"
 
+@interface MDCChipView ()
+
+/**
+ Called when something the chip's size depends on may have changed, such as its title label's text
+ or font, its images or its paddings. Set by the chip field that lays out the chip.
+ */
+@property(nonatomic, copy, nullable) void (^intrinsicContentSizeInvalidationHandler)
+    (MDCChipView *_Nonnull chip);
+
+@end
+
 @interface MDCChipView (Private)
 
 - (void)startTouchBeganAnimationAtPoint:(CGPoint)point;
@@ -17,8 +17,15 @@
 #import <XCTest/XCTest.h>
 
 #import "../../src/MDCChipField.h"
+#import "MDCChipView+Private.h"
 #import "MaterialTypography.h"
 
+/** The number of chips used to measure chip fields with delete buttons. */
+static const NSUInteger kDeletableChipCount = 500;
+
+/** The number of chips added one at a time when measuring chip field reflow. */
+static const NSUInteger kIncrementallyAddedChipCount = 1000;
+
 // Expose internal methods for testing
 @interface MDCChipField (Testing)
 - (void)createNewChipFromInput;
@@ -40,6 +47,20 @@
 
 @end
 
+/** Counts how many times a chip is measured. */
+@interface MDCChipsTestsCountingChipView : MDCChipView
+@property(nonatomic, assign) NSUInteger measurementCount;
+@end
+
+@implementation MDCChipsTestsCountingChipView
+
+- (CGSize)sizeThatFits:(CGSize)size {
+  self.measurementCount += 1;
+  return [super sizeThatFits:size];
+}
+
+@end
+
 static inline UIColor *MDCColorFromRGB(uint32_t rgbValue) {
   return [UIColor colorWithRed:((CGFloat)((rgbValue & 0xFF0000) >> 16)) / 255
                          green:((CGFloat)((rgbValue & 0x00FF00) >> 8)) / 255
@@ -413,6 +434,161 @@ static inline UIImage *TestImage(CGSize size) {
   XCTAssertEqual(controlViewCount, (NSUInteger)1);
 }
 
+- (MDCChipField *)chipFieldWithDeletableChipCount:(NSUInteger)chipCount {
+  MDCChipField *field = [[MDCChipField alloc] init];
+  field.showChipsDeleteButton = YES;
+  for (NSUInteger i = 0; i < chipCount; ++i) {
+    field.textField.text = [NSString stringWithFormat:@"Chip %lu", (unsigned long)i];
+    [field createNewChipFromInput];
+  }
+  return field;
+}
+
+- (void)testDeleteButtonsOfAllChipsShareOneImage {
+  // Given
+  NSHashTable<UIImage *> *images =
+      [NSHashTable hashTableWithOptions:NSPointerFunctionsObjectPointerPersonality];
+
+  // When
+  MDCChipField *field = [self chipFieldWithDeletableChipCount:kDeletableChipCount];
+  for (MDCChipView *chip in field.chips) {
+    for (UIView *subview in chip.accessoryView.subviews) {
+      if ([subview isKindOfClass:[UIImageView class]]) {
+        [images addObject:((UIImageView *)subview).image];
+      }
+    }
+  }
+
+  // Then
+  XCTAssertEqual(field.chips.count, kDeletableChipCount);
+  XCTAssertEqual(images.count, 1U);
+  XCTAssertEqual(images.anyObject.renderingMode, UIImageRenderingModeAlwaysTemplate);
+}
+
+- (void)testAddingDeletableChipsPerformance {
+  [self measureBlock:^{
+    // When
+    MDCChipField *field = [self chipFieldWithDeletableChipCount:kDeletableChipCount];
+
+    // Then
+    XCTAssertEqual(field.chips.count, kDeletableChipCount);
+  }];
+}
+
+- (void)testAddingDeletableChipsMemory {
+  if (@available(iOS 13.0, *)) {
+    [self measureWithMetrics:@[ [[XCTMemoryMetric alloc] init] ]
+                       block:^{
+                         // When
+                         MDCChipField *field =
+                             [self chipFieldWithDeletableChipCount:kDeletableChipCount];
+
+                         // Then
+                         XCTAssertEqual(field.chips.count, kDeletableChipCount);
+                       }];
+  }
+}
+
+- (MDCChipView *)chipWithTitle:(NSString *)title {
+  MDCChipView *chip = [[MDCChipView alloc] init];
+  chip.titleLabel.text = title;
+  return chip;
+}
+
+- (void)testRemovingChipReflowsFollowingChipsLikeAFreshLayout {
+  // Given
+  NSMutableArray<NSString *> *titles = [NSMutableArray array];
+  MDCChipField *field = [[MDCChipField alloc] initWithFrame:CGRectMake(0, 0, 320, 400)];
+  for (NSUInteger i = 0; i < 20; ++i) {
+    NSString *title = [@"" stringByPaddingToLength:(i % 7) + 1 withString:@"W" startingAtIndex:0];
+    [titles addObject:title];
+    [field addChip:[self chipWithTitle:title]];
+  }
+  [field layoutIfNeeded];
+
+  // When
+  [field removeChip:field.chips[5]];
+  [titles removeObjectAtIndex:5];
+  [field layoutIfNeeded];
+
+  // Then
+  MDCChipField *freshField = [[MDCChipField alloc] initWithFrame:CGRectMake(0, 0, 320, 400)];
+  for (NSString *title in titles) {
+    [freshField addChip:[self chipWithTitle:title]];
+  }
+  [freshField layoutIfNeeded];
+  XCTAssertEqual(field.chips.count, freshField.chips.count);
+  for (NSUInteger i = 0; i < field.chips.count; ++i) {
+    XCTAssertTrue(CGRectEqualToRect(field.chips[i].frame, freshField.chips[i].frame));
+  }
+  XCTAssertTrue(CGSizeEqualToSize([field sizeThatFits:CGSizeMake(320, CGFLOAT_MAX)],
+                                  [freshField sizeThatFits:CGSizeMake(320, CGFLOAT_MAX)]));
+}
+
+- (void)testRetitledChipIsMeasuredAgain {
+  // Given
+  MDCChipField *field = [[MDCChipField alloc] initWithFrame:CGRectMake(0, 0, 320, 400)];
+  MDCChipView *chip = [self chipWithTitle:@"A"];
+  [field addChip:chip];
+  [field layoutIfNeeded];
+  CGFloat shortTitleWidth = CGRectGetWidth(chip.frame);
+
+  // When
+  chip.titleLabel.text = @"A much longer title";
+  [field layoutIfNeeded];
+
+  // Then
+  XCTAssertGreaterThan(CGRectGetWidth(chip.frame), shortTitleWidth);
+  XCTAssertEqualWithAccuracy(CGRectGetWidth(chip.frame), chip.intrinsicContentSize.width, 0.001);
+}
+
+- (void)testChipsKeepTheirSizesWhenTheFieldGetsWider {
+  // Given
+  MDCChipField *field = [[MDCChipField alloc] initWithFrame:CGRectMake(0, 0, 320, 400)];
+  MDCChipsTestsCountingChipView *chip = [[MDCChipsTestsCountingChipView alloc] init];
+  chip.titleLabel.text = @"Chip";
+  [field addChip:chip];
+  [field layoutIfNeeded];
+  CGRect narrowFrame = chip.frame;
+  chip.measurementCount = 0;
+
+  // When
+  field.frame = CGRectMake(0, 0, 640, 400);
+  [field layoutIfNeeded];
+
+  // Then
+  XCTAssertEqual(chip.measurementCount, 0U);
+  XCTAssertTrue(CGSizeEqualToSize(chip.frame.size, narrowFrame.size));
+}
+
+- (void)testRemovedChipNoLongerInvalidatesTheField {
+  // Given
+  MDCChipField *field = [[MDCChipField alloc] initWithFrame:CGRectMake(0, 0, 320, 400)];
+  MDCChipView *chip = [self chipWithTitle:@"Chip"];
+  [field addChip:chip];
+  [field removeChip:chip];
+
+  // Then
+  XCTAssertNil(chip.intrinsicContentSizeInvalidationHandler);
+}
+
+- (void)testAddingChipsOneAtATimePerformance {
+  [self measureBlock:^{
+    // Given
+    MDCChipField *field = [[MDCChipField alloc] initWithFrame:CGRectMake(0, 0, 320, 400)];
+
+    // When
+    for (NSUInteger i = 0; i < kIncrementallyAddedChipCount; ++i) {
+      NSString *title = [NSString stringWithFormat:@"Chip %lu", (unsigned long)i];
+      [field addChip:[self chipWithTitle:title]];
+      [field layoutIfNeeded];
+    }
+
+    // Then
+    XCTAssertEqual(field.chips.count, kIncrementallyAddedChipCount);
+  }];
+}
+
 - (void)testChipViewDynamicTypeBehavior {
   if (@available(iOS 10.0, *)) {
     // Given
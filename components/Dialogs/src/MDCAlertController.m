@@ -185,6 +185,7 @@ static NSString *const kMaterialDialogsBundle = @"MaterialDialogs.bundle";
 }
 
 - (void)setAccessoryViewNeedsLayout {
+  [self.alertView invalidateLayoutCache];
   [self.alertView setNeedsLayout];
   self.preferredContentSize =
       [self.alertView calculatePreferredContentSizeForBounds:CGRectInfinite.size];
@@ -405,6 +406,7 @@ static NSString *const kMaterialDialogsBundle = @"MaterialDialogs.bundle";
       [self.alertView calculatePreferredContentSizeForBounds:CGRectInfinite.size];
 
   [self.view setNeedsLayout];
+  [self.view mdc_elevationHierarchyDidChange];
 
   NSString *key =
       kMaterialDialogsStringTable[kStr_MaterialDialogsPresentedAccessibilityAnnouncement];
@@ -526,6 +528,12 @@ static NSString *const kMaterialDialogsBundle = @"MaterialDialogs.bundle";
                       completion:nil];
 }
 
+- (void)viewWillAppear:(BOOL)animated {
+  [super viewWillAppear:animated];
+
+  [self.view mdc_elevationHierarchyDidChange];
+}
+
 - (void)viewDidAppear:(BOOL)animated {
   [super viewDidAppear:animated];
 
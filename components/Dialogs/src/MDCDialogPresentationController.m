@@ -360,35 +360,14 @@ static UIEdgeInsets MDCDialogEdgeInsets = {24, 20, 24, 20};
 - (void)registerKeyboardNotifications {
   [[NSNotificationCenter defaultCenter] addObserver:self
                                            selector:@selector(keyboardWatcherHandler:)
-                                               name:MDCKeyboardWatcherKeyboardWillShowNotification
+                                               name:MDCKeyboardWatcherKeyboardWillUpdateNotification
                                              object:nil];
-
-  [[NSNotificationCenter defaultCenter] addObserver:self
-                                           selector:@selector(keyboardWatcherHandler:)
-                                               name:MDCKeyboardWatcherKeyboardWillHideNotification
-                                             object:nil];
-
-  [[NSNotificationCenter defaultCenter]
-      addObserver:self
-         selector:@selector(keyboardWatcherHandler:)
-             name:MDCKeyboardWatcherKeyboardWillChangeFrameNotification
-           object:nil];
 }
 
 - (void)unregisterKeyboardNotifications {
   [[NSNotificationCenter defaultCenter]
       removeObserver:self
-                name:MDCKeyboardWatcherKeyboardWillShowNotification
-              object:nil];
-
-  [[NSNotificationCenter defaultCenter]
-      removeObserver:self
-                name:MDCKeyboardWatcherKeyboardWillHideNotification
-              object:nil];
-
-  [[NSNotificationCenter defaultCenter]
-      removeObserver:self
-                name:MDCKeyboardWatcherKeyboardWillChangeFrameNotification
+                name:MDCKeyboardWatcherKeyboardWillUpdateNotification
               object:nil];
 }
 
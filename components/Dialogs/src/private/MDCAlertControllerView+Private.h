@@ -40,6 +40,15 @@
 
 - (CGSize)calculateActionsSizeThatFitsWidth:(CGFloat)boundingWidth;
 
+/**
+ Discards the cached measurements of the title, message, accessory view and action buttons.
+
+ The cache is keyed on the bounding width, the title and message text and fonts, the title icon,
+ the accessory view, the action buttons and the preferred content size category, so it only needs
+ to be invalidated explicitly when the content of the accessory view changes.
+ */
+- (void)invalidateLayoutCache;
+
 - (void)updateFonts;
 
 /**
@@ -41,6 +41,34 @@ static const CGFloat MDCDialogActionMinTouchTarget = 48;
 
 static const CGFloat MDCDialogMessageOpacity = (CGFloat)0.54;
 
+// Sizing at the preferred width and layout at the presented width are the only two widths a
+// presentation asks for, so older measurements are dropped once more than two are cached.
+static const NSUInteger MDCDialogMaximumCachedContentLayoutCount = 2;
+
+/** The measured sizes of the title icon, title, message and accessory view at one width. */
+@interface MDCAlertControllerContentLayout : NSObject
+
+/** The width the content was measured in, not including the content insets. */
+@property(nonatomic, assign) CGFloat boundingWidth;
+
+@property(nonatomic, assign) CGSize titleIconSize;
+@property(nonatomic, assign) CGSize titleSize;
+@property(nonatomic, assign) CGSize messageSize;
+
+/** The compressed size of the accessory view, used to size the alert. */
+@property(nonatomic, assign) CGSize accessoryViewFittingSize;
+
+/** The size of the accessory view when it fills the bounding width, used to lay it out. */
+@property(nonatomic, assign) CGSize accessoryViewSize;
+
+/** The size of the content area, including the content insets. */
+@property(nonatomic, assign) CGSize contentSize;
+
+@end
+
+@implementation MDCAlertControllerContentLayout
+@end
+
 @interface MDCAlertControllerView ()
 
 @property(nonatomic, getter=isVerticalActionsLayout) BOOL verticalActionsLayout;
@@ -49,6 +77,22 @@ static const CGFloat MDCDialogMessageOpacity = (CGFloat)0.54;
 
 @implementation MDCAlertControllerView {
   BOOL _mdc_adjustsFontForContentSizeCategory;
+
+  // The content the cached measurements below were taken from.
+  BOOL _layoutCacheIsValid;
+  NSString *_cachedTitle;
+  NSString *_cachedMessage;
+  UIFont *_cachedTitleFont;
+  UIFont *_cachedMessageFont;
+  UIImage *_cachedTitleIcon;
+  UIView *_cachedAccessoryView;
+  NSArray<MDCButton *> *_cachedButtons;
+  NSArray<NSArray *> *_cachedButtonMeasurementKeys;
+  NSString *_cachedContentSizeCategory;
+
+  // The cached measurements, most recently used last.
+  NSMutableArray<MDCAlertControllerContentLayout *> *_cachedContentLayouts;
+  NSArray<NSValue *> *_cachedButtonSizes;
 }
 
 @dynamic titleAlignment;
@@ -91,6 +135,8 @@ static const CGFloat MDCDialogMessageOpacity = (CGFloat)0.54;
     self.messageLabel.textColor = [UIColor colorWithWhite:0 alpha:MDCDialogMessageOpacity];
     [self.contentScrollView addSubview:self.messageLabel];
 
+    _cachedContentLayouts = [NSMutableArray array];
+
     [self setNeedsLayout];
   }
 
@@ -302,6 +348,7 @@ static const CGFloat MDCDialogMessageOpacity = (CGFloat)0.54;
     [button setTitleFont:finalButtonFont forState:UIControlStateNormal];
   }
 
+  [self invalidateLayoutCache];
   [self setNeedsLayout];
 }
 
@@ -353,65 +400,103 @@ static const CGFloat MDCDialogMessageOpacity = (CGFloat)0.54;
 
 #pragma mark - Internal
 
-- (CGSize)actionButtonsSizeInHorizontalLayout {
-  CGSize size = CGSizeZero;
+- (void)invalidateLayoutCache {
+  _layoutCacheIsValid = NO;
+}
+
+- (nullable NSString *)currentContentSizeCategory {
+  if (@available(iOS 10.0, *)) {
+    return self.traitCollection.preferredContentSizeCategory;
+  }
+  return nil;
+}
+
+// Drops the cached measurements that were taken from content that has since changed.
+- (void)validateLayoutCache {
+  NSString *title = self.titleLabel.text;
+  NSString *message = self.messageLabel.text;
+  UIFont *titleFont = self.titleLabel.font;
+  UIFont *messageFont = self.messageLabel.font;
+  UIImage *titleIcon = self.titleIconImageView.image;
   NSArray<MDCButton *> *buttons = self.actionManager.buttonsInActionOrder;
-  if (0 < [buttons count]) {
-    CGFloat maxButtonHeight = MDCDialogActionButtonMinimumHeight;
-    size.width = MDCDialogActionsInsets.left + MDCDialogActionsInsets.right;
-    for (UIButton *button in buttons) {
-      CGSize buttonSize = [button sizeThatFits:size];
-      size.width += buttonSize.width;
-      maxButtonHeight = MAX(maxButtonHeight, buttonSize.height);
-      if (button != [buttons lastObject]) {
-        size.width += MDCDialogActionsHorizontalPadding;
-      }
-    }
-    size.height = MDCDialogActionsInsets.top + maxButtonHeight + MDCDialogActionsInsets.bottom;
+  NSString *contentSizeCategory = [self currentContentSizeCategory];
+
+  if (!_layoutCacheIsValid || !(_cachedContentSizeCategory == contentSizeCategory ||
+                                [_cachedContentSizeCategory isEqualToString:contentSizeCategory])) {
+    _cachedContentSizeCategory = [contentSizeCategory copy];
+    [_cachedContentLayouts removeAllObjects];
+    _cachedButtonSizes = nil;
+    _layoutCacheIsValid = YES;
+  }
+
+  if (!(_cachedTitle == title || [_cachedTitle isEqualToString:title]) ||
+      !(_cachedMessage == message || [_cachedMessage isEqualToString:message]) ||
+      ![_cachedTitleFont isEqual:titleFont] || ![_cachedMessageFont isEqual:messageFont] ||
+      _cachedTitleIcon != titleIcon || _cachedAccessoryView != self.accessoryView) {
+    _cachedTitle = [title copy];
+    _cachedMessage = [message copy];
+    _cachedTitleFont = titleFont;
+    _cachedMessageFont = messageFont;
+    _cachedTitleIcon = titleIcon;
+    _cachedAccessoryView = self.accessoryView;
+    [_cachedContentLayouts removeAllObjects];
+  }
+
+  // Themers restyle the buttons after the view loads, so the buttons' own measurement inputs are
+  // part of the key, not only the set of buttons.
+  NSMutableArray<NSArray *> *buttonMeasurementKeys =
+      [NSMutableArray arrayWithCapacity:buttons.count];
+  for (MDCButton *button in buttons) {
+    [buttonMeasurementKeys addObject:[self measurementKeyForButton:button]];
   }
+  if (!(_cachedButtons == buttons || [_cachedButtons isEqualToArray:buttons]) ||
+      ![_cachedButtonMeasurementKeys isEqualToArray:buttonMeasurementKeys]) {
+    _cachedButtons = [buttons copy];
+    _cachedButtonMeasurementKeys = [buttonMeasurementKeys copy];
+    _cachedButtonSizes = nil;
+  }
+}
 
-  return size;
+// The properties of @c button that its size depends on.
+- (NSArray *)measurementKeyForButton:(MDCButton *)button {
+  return @[
+    button.currentTitle ?: [NSNull null],
+    button.titleLabel.font ?: [NSNull null],
+    button.currentImage ?: [NSNull null],
+    [NSValue valueWithUIEdgeInsets:button.contentEdgeInsets],
+    [NSValue valueWithUIEdgeInsets:button.titleEdgeInsets],
+    [NSValue valueWithUIEdgeInsets:button.imageEdgeInsets],
+    [NSValue valueWithCGSize:button.minimumSize],
+    [NSValue valueWithCGSize:button.maximumSize],
+  ];
 }
 
-- (CGSize)actionButtonsSizeInVerticalLayout {
-  CGSize size = CGSizeZero;
-  NSArray<MDCButton *> *buttons = self.actionManager.buttonsInActionOrder;
-  if (0 < [buttons count]) {
-    size.height = MDCDialogActionsInsets.top + MDCDialogActionsInsets.bottom;
-    size.width = MDCDialogActionsInsets.left + MDCDialogActionsInsets.right;
-    for (UIButton *button in buttons) {
-      CGSize buttonSize = [button sizeThatFits:size];
-      buttonSize.height = MAX(buttonSize.height, MDCDialogActionButtonMinimumHeight);
-      size.height += buttonSize.height;
-      size.width = MAX(size.width, buttonSize.width);
-      if (button != [buttons lastObject]) {
-        size.height += MDCDialogActionsVerticalPadding;
+// @param boundingWidth should not include any internal margins or padding
+- (MDCAlertControllerContentLayout *)contentLayoutForBoundingWidth:(CGFloat)boundingWidth {
+  [self validateLayoutCache];
+
+  for (MDCAlertControllerContentLayout *layout in _cachedContentLayouts) {
+    if (MDCCGFloatEqual(layout.boundingWidth, boundingWidth)) {
+      if (layout != _cachedContentLayouts.lastObject) {
+        [_cachedContentLayouts removeObject:layout];
+        [_cachedContentLayouts addObject:layout];
       }
+      return layout;
     }
   }
 
-  return size;
+  MDCAlertControllerContentLayout *layout = [self measureContentForBoundingWidth:boundingWidth];
+  if (_cachedContentLayouts.count == MDCDialogMaximumCachedContentLayoutCount) {
+    [_cachedContentLayouts removeObjectAtIndex:0];
+  }
+  [_cachedContentLayouts addObject:layout];
+  return layout;
 }
 
-// @param boundsSize should not include any internal margins or padding
-- (CGSize)calculatePreferredContentSizeForBounds:(CGSize)boundsSize {
-  // Even if we have more room, limit our maximum width
-  boundsSize.width = MIN(boundsSize.width, MDCDialogMaximumWidth);
-
-  // Content & Actions
-  CGSize contentSize = [self calculateContentSizeThatFitsWidth:boundsSize.width];
-  CGSize actionSize = [self calculateActionsSizeThatFitsWidth:boundsSize.width];
+- (MDCAlertControllerContentLayout *)measureContentForBoundingWidth:(CGFloat)boundingWidth {
+  MDCAlertControllerContentLayout *layout = [[MDCAlertControllerContentLayout alloc] init];
+  layout.boundingWidth = boundingWidth;
 
-  // Final Sizing
-  CGSize totalSize;
-  totalSize.width = MAX(contentSize.width, actionSize.width);
-  totalSize.height = contentSize.height + actionSize.height;
-
-  return totalSize;
-}
-
-// @param boundingWidth should not include any internal margins or padding
-- (CGSize)calculateContentSizeThatFitsWidth:(CGFloat)boundingWidth {
   CGSize boundsSize = CGRectInfinite.size;
   boundsSize.width = boundingWidth - MDCDialogContentInsets.left - MDCDialogContentInsets.right;
 
@@ -421,13 +506,21 @@ static const CGFloat MDCDialogMessageOpacity = (CGFloat)0.54;
     // https://github.com/material-components/material-components-ios/issues/5198 is resolved.
     titleIconSize = self.titleIconImageView.image.size;
   }
+  layout.titleIconSize = titleIconSize;
   BOOL hasTitleIcon = (0.0 < titleIconSize.height);
 
   CGSize titleSize = [self.titleLabel sizeThatFits:boundsSize];
+  layout.titleSize = titleSize;
   BOOL hasTitle = (0.0 < titleSize.height);
   CGSize messageSize = [self.messageLabel sizeThatFits:boundsSize];
+  layout.messageSize = messageSize;
   BOOL hasMessage = (0.0 < messageSize.height);
   CGSize accessoryViewSize = [self.accessoryView systemLayoutSizeFittingSize:boundsSize];
+  layout.accessoryViewFittingSize = accessoryViewSize;
+  layout.accessoryViewSize =
+      [self.accessoryView systemLayoutSizeFittingSize:boundsSize
+                        withHorizontalFittingPriority:UILayoutPriorityRequired
+                              verticalFittingPriority:UILayoutPriorityFittingSizeLevel];
   BOOL hasAccessory = (0.0 < accessoryViewSize.height);
 
   CGFloat contentWidth = MAX(MAX(titleSize.width, messageSize.width), accessoryViewSize.width);
@@ -453,8 +546,83 @@ static const CGFloat MDCDialogMessageOpacity = (CGFloat)0.54;
   CGSize contentSize;
   contentSize.width = (CGFloat)ceil(contentWidth);
   contentSize.height = (CGFloat)ceil(contentHeight);
+  layout.contentSize = contentSize;
+
+  return layout;
+}
+
+// The size each action button wants, in action order. Buttons size to their title alone, so the
+// sizes do not depend on the width of the alert.
+- (NSArray<NSValue *> *)actionButtonSizes {
+  [self validateLayoutCache];
+
+  if (_cachedButtonSizes == nil) {
+    NSMutableArray<NSValue *> *buttonSizes = [NSMutableArray array];
+    for (MDCButton *button in _cachedButtons) {
+      CGSize buttonSize = [button sizeThatFits:CGRectInfinite.size];
+      [buttonSizes addObject:[NSValue valueWithCGSize:buttonSize]];
+    }
+    _cachedButtonSizes = [buttonSizes copy];
+  }
+  return _cachedButtonSizes;
+}
+
+- (CGSize)actionButtonsSizeInHorizontalLayout {
+  CGSize size = CGSizeZero;
+  NSArray<NSValue *> *buttonSizes = [self actionButtonSizes];
+  if (0 < [buttonSizes count]) {
+    CGFloat maxButtonHeight = MDCDialogActionButtonMinimumHeight;
+    size.width = MDCDialogActionsInsets.left + MDCDialogActionsInsets.right;
+    for (NSValue *buttonSizeValue in buttonSizes) {
+      CGSize buttonSize = buttonSizeValue.CGSizeValue;
+      size.width += buttonSize.width;
+      maxButtonHeight = MAX(maxButtonHeight, buttonSize.height);
+    }
+    size.width += MDCDialogActionsHorizontalPadding * (buttonSizes.count - 1);
+    size.height = MDCDialogActionsInsets.top + maxButtonHeight + MDCDialogActionsInsets.bottom;
+  }
 
-  return contentSize;
+  return size;
+}
+
+- (CGSize)actionButtonsSizeInVerticalLayout {
+  CGSize size = CGSizeZero;
+  NSArray<NSValue *> *buttonSizes = [self actionButtonSizes];
+  if (0 < [buttonSizes count]) {
+    size.height = MDCDialogActionsInsets.top + MDCDialogActionsInsets.bottom;
+    size.width = MDCDialogActionsInsets.left + MDCDialogActionsInsets.right;
+    for (NSValue *buttonSizeValue in buttonSizes) {
+      CGSize buttonSize = buttonSizeValue.CGSizeValue;
+      buttonSize.height = MAX(buttonSize.height, MDCDialogActionButtonMinimumHeight);
+      size.height += buttonSize.height;
+      size.width = MAX(size.width, buttonSize.width);
+    }
+    size.height += MDCDialogActionsVerticalPadding * (buttonSizes.count - 1);
+  }
+
+  return size;
+}
+
+// @param boundsSize should not include any internal margins or padding
+- (CGSize)calculatePreferredContentSizeForBounds:(CGSize)boundsSize {
+  // Even if we have more room, limit our maximum width
+  boundsSize.width = MIN(boundsSize.width, MDCDialogMaximumWidth);
+
+  // Content & Actions
+  CGSize contentSize = [self calculateContentSizeThatFitsWidth:boundsSize.width];
+  CGSize actionSize = [self calculateActionsSizeThatFitsWidth:boundsSize.width];
+
+  // Final Sizing
+  CGSize totalSize;
+  totalSize.width = MAX(contentSize.width, actionSize.width);
+  totalSize.height = contentSize.height + actionSize.height;
+
+  return totalSize;
+}
+
+// @param boundingWidth should not include any internal margins or padding
+- (CGSize)calculateContentSizeThatFitsWidth:(CGFloat)boundingWidth {
+  return [self contentLayoutForBoundingWidth:boundingWidth].contentSize;
 }
 
 // @param boundingWidth should not include any internal margins or padding
@@ -488,10 +656,12 @@ static const CGFloat MDCDialogMessageOpacity = (CGFloat)0.54;
   [super layoutSubviews];
 
   NSArray<MDCButton *> *buttons = self.actionManager.buttonsInActionOrder;
+  NSArray<NSValue *> *buttonSizes = [self actionButtonSizes];
 
-  for (MDCButton *button in buttons) {
-    [button sizeToFit];
+  for (NSUInteger index = 0; index < buttons.count; ++index) {
+    MDCButton *button = buttons[index];
     CGRect buttonFrame = button.frame;
+    buttonFrame.size = buttonSizes[index].CGSizeValue;
     buttonFrame.size.width = MAX(CGRectGetWidth(buttonFrame), MDCDialogActionButtonMinimumWidth);
     buttonFrame.size.height = MAX(CGRectGetHeight(buttonFrame), MDCDialogActionButtonMinimumHeight);
     button.frame = buttonFrame;
@@ -508,7 +678,9 @@ static const CGFloat MDCDialogMessageOpacity = (CGFloat)0.54;
   boundsSize.width = CGRectGetWidth(self.bounds);
 
   // Content
-  CGSize contentSize = [self calculateContentSizeThatFitsWidth:boundsSize.width];
+  MDCAlertControllerContentLayout *contentLayout =
+      [self contentLayoutForBoundingWidth:boundsSize.width];
+  CGSize contentSize = contentLayout.contentSize;
 
   CGRect contentRect = CGRectZero;
   contentRect.size.width = CGRectGetWidth(self.bounds);
@@ -518,26 +690,18 @@ static const CGFloat MDCDialogMessageOpacity = (CGFloat)0.54;
 
   // Place Content in contentScrollView
   boundsSize.width = boundsSize.width - MDCDialogContentInsets.left - MDCDialogContentInsets.right;
-  CGSize titleSize = [self.titleLabel sizeThatFits:boundsSize];
+  CGSize titleSize = contentLayout.titleSize;
   titleSize.width = boundsSize.width;
   BOOL hasTitle = (0.0 < titleSize.height);
 
-  CGSize titleIconSize = CGSizeZero;
-  if (self.titleIconImageView != nil) {
-    // TODO(galiak): Have title-icon size respond to dynamic type or device screen size, once this:
-    // https://github.com/material-components/material-components-ios/issues/5198 is resolved.
-    titleIconSize = self.titleIconImageView.image.size;
-  }
+  CGSize titleIconSize = contentLayout.titleIconSize;
   BOOL hasTitleIcon = (0.0 < titleIconSize.height);
 
-  CGSize messageSize = [self.messageLabel sizeThatFits:boundsSize];
+  CGSize messageSize = contentLayout.messageSize;
   messageSize.width = boundsSize.width;
   BOOL hasMessage = (0.0 < messageSize.height);
 
-  CGSize accessoryViewSize =
-      [self.accessoryView systemLayoutSizeFittingSize:boundsSize
-                        withHorizontalFittingPriority:UILayoutPriorityRequired
-                              verticalFittingPriority:UILayoutPriorityFittingSizeLevel];
+  CGSize accessoryViewSize = contentLayout.accessoryViewSize;
   accessoryViewSize.width = boundsSize.width;
   BOOL hasAccessory = (0.0 < accessoryViewSize.height);
 
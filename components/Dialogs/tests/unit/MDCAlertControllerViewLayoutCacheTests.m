@@ -0,0 +1,192 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MaterialContainerScheme.h"
+#import "MaterialDialogs+Theming.h"
+#import "MaterialDialogs.h"
+
+#import "MDCAlertController+ButtonForAction.h"
+#import "MDCAlertControllerView+Private.h"
+
+#import <XCTest/XCTest.h>
+
+static const CGFloat kAlertWidth = 280;
+static const CGFloat kAlertHeight = 480;
+
+/** Counts how many times its text is measured. */
+@interface MDCAlertControllerViewCountingLabel : UILabel
+@property(nonatomic, assign) NSUInteger measurementCount;
+@end
+
+@implementation MDCAlertControllerViewCountingLabel
+
+- (CGSize)sizeThatFits:(CGSize)size {
+  self.measurementCount += 1;
+  return [super sizeThatFits:size];
+}
+
+@end
+
+@interface MDCAlertControllerViewLayoutCacheTests : XCTestCase
+@property(nonatomic, strong, nullable) MDCAlertController *alertController;
+@property(nonatomic, strong, nullable) MDCAlertControllerView *alertView;
+@property(nonatomic, strong, nullable) MDCAlertControllerViewCountingLabel *messageLabel;
+@end
+
+@implementation MDCAlertControllerViewLayoutCacheTests
+
+- (void)setUp {
+  [super setUp];
+
+  NSMutableString *longMessage = [NSMutableString string];
+  for (NSUInteger sentence = 0; sentence < 50; ++sentence) {
+    [longMessage appendString:@"This sentence makes the message of the alert long. "];
+  }
+  self.alertController = [MDCAlertController alertControllerWithTitle:@"Title" message:nil];
+  [self.alertController addAction:[MDCAlertAction actionWithTitle:@"OK" handler:nil]];
+  [self.alertController addAction:[MDCAlertAction actionWithTitle:@"Cancel" handler:nil]];
+  self.alertView = (MDCAlertControllerView *)self.alertController.view;
+
+  // Replace the message label with one that counts its measurements.
+  self.messageLabel = [[MDCAlertControllerViewCountingLabel alloc] initWithFrame:CGRectZero];
+  self.messageLabel.numberOfLines = 0;
+  self.messageLabel.font = self.alertView.messageLabel.font;
+  [self.alertView.messageLabel removeFromSuperview];
+  self.alertView.messageLabel = self.messageLabel;
+  [self.alertView.contentScrollView addSubview:self.messageLabel];
+  self.alertController.message = longMessage;
+  [self.alertView invalidateLayoutCache];
+  self.messageLabel.measurementCount = 0;
+}
+
+- (void)tearDown {
+  self.messageLabel = nil;
+  self.alertView = nil;
+  self.alertController = nil;
+
+  [super tearDown];
+}
+
+/** Sizes and lays out the alert the way a presentation at @c kAlertWidth does. */
+- (CGSize)presentAlertView {
+  CGSize preferredSize =
+      [self.alertView calculatePreferredContentSizeForBounds:CGSizeMake(kAlertWidth, kAlertHeight)];
+  self.alertView.frame = CGRectMake(0, 0, kAlertWidth, MIN(preferredSize.height, kAlertHeight));
+  [self.alertView setNeedsLayout];
+  [self.alertView layoutIfNeeded];
+  return [self.alertView calculatePreferredContentSizeForBounds:self.alertView.bounds.size];
+}
+
+- (void)testPresentingMeasuresTheMessageOnce {
+  // When
+  [self presentAlertView];
+  [self.alertView setNeedsLayout];
+  [self.alertView layoutIfNeeded];
+
+  // Then
+  XCTAssertEqual(self.messageLabel.measurementCount, 1U);
+  XCTAssertEqualWithAccuracy(CGRectGetWidth(self.messageLabel.frame), kAlertWidth - 48, 0.001);
+  XCTAssertGreaterThan(CGRectGetHeight(self.messageLabel.frame), 0);
+}
+
+- (void)testMeasurementsAreCachedPerWidth {
+  // When
+  for (NSUInteger pass = 0; pass < 3; ++pass) {
+    [self.alertView calculatePreferredContentSizeForBounds:CGRectInfinite.size];
+    [self presentAlertView];
+  }
+
+  // Then
+  XCTAssertEqual(self.messageLabel.measurementCount, 2U);
+}
+
+- (void)testCachedLayoutMatchesAFreshLayout {
+  // Given
+  CGSize cachedSize = [self presentAlertView];
+  CGRect cachedMessageFrame = self.messageLabel.frame;
+
+  // When
+  [self.alertView invalidateLayoutCache];
+  CGSize freshSize = [self presentAlertView];
+
+  // Then
+  XCTAssertTrue(CGSizeEqualToSize(cachedSize, freshSize));
+  XCTAssertTrue(CGRectEqualToRect(cachedMessageFrame, self.messageLabel.frame));
+  XCTAssertEqual(self.messageLabel.measurementCount, 2U);
+}
+
+- (void)testChangingTheMessageRemeasuresIt {
+  // Given
+  CGSize longMessageSize = [self presentAlertView];
+
+  // When
+  self.alertView.message = @"Short message.";
+  CGSize shortMessageSize = [self presentAlertView];
+
+  // Then
+  XCTAssertLessThan(shortMessageSize.height, longMessageSize.height);
+  XCTAssertEqual(self.messageLabel.measurementCount, 2U);
+}
+
+- (void)testChangingTheMessageFontRemeasuresIt {
+  // Given
+  CGSize smallFontSize = [self presentAlertView];
+
+  // When
+  self.alertView.messageFont = [UIFont systemFontOfSize:24];
+  CGSize largeFontSize = [self presentAlertView];
+
+  // Then
+  XCTAssertGreaterThan(largeFontSize.height, smallFontSize.height);
+  XCTAssertEqual(self.messageLabel.measurementCount, 2U);
+}
+
+- (void)testAddingAnActionKeepsTheMessageMeasurements {
+  // Given
+  [self.alertView calculatePreferredContentSizeForBounds:CGRectInfinite.size];
+  CGSize twoActionSize = [self presentAlertView];
+
+  // When
+  MDCAlertAction *longAction = [MDCAlertAction actionWithTitle:@"Try again on a different network"
+                                                       handler:nil];
+  [self.alertController addAction:longAction];
+  CGSize threeActionSize = [self presentAlertView];
+
+  // Then
+  XCTAssertEqual(self.messageLabel.measurementCount, 2U);
+  XCTAssertGreaterThan(threeActionSize.height, twoActionSize.height);
+}
+
+- (void)testThemingTheButtonsAfterLoadingRemeasuresThem {
+  // Given
+  MDCAlertAction *longAction = [MDCAlertAction actionWithTitle:@"Try again later" handler:nil];
+  [self.alertController addAction:longAction];
+  [self presentAlertView];
+  MDCButton *button = [self.alertController buttonForAction:longAction];
+  CGFloat unthemedWidth = CGRectGetWidth(button.frame);
+  MDCContainerScheme *scheme = [[MDCContainerScheme alloc] init];
+  scheme.typographyScheme.button = [UIFont systemFontOfSize:30];
+
+  // When
+  [self.alertController applyThemeWithScheme:scheme];
+  [self presentAlertView];
+
+  // Then
+  CGSize themedSize = [button sizeThatFits:CGRectInfinite.size];
+  XCTAssertGreaterThan(CGRectGetWidth(button.frame), unthemedWidth);
+  XCTAssertEqualWithAccuracy(CGRectGetWidth(button.frame), themedSize.width, 0.001);
+  XCTAssertEqualWithAccuracy(CGRectGetHeight(button.frame), themedSize.height, 0.001);
+}
+
+@end
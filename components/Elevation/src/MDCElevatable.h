@@ -17,6 +17,10 @@
 
 /**
  Provides APIs for @c UIViews to communicate their elevation throughout the view hierarchy.
+
+ Conforming views and view controllers must call @c -mdc_elevationHierarchyDidChange as described
+ in UIView+MaterialElevationResponding.h for @c mdc_elevationDidChangeBlock to be called when the
+ elevation of an ancestor changes.
  */
 @protocol MDCElevatable <NSObject>
 
@@ -27,9 +27,26 @@
  Negative elevation is treated as 0.
  Pattern-based UIColor is not supported.
  @param elevation The @c mdc_absoluteElevation value to use when resolving the color.
+
+ Resolved colors are memoized on the color's components and the elevation, so resolving the same
+ surface color at the same elevation again returns the same instance without blending.
  */
 - (nonnull UIColor *)mdc_resolvedColorWithElevation:(CGFloat)elevation;
 
+/**
+ Returns the colors that take each of the specified elevation values into account, in the same
+ order. Equivalent to calling @c mdc_resolvedColorWithElevation: for each elevation, but reads the
+ color's components once.
+
+ Use this to resolve a surface color for all the elevations a theme uses at once, e.g. when the
+ user interface style changes.
+ Negative elevation is treated as 0.
+ Pattern-based UIColor is not supported.
+ @param elevations The @c mdc_absoluteElevation values to use when resolving the colors.
+ */
+- (nonnull NSArray<UIColor *> *)mdc_resolvedColorsWithElevations:
+    (nonnull NSArray<NSNumber *> *)elevations;
+
 /**
  Returns a color that takes the specified elevation value and traits into account when there is a
  color appearance difference between current traits and previous traits. When userInterfaceStyle is
@@ -16,8 +16,60 @@
 
 #import <CoreGraphics/CoreGraphics.h>
 
+#import "MDCColorBlending.h"
 #import "MaterialMath.h"
-#import "UIColor+MaterialBlending.h"
+#import "UIColor+MaterialDynamic.h"
+
+// Elevations are rounded to this fraction of a point before resolving, so that elevations that
+// only differ by floating point noise share a memoized color. The resulting difference in overlay
+// alpha is well below what an 8-bit display can show.
+static const CGFloat kElevationQuantum = (CGFloat)1 / 256;
+
+// The number of resolved colors kept. A theme typically elevates a handful of surface colors to a
+// handful of elevations.
+static const NSUInteger kResolvedColorCacheCountLimit = 256;
+
+/** The inputs that fully determine a color resolved with elevation. */
+typedef struct {
+  CGFloat red;
+  CGFloat green;
+  CGFloat blue;
+  CGFloat alpha;
+  NSInteger quantizedElevation;
+} MDCElevationResolvedColorKey;
+
+/** Returns the memo table of colors resolved with elevation, keyed on an NSValue-wrapped key. */
+static NSCache<NSValue *, UIColor *> *MDCElevationResolvedColorCache(void) {
+  static NSCache<NSValue *, UIColor *> *cache;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    cache = [[NSCache alloc] init];
+    cache.countLimit = kResolvedColorCacheCountLimit;
+  });
+  return cache;
+}
+
+/** Returns the alpha of the white elevation overlay for @c elevation, from 0 to 1. */
+static CGFloat MDCElevationOverlayAlpha(CGFloat elevation) {
+  CGFloat alphaValue = 0;
+  if (!MDCCGFloatEqual(elevation, 0)) {
+    if (elevation < 1) {
+      // A formula for values between 0 to 1 is used here to simulate the alpha percentage
+      // as in the main formula below there is a jump between any number larger than 0 to an
+      // alpha value of 2. This formula provides a gradual polynomial curve that makes the delta
+      // of the alpha value between lower numbers to be smaller than the higher numbers.
+      // AlphaValue = 5.11916 * elevationValue ^ 2
+      alphaValue = (CGFloat)5.11916 * MDCPow((CGFloat)elevation, 2);
+    } else {
+      // A formula is used here to simulate the alpha percentage stated on
+      // https://material.io/design/color/dark-theme.html#properties
+      // AlphaValue = 4.5 * ln (elevationValue + 1) + 2
+      // Note: Both formulas meet at the transition point of (1, 5.11916).
+      alphaValue = (CGFloat)4.5 * (CGFloat)log(elevation + 1) + 2;
+    }
+  }
+  return alphaValue * (CGFloat)0.01;
+}
 
 @implementation UIColor (MaterialElevation)
 
@@ -39,7 +91,7 @@
                                         elevation:(CGFloat)elevation {
 #if defined(__IPHONE_13_0) && (__IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_13_0)
   if (@available(iOS 13.0, *)) {
-    UIColor *resolvedColor = [self resolvedColorWithTraitCollection:traitCollection];
+    UIColor *resolvedColor = [self mdc_resolvedColorWithTraitCollection:traitCollection];
     if (traitCollection.userInterfaceStyle == UIUserInterfaceStyleDark) {
       return [resolvedColor mdc_resolvedColorWithElevation:elevation];
     } else {
@@ -56,29 +108,57 @@
                 format:@"Pattern-based colors are not supported by %@", NSStringFromSelector(_cmd)];
   }
 
-  UIColor *overlayColor = UIColor.whiteColor;
+  MDCElevationResolvedColorKey key = {0};
+  [self getRed:&key.red green:&key.green blue:&key.blue alpha:&key.alpha];
+  return [self mdc_resolvedColorWithKey:key elevation:elevation];
+}
+
+- (NSArray<UIColor *> *)mdc_resolvedColorsWithElevations:(NSArray<NSNumber *> *)elevations {
+  if (CGColorGetPattern(self.CGColor)) {
+    [NSException raise:NSGenericException
+                format:@"Pattern-based colors are not supported by %@", NSStringFromSelector(_cmd)];
+  }
+
+  MDCElevationResolvedColorKey key = {0};
+  [self getRed:&key.red green:&key.green blue:&key.blue alpha:&key.alpha];
+  NSMutableArray<UIColor *> *resolvedColors = [NSMutableArray arrayWithCapacity:elevations.count];
+  for (NSNumber *elevation in elevations) {
+    [resolvedColors addObject:[self mdc_resolvedColorWithKey:key
+                                                   elevation:(CGFloat)elevation.doubleValue]];
+  }
+  return resolvedColors;
+}
+
+/**
+ Returns the memoized color for the receiver at @c elevation, blending it on a miss.
+
+ @param key The receiver's components. Its elevation is filled in by this method.
+ */
+- (UIColor *)mdc_resolvedColorWithKey:(MDCElevationResolvedColorKey)key
+                            elevation:(CGFloat)elevation {
   elevation = MAX(elevation, 0);
-  CGFloat alphaValue = 0;
-  if (!MDCCGFloatEqual(elevation, 0)) {
-    if (elevation < 1) {
-      // A formula for values between 0 to 1 is used here to simulate the alpha percentage
-      // as in the main formula below there is a jump between any number larger than 0 to an
-      // alpha value of 2. This formula provides a gradual polynomial curve that makes the delta
-      // of the alpha value between lower numbers to be smaller than the higher numbers.
-      // AlphaValue = 5.11916 * elevationValue ^ 2
-      alphaValue = (CGFloat)5.11916 * MDCPow((CGFloat)elevation, 2);
-    } else {
-      // A formula is used here to simulate the alpha percentage stated on
-      // https://material.io/design/color/dark-theme.html#properties
-      // AlphaValue = 4.5 * ln (elevationValue + 1) + 2
-      // Note: Both formulas meet at the transition point of (1, 5.11916).
-      alphaValue = (CGFloat)4.5 * (CGFloat)log(elevation + 1) + 2;
-    }
+  key.quantizedElevation = (NSInteger)MDCRound(elevation / kElevationQuantum);
+  NSValue *keyValue = [NSValue valueWithBytes:&key objCType:@encode(MDCElevationResolvedColorKey)];
+
+  NSCache<NSValue *, UIColor *> *cache = MDCElevationResolvedColorCache();
+  UIColor *resolvedColor = [cache objectForKey:keyValue];
+  if (resolvedColor == nil) {
+    CGFloat overlayAlpha = MDCElevationOverlayAlpha(key.quantizedElevation * kElevationQuantum);
+    MDCPremultipliedRGBA overlay = MDCPremultipliedRGBAMake(1, 1, 1, overlayAlpha);
+    MDCPremultipliedRGBA surface =
+        MDCPremultipliedRGBAMake(key.red, key.green, key.blue, key.alpha);
+    double red = 0.0, green = 0.0, blue = 0.0, alpha = 0.0;
+    MDCPremultipliedRGBAGetComponents(MDCPremultipliedRGBABlend(overlay, surface), &red, &green,
+                                      &blue, &alpha);
+    // TODO (https://github.com/material-components/material-components-ios/issues/8096):
+    // Grayscale color should be returned if color space is UIExtendedGrayColorSpace.
+    resolvedColor = [UIColor colorWithRed:(CGFloat)red
+                                    green:(CGFloat)green
+                                     blue:(CGFloat)blue
+                                    alpha:(CGFloat)alpha];
+    [cache setObject:resolvedColor forKey:keyValue];
   }
-  // TODO (https://github.com/material-components/material-components-ios/issues/8096):
-  // Grayscale color should be returned if color space is UIExtendedGrayColorSpace.
-  return [UIColor mdc_blendColor:[overlayColor colorWithAlphaComponent:alphaValue * (CGFloat)0.01]
-             withBackgroundColor:self];
+  return resolvedColor;
 }
 
 @end
@@ -31,6 +31,9 @@
 
  If a @c UIViewController conforms to @c MDCElevatable or @c MDCElevationOveriding then its @c view
  will report the view controllers base elevation.
+
+ The value is cached on the view until the next call to @c -mdc_elevationDidChange or
+ @c -mdc_elevationHierarchyDidChange on any view.
  */
 @property(nonatomic, assign, readonly) CGFloat mdc_baseElevation;
 
@@ -43,11 +46,22 @@
 @property(nonatomic, assign, readonly) CGFloat mdc_absoluteElevation;
 
 /**
- Should be called when the view's @c mdc_currentElevation has changed. Will be called on the
- receiver's @c subviews.
+ Should be called when the view's @c mdc_currentElevation or @c mdc_overrideBaseElevation has
+ changed, and after moving a view whose subviews include elevatable views.
 
- If a @c UIView views conform to @c MDCElevation then @c mdc_elevationDidChangeBlock: is called.
+ Calls @c mdc_elevationDidChangeBlock on the receiver and then on the descendants of the receiver
+ that have registered through @c -mdc_elevationHierarchyDidChange, superviews before subviews.
  */
 - (void)mdc_elevationDidChange;
 
+/**
+ Should be called by views conforming to @c MDCElevatable from @c -didMoveToSuperview and
+ @c -didMoveToWindow, and by view controllers conforming to @c MDCElevatable on their @c view from
+ @c -viewDidLoad and @c -viewWillAppear:.
+
+ Registers the receiver so that @c -mdc_elevationDidChange on one of its ancestors reaches it, and
+ discards cached base elevations.
+ */
+- (void)mdc_elevationHierarchyDidChange;
+
 @end
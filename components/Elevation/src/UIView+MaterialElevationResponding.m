@@ -14,40 +14,179 @@
 
 #import "UIView+MaterialElevationResponding.h"
 
+#import <objc/runtime.h>
+
 #import "MDCElevatable.h"
 #import "MDCElevationOverriding.h"
 
-@implementation UIView (MaterialElevationResponding)
+/** What an elevation lookup needs to know about a class. */
+typedef NS_OPTIONS(NSUInteger, MDCElevationClassTraits) {
+  MDCElevationClassTraitsNone = 0,
+  MDCElevationClassTraitsElevatable = 1 << 0,
+  MDCElevationClassTraitsOverriding = 1 << 1,
+  MDCElevationClassTraitsViewController = 1 << 2,
+  /** The class overrides @c -conformsToProtocol:, so its instances must be asked directly. */
+  MDCElevationClassTraitsInstanceConformance = 1 << 3,
+};
 
-- (void)mdc_elevationDidChange {
-  CGFloat baseElevation = self.mdc_baseElevation;
-  [self mdc_elevationDidChangeWithBaseElevation:baseElevation];
+/**
+ Returns the elevation traits of @c aClass.
+
+ Protocol conformance is normally a property of the class, so it is looked up once per class
+ instead of with two @c -conformsToProtocol: checks per view on every walk of the view hierarchy.
+ Classes that override @c -conformsToProtocol: are flagged so that their instances are still asked.
+ Must be called on the main thread.
+ */
+static MDCElevationClassTraits MDCElevationTraitsForClass(Class aClass) {
+  static CFMutableDictionaryRef traitsForClass;
+  static IMP defaultConformsToProtocol;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    // Classes are never deallocated, so they can be stored without retaining them.
+    traitsForClass = CFDictionaryCreateMutable(kCFAllocatorDefault, 0, NULL, NULL);
+    defaultConformsToProtocol =
+        class_getMethodImplementation([NSObject class], @selector(conformsToProtocol:));
+  });
+
+  const void *cachedTraits = NULL;
+  if (CFDictionaryGetValueIfPresent(traitsForClass, (__bridge const void *)aClass,
+                                    &cachedTraits)) {
+    return (MDCElevationClassTraits)(uintptr_t)cachedTraits;
+  }
+
+  MDCElevationClassTraits traits = MDCElevationClassTraitsNone;
+  if ([aClass conformsToProtocol:@protocol(MDCElevatable)]) {
+    traits |= MDCElevationClassTraitsElevatable;
+  }
+  if ([aClass conformsToProtocol:@protocol(MDCElevationOverriding)]) {
+    traits |= MDCElevationClassTraitsOverriding;
+  }
+  if ([aClass isSubclassOfClass:[UIViewController class]]) {
+    traits |= MDCElevationClassTraitsViewController;
+  }
+  if (class_getMethodImplementation(aClass, @selector(conformsToProtocol:)) !=
+      defaultConformsToProtocol) {
+    traits |= MDCElevationClassTraitsInstanceConformance;
+  }
+  CFDictionarySetValue(traitsForClass, (__bridge const void *)aClass,
+                       (const void *)(uintptr_t)traits);
+  return traits;
+}
+
+/** Returns the elevation traits of @c object, honoring overrides of @c -conformsToProtocol:. */
+static MDCElevationClassTraits MDCElevationTraitsForObject(id object) {
+  MDCElevationClassTraits traits = MDCElevationTraitsForClass([object class]);
+  if (!(traits & MDCElevationClassTraitsInstanceConformance)) {
+    return traits;
+  }
+  traits &= ~(MDCElevationClassTraitsElevatable | MDCElevationClassTraitsOverriding);
+  if ([object conformsToProtocol:@protocol(MDCElevatable)]) {
+    traits |= MDCElevationClassTraitsElevatable;
+  }
+  if ([object conformsToProtocol:@protocol(MDCElevationOverriding)]) {
+    traits |= MDCElevationClassTraitsOverriding;
+  }
+  return traits;
 }
 
-- (void)mdc_elevationDidChangeWithBaseElevation:(CGFloat)baseElevation {
-  CGFloat elevation = baseElevation;
-  id<MDCElevatable> elevatableSelf = [self objectConformingToElevationInResponderChain];
-  if (elevatableSelf.mdc_elevationDidChangeBlock) {
-    elevation += elevatableSelf.mdc_currentElevation;
-    elevatableSelf.mdc_elevationDidChangeBlock(elevatableSelf, elevation);
+/**
+ Looks up the objects that supply the elevation of @c view: the view itself if it conforms,
+ otherwise the view controller whose root view it is if that conforms, otherwise @c nil.
+
+ @param overriding May be @c NULL if only the @c MDCElevatable object is needed.
+ */
+static void MDCElevationObjectsForView(UIView *view,
+                                       id<MDCElevatable> __autoreleasing *elevatable,
+                                       id<MDCElevationOverriding> __autoreleasing *overriding) {
+  MDCElevationClassTraits traits = MDCElevationTraitsForObject(view);
+  *elevatable = (traits & MDCElevationClassTraitsElevatable) ? (id<MDCElevatable>)view : nil;
+  if (overriding) {
+    *overriding =
+        (traits & MDCElevationClassTraitsOverriding) ? (id<MDCElevationOverriding>)view : nil;
+  }
+  if (*elevatable != nil && (overriding == NULL || *overriding != nil)) {
+    return;
   }
 
-  for (UIView *subview in self.subviews) {
-    [subview mdc_elevationDidChangeWithBaseElevation:elevation];
+  UIResponder *nextResponder = view.nextResponder;
+  if (nextResponder == nil) {
+    return;
+  }
+  MDCElevationClassTraits nextResponderTraits = MDCElevationTraitsForObject(nextResponder);
+  if (!(nextResponderTraits & MDCElevationClassTraitsViewController)) {
+    return;
+  }
+  if (*elevatable == nil && (nextResponderTraits & MDCElevationClassTraitsElevatable)) {
+    *elevatable = (id<MDCElevatable>)nextResponder;
+  }
+  if (overriding && *overriding == nil &&
+      (nextResponderTraits & MDCElevationClassTraitsOverriding)) {
+    *overriding = (id<MDCElevationOverriding>)nextResponder;
   }
 }
 
-- (CGFloat)mdc_baseElevation {
+/** The base elevation of a view as of a given @c MDCElevationIndexGeneration. */
+@interface MDCElevationCachedBaseElevation : NSObject
+@property(nonatomic, assign) CGFloat baseElevation;
+@property(nonatomic, assign) NSUInteger generation;
+@end
+
+@implementation MDCElevationCachedBaseElevation
+@end
+
+static char kMDCElevationCachedBaseElevationKey;
+
+/**
+ Incremented whenever any cached base elevation may have become stale: when an elevation changes
+ and when a registered view moves in the view hierarchy. A cached value is only used while its
+ generation matches. Only accessed on the main thread.
+ */
+static NSUInteger MDCElevationIndexGeneration = 1;
+
+/**
+ The views that have registered through @c -mdc_elevationHierarchyDidChange and whose elevation is
+ supplied by an @c MDCElevatable view or view controller. Elevation changes are propagated to the
+ registered descendants of the changed view instead of to every one of its descendants. Views are
+ held weakly. Only accessed on the main thread.
+ */
+static NSHashTable<UIView *> *MDCElevationIndexRegisteredViews(void) {
+  static NSHashTable<UIView *> *registeredViews;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    registeredViews = [NSHashTable weakObjectsHashTable];
+  });
+  return registeredViews;
+}
+
+/** Returns the cached base elevation of @c view if it is still valid, otherwise @c nil. */
+static MDCElevationCachedBaseElevation *MDCElevationValidCachedBaseElevation(UIView *view) {
+  MDCElevationCachedBaseElevation *cached =
+      objc_getAssociatedObject(view, &kMDCElevationCachedBaseElevationKey);
+  return cached.generation == MDCElevationIndexGeneration ? cached : nil;
+}
+
+/**
+ Computes the base elevation of @c view and caches it on the view.
+
+ The walk up the hierarchy stops at the first ancestor with a valid cached base elevation, so
+ during a propagation each view only walks up to the closest view visited before it.
+ */
+static CGFloat MDCElevationComputeBaseElevation(UIView *view) {
   CGFloat totalElevation = 0;
-  UIView *current = self;
+  UIView *current = view;
 
   while (current != nil) {
-    id<MDCElevatable> elevatableCurrent = [current objectConformingToElevationInResponderChain];
-    if (current != self) {
+    id<MDCElevatable> elevatableCurrent;
+    id<MDCElevationOverriding> elevatableCurrentOverride;
+    MDCElevationObjectsForView(current, &elevatableCurrent, &elevatableCurrentOverride);
+    if (current != view) {
       totalElevation += elevatableCurrent.mdc_currentElevation;
+      MDCElevationCachedBaseElevation *cached = MDCElevationValidCachedBaseElevation(current);
+      if (cached != nil) {
+        totalElevation += cached.baseElevation;
+        break;
+      }
     }
-    id<MDCElevationOverriding> elevatableCurrentOverride =
-        [current objectConformingToOverrideInResponderChain];
     if (elevatableCurrentOverride != nil &&
         elevatableCurrentOverride.mdc_overrideBaseElevation >= 0) {
       totalElevation += elevatableCurrentOverride.mdc_overrideBaseElevation;
@@ -55,54 +194,100 @@
     }
     current = current.superview;
   }
+
+  MDCElevationCachedBaseElevation *cached =
+      objc_getAssociatedObject(view, &kMDCElevationCachedBaseElevationKey);
+  if (cached == nil) {
+    cached = [[MDCElevationCachedBaseElevation alloc] init];
+    objc_setAssociatedObject(view, &kMDCElevationCachedBaseElevationKey, cached,
+                             OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+  }
+  cached.baseElevation = totalElevation;
+  cached.generation = MDCElevationIndexGeneration;
   return totalElevation;
 }
 
-- (CGFloat)mdc_absoluteElevation {
-  CGFloat elevation = self.mdc_baseElevation;
-  id<MDCElevatable> elevatableSelf = [self objectConformingToElevationInResponderChain];
-  elevation += elevatableSelf.mdc_currentElevation;
-  return elevation;
+/** Adds @c view to the elevation index if an elevatable view or view controller backs it. */
+static void MDCElevationIndexRegisterView(UIView *view) {
+  id<MDCElevatable> elevatable;
+  MDCElevationObjectsForView(view, &elevatable, NULL);
+  if (elevatable != nil) {
+    [MDCElevationIndexRegisteredViews() addObject:view];
+  }
 }
 
 /**
- Checks whether a @c UIView or it's managing @c UIViewController conform to @c
- MDCOverrideElevation.
-
- @returns the conforming @c UIView then @c UIViewController, otherwise @c nil.
+ Returns @c view followed by its registered descendants, ordered so that every view comes after
+ its ancestors.
  */
-- (id<MDCElevationOverriding>)objectConformingToOverrideInResponderChain {
-  if ([self conformsToProtocol:@protocol(MDCElevationOverriding)]) {
-    return (id<MDCElevationOverriding>)self;
+static NSArray<UIView *> *MDCElevationViewsToNotify(UIView *view) {
+  NSMutableArray<NSMutableArray<UIView *> *> *viewsByDepth = [NSMutableArray array];
+  for (UIView *registeredView in MDCElevationIndexRegisteredViews()) {
+    // Views in another window cannot be descendants, which avoids most walks up the hierarchy.
+    if (registeredView == view || registeredView.window != view.window) {
+      continue;
+    }
+    NSUInteger depth = 0;
+    UIView *ancestor = registeredView.superview;
+    while (ancestor != nil && ancestor != view) {
+      ++depth;
+      ancestor = ancestor.superview;
+    }
+    if (ancestor == nil) {
+      continue;
+    }
+    while (viewsByDepth.count <= depth) {
+      [viewsByDepth addObject:[NSMutableArray array]];
+    }
+    [viewsByDepth[depth] addObject:registeredView];
   }
 
-  UIResponder *nextResponder = self.nextResponder;
-  if ([nextResponder isKindOfClass:[UIViewController class]] &&
-      [nextResponder conformsToProtocol:@protocol(MDCElevationOverriding)]) {
-    return (id<MDCElevationOverriding>)nextResponder;
+  NSMutableArray<UIView *> *views = [NSMutableArray arrayWithObject:view];
+  for (NSArray<UIView *> *viewsAtDepth in viewsByDepth) {
+    [views addObjectsFromArray:viewsAtDepth];
   }
-
-  return nil;
+  return views;
 }
 
-/**
- Checks whether a @c UIView or it's managing @c UIViewController conform to @c
- MDCElevation.
+@implementation UIView (MaterialElevationResponding)
 
- @returns the conforming @c UIView then @c UIViewController, otherwise @c nil.
- */
-- (id<MDCElevatable>)objectConformingToElevationInResponderChain {
-  if ([self conformsToProtocol:@protocol(MDCElevatable)]) {
-    return (id<MDCElevatable>)self;
+- (void)mdc_elevationDidChange {
+  ++MDCElevationIndexGeneration;
+  MDCElevationIndexRegisterView(self);
+
+  for (UIView *view in MDCElevationViewsToNotify(self)) {
+    id<MDCElevatable> elevatable;
+    MDCElevationObjectsForView(view, &elevatable, NULL);
+    if (!elevatable.mdc_elevationDidChangeBlock) {
+      continue;
+    }
+    CGFloat baseElevation = MDCElevationComputeBaseElevation(view);
+    elevatable.mdc_elevationDidChangeBlock(elevatable,
+                                           baseElevation + elevatable.mdc_currentElevation);
+    // The block may have changed the elevation that the view's descendants build on.
+    MDCElevationComputeBaseElevation(view);
   }
+}
 
-  UIResponder *nextResponder = self.nextResponder;
-  if ([nextResponder isKindOfClass:[UIViewController class]] &&
-      [nextResponder conformsToProtocol:@protocol(MDCElevatable)]) {
-    return (id<MDCElevatable>)nextResponder;
+- (void)mdc_elevationHierarchyDidChange {
+  ++MDCElevationIndexGeneration;
+  MDCElevationIndexRegisterView(self);
+}
+
+- (CGFloat)mdc_baseElevation {
+  MDCElevationCachedBaseElevation *cached = MDCElevationValidCachedBaseElevation(self);
+  if (cached != nil) {
+    return cached.baseElevation;
   }
+  return MDCElevationComputeBaseElevation(self);
+}
 
-  return nil;
+- (CGFloat)mdc_absoluteElevation {
+  CGFloat elevation = self.mdc_baseElevation;
+  id<MDCElevatable> elevatableSelf;
+  MDCElevationObjectsForView(self, &elevatableSelf, NULL);
+  elevation += elevatableSelf.mdc_currentElevation;
+  return elevation;
 }
 
 @end
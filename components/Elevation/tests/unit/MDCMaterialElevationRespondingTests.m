@@ -16,6 +16,12 @@
 
 #import <XCTest/XCTest.h>
 
+/** The depth of the view hierarchy in the performance tests. */
+static const NSUInteger kDeepHierarchyDepth = 40;
+
+/** The number of plain views next to each level of the hierarchy in the performance tests. */
+static const NSUInteger kDeepHierarchySiblingCount = 10;
+
 /**
  Used for testing @c UIViews that conform to @c MDCElevatable and do not conform to @c
  MDCElevatableOverride.
@@ -33,6 +39,16 @@
   return self.elevation;
 }
 
+- (void)didMoveToSuperview {
+  [super didMoveToSuperview];
+  [self mdc_elevationHierarchyDidChange];
+}
+
+- (void)didMoveToWindow {
+  [super didMoveToWindow];
+  [self mdc_elevationHierarchyDidChange];
+}
+
 @end
 
 /**
@@ -52,6 +68,11 @@
   return self.elevation;
 }
 
+- (void)viewDidLoad {
+  [super viewDidLoad];
+  [self.view mdc_elevationHierarchyDidChange];
+}
+
 @end
 
 /**
@@ -72,6 +93,16 @@
   return self.elevation;
 }
 
+- (void)didMoveToSuperview {
+  [super didMoveToSuperview];
+  [self mdc_elevationHierarchyDidChange];
+}
+
+- (void)didMoveToWindow {
+  [super didMoveToWindow];
+  [self mdc_elevationHierarchyDidChange];
+}
+
 @end
 
 @interface MDCConformingMDCElevatableOverrideViewSubclass : MDCConformingMDCElevatableOverrideView
@@ -105,6 +136,38 @@
   return self.elevation;
 }
 
+- (void)viewDidLoad {
+  [super viewDidLoad];
+  [self.view mdc_elevationHierarchyDidChange];
+}
+
+@end
+
+/**
+ Used for testing @c UIViews that only conform to @c MDCElevatable when @c conforming is set, by
+ overriding @c -conformsToProtocol:.
+ */
+@interface MDCInstanceConformingElevatableView : UIView
+@property(nonatomic, assign) BOOL conforming;
+@property(nonatomic, assign, readonly) CGFloat mdc_currentElevation;
+@property(nonatomic, copy, nullable) void (^mdc_elevationDidChangeBlock)
+    (MDCInstanceConformingElevatableView *view, CGFloat elevation);
+@property(nonatomic, assign) CGFloat elevation;
+@end
+
+@implementation MDCInstanceConformingElevatableView
+
+- (BOOL)conformsToProtocol:(Protocol *)aProtocol {
+  if (aProtocol == @protocol(MDCElevatable)) {
+    return self.conforming;
+  }
+  return [super conformsToProtocol:aProtocol];
+}
+
+- (CGFloat)mdc_currentElevation {
+  return self.elevation;
+}
+
 @end
 
 /**
@@ -592,4 +655,156 @@
   XCTAssertEqualWithAccuracy(self.view.mdc_baseElevation, self.view.mdc_absoluteElevation, 0.001);
 }
 
+- (void)testBaseElevationIsComputedPerInstanceForSharedClasses {
+  // Given
+  MDCConformingMDCElevatableView *otherElevationView =
+      [[MDCConformingMDCElevatableView alloc] init];
+  self.elevationView.elevation = 3;
+  otherElevationView.elevation = 5;
+  [self.elevationView addSubview:otherElevationView];
+
+  // When
+  [otherElevationView addSubview:self.view];
+
+  // Then
+  XCTAssertEqualWithAccuracy(otherElevationView.mdc_baseElevation, 3, 0.001);
+  XCTAssertEqualWithAccuracy(self.view.mdc_baseElevation, 8, 0.001);
+}
+
+- (void)testBaseElevationHonorsInstanceConformsToProtocol {
+  // Given
+  MDCInstanceConformingElevatableView *conformingView =
+      [[MDCInstanceConformingElevatableView alloc] init];
+  conformingView.conforming = YES;
+  conformingView.elevation = 4;
+  MDCInstanceConformingElevatableView *nonConformingView =
+      [[MDCInstanceConformingElevatableView alloc] init];
+  nonConformingView.elevation = 6;
+  MDCConformingMDCElevatableView *otherView = [[MDCConformingMDCElevatableView alloc] init];
+
+  // When
+  [conformingView addSubview:self.view];
+  [nonConformingView addSubview:otherView];
+
+  // Then
+  XCTAssertEqualWithAccuracy(self.view.mdc_baseElevation, 4, 0.001);
+  XCTAssertEqualWithAccuracy(otherView.mdc_baseElevation, 0, 0.001);
+}
+
+- (void)testBaseElevationIsRecomputedAfterMovingToAnotherSuperview {
+  // Given
+  MDCConformingMDCElevatableView *otherElevationView =
+      [[MDCConformingMDCElevatableView alloc] init];
+  self.elevationView.elevation = 3;
+  otherElevationView.elevation = 5;
+  [self.elevationView addSubview:self.view];
+  XCTAssertEqualWithAccuracy(self.view.mdc_baseElevation, 3, 0.001);
+
+  // When
+  [otherElevationView addSubview:self.view];
+
+  // Then
+  XCTAssertEqualWithAccuracy(self.view.mdc_baseElevation, 5, 0.001);
+}
+
+- (void)testElevationDidChangeDoesNotCallViewsRemovedFromTheHierarchy {
+  // Given
+  __block BOOL blockCalled = NO;
+  [self.elevationOverrideView addSubview:self.elevationView];
+  self.elevationView.mdc_elevationDidChangeBlock =
+      ^(MDCConformingMDCElevatableView *view, CGFloat elevation) {
+        blockCalled = YES;
+      };
+  [self.elevationView removeFromSuperview];
+
+  // When
+  [self.elevationOverrideView mdc_elevationDidChange];
+
+  // Then
+  XCTAssertFalse(blockCalled);
+}
+
+- (void)testElevationDidChangePassesUpdatedElevationToNestedViews {
+  // Given
+  UIView *middleView = [[UIView alloc] init];
+  __block CGFloat passedElevation = -1;
+  self.elevationOverrideView.elevation = 2;
+  self.elevationView.elevation = 3;
+  self.view.elevation = 1;
+  [self.elevationOverrideView addSubview:self.elevationView];
+  [self.elevationView addSubview:middleView];
+  [middleView addSubview:self.view];
+  self.view.mdc_elevationDidChangeBlock =
+      ^(MDCConformingMDCElevatableView *view, CGFloat elevation) {
+        passedElevation = elevation;
+      };
+  XCTAssertEqualWithAccuracy(self.view.mdc_absoluteElevation, 6, 0.001);
+
+  // When
+  self.elevationView.elevation = 10;
+  [self.elevationView mdc_elevationDidChange];
+
+  // Then
+  XCTAssertEqualWithAccuracy(passedElevation, 13, 0.001);
+  XCTAssertEqualWithAccuracy(self.view.mdc_absoluteElevation, 13, 0.001);
+}
+
+/**
+ Builds a chain of @c kDeepHierarchyDepth elevatable views, each with plain sibling views, under
+ @c self.elevationView and returns the innermost view.
+ */
+- (MDCConformingMDCElevatableView *)buildDeepHierarchy {
+  UIView *parent = self.elevationView;
+  MDCConformingMDCElevatableView *innermostView = nil;
+  for (NSUInteger level = 0; level < kDeepHierarchyDepth; ++level) {
+    for (NSUInteger sibling = 0; sibling < kDeepHierarchySiblingCount; ++sibling) {
+      [parent addSubview:[[UIView alloc] init]];
+    }
+    innermostView = [[MDCConformingMDCElevatableView alloc] init];
+    innermostView.elevation = 1;
+    innermostView.mdc_elevationDidChangeBlock =
+        ^(MDCConformingMDCElevatableView *view, CGFloat elevation) {
+        };
+    [parent addSubview:innermostView];
+    parent = innermostView;
+  }
+  return innermostView;
+}
+
+- (void)testBaseElevationInDeepHierarchyPerformance {
+  // Given
+  MDCConformingMDCElevatableView *innermostView = [self buildDeepHierarchy];
+  __block CGFloat baseElevation = 0;
+
+  // When
+  [self measureBlock:^{
+    for (NSUInteger iteration = 0; iteration < 1000; ++iteration) {
+      baseElevation = innermostView.mdc_baseElevation;
+    }
+  }];
+
+  // Then
+  XCTAssertEqualWithAccuracy(baseElevation, kDeepHierarchyDepth - 1, 0.001);
+}
+
+- (void)testElevationDidChangeInDeepHierarchyPerformance {
+  // Given
+  MDCConformingMDCElevatableView *innermostView = [self buildDeepHierarchy];
+  __block CGFloat innermostElevation = 0;
+  innermostView.mdc_elevationDidChangeBlock =
+      ^(MDCConformingMDCElevatableView *view, CGFloat elevation) {
+        innermostElevation = elevation;
+      };
+
+  // When
+  [self measureBlock:^{
+    for (NSUInteger iteration = 0; iteration < 100; ++iteration) {
+      [self.elevationView mdc_elevationDidChange];
+    }
+  }];
+
+  // Then
+  XCTAssertEqualWithAccuracy(innermostElevation, kDeepHierarchyDepth, 0.001);
+}
+
 @end
@@ -348,4 +348,73 @@ static UIImage *fakeImageWithColorAndSize(UIColor *color, CGRect bounds) {
 #endif
 }
 
+- (void)testResolvingTheSameColorAndElevationReturnsTheMemoizedColor {
+  // Given
+  UIColor *equalRGBColor = [UIColor colorWithRed:(CGFloat)0.9
+                                           green:(CGFloat)0.8
+                                            blue:(CGFloat)0.6
+                                           alpha:(CGFloat)0.6];
+
+  // When
+  UIColor *firstResolvedColor = [self.rgbColor mdc_resolvedColorWithElevation:8];
+  UIColor *secondResolvedColor = [equalRGBColor mdc_resolvedColorWithElevation:8];
+
+  // Then
+  XCTAssertEqual(firstResolvedColor, secondResolvedColor);
+}
+
+- (void)testResolvingDifferentColorsOrElevationsDoesNotShareMemoizedColors {
+  // Given
+  UIColor *translucentRGBColor = [self.rgbColor colorWithAlphaComponent:(CGFloat)0.3];
+
+  // When
+  UIColor *resolvedColor = [self.rgbColor mdc_resolvedColorWithElevation:8];
+  UIColor *resolvedTranslucentColor = [translucentRGBColor mdc_resolvedColorWithElevation:8];
+  UIColor *resolvedHigherColor = [self.rgbColor mdc_resolvedColorWithElevation:12];
+
+  // Then
+  XCTAssertNotEqualObjects(resolvedColor, resolvedTranslucentColor);
+  XCTAssertNotEqualObjects(resolvedColor, resolvedHigherColor);
+}
+
+- (void)testResolvedColorsWithElevationsMatchIndividuallyResolvedColors {
+  // Given
+  NSArray<NSNumber *> *elevations = @[ @0, @(0.5), @1, @4, @24, @(-2) ];
+
+  // When
+  NSArray<UIColor *> *resolvedColors = [self.rgbColor mdc_resolvedColorsWithElevations:elevations];
+
+  // Then
+  XCTAssertEqual(resolvedColors.count, elevations.count);
+  for (NSUInteger index = 0; index < elevations.count; ++index) {
+    UIColor *expectedColor =
+        [self.rgbColor mdc_resolvedColorWithElevation:(CGFloat)elevations[index].doubleValue];
+    [self assertEqualColorsWithFloatPrecisionFirstColor:resolvedColors[index]
+                                            secondColor:expectedColor];
+  }
+}
+
+- (void)testResolvingSurfacesOfManyCardsPerformance {
+  // Given
+  NSUInteger cardCount = 500;
+  NSMutableArray<UIColor *> *surfaceColors = [NSMutableArray arrayWithCapacity:cardCount];
+  for (NSUInteger card = 0; card < cardCount; ++card) {
+    [surfaceColors addObject:[UIColor colorWithRed:(CGFloat)0.07
+                                             green:(CGFloat)0.07
+                                              blue:(CGFloat)0.07
+                                             alpha:1]];
+  }
+  __block UIColor *lastResolvedColor = nil;
+
+  // When
+  [self measureBlock:^{
+    for (UIColor *surfaceColor in surfaceColors) {
+      lastResolvedColor = [surfaceColor mdc_resolvedColorWithElevation:1];
+    }
+  }];
+
+  // Then
+  XCTAssertEqual(lastResolvedColor, [surfaceColors.firstObject mdc_resolvedColorWithElevation:1]);
+}
+
 @end
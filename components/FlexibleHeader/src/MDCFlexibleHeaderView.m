@@ -19,7 +19,9 @@
 #import "MaterialMath.h"
 #import "MaterialShadowElevations.h"
 #import "MaterialUIMetrics.h"
+#import "private/MDCFlexibleHeaderDisplayLink.h"
 #import "private/MDCFlexibleHeaderMinMaxHeight.h"
+#import "private/MDCFlexibleHeaderShiftCurve.h"
 #import "private/MDCFlexibleHeaderTopSafeArea.h"
 #import "private/MDCFlexibleHeaderView+Private.h"
 #import "private/MDCStatusBarShifter.h"
@@ -42,10 +44,6 @@ static const CGFloat kShadowScaleLength = 8;
 // Duration of the UIKit animation that occurs when changing the tracking scroll view.
 static const NSTimeInterval kTrackingScrollViewDidChangeAnimationDuration = 0.2;
 
-// The epsilon used to determine when we've arrived at the destination while shifting the header
-// on/off-screen with the display link.
-static const float kShiftEpsilon = (float)0.1;
-
 // The epsilon used when comparing height values.
 static const CGFloat kHeightEpsilon = (CGFloat)0.001;
 
@@ -55,9 +53,6 @@ static const CGFloat kContentOffsetEpsilon = (CGFloat)0.001;
 // The minimum delta y before we change the scroll direction.
 static const CGFloat kDeltaYSlop = 5;
 
-// Affects how fast the header shifts on/off-screen while animating. Bigger value = faster.
-static const CGFloat kAttachmentCoefficient = 12;
-
 // The amount the user needs to scroll back before the header starts shifting back on-screen.
 static const CGFloat kMaxAnchorLengthFullSwipe = 175;
 static const CGFloat kMaxAnchorLengthQuickSwipe = 25;
@@ -78,7 +73,8 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
   return intendedShiftBehavior;
 }
 
-@interface MDCFlexibleHeaderView () <MDCStatusBarShifterDelegate,
+@interface MDCFlexibleHeaderView () <MDCFlexibleHeaderDisplayLinkObserver,
+                                     MDCStatusBarShifterDelegate,
                                      MDCFlexibleHeaderTopSafeAreaDelegate,
                                      MDCFlexibleHeaderMinMaxHeightDelegate>
 
@@ -159,7 +155,26 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
   CGFloat _shiftAccumulator;
   CGPoint _shiftAccumulatorLastContentOffset;  // Stores our last delta'd content offset.
   CGFloat _shiftAccumulatorDeltaY;
-  CADisplayLink *_shiftAccumulatorDisplayLink;
+
+  // Shift animation state. While animating, the accumulator follows MDCFlexibleHeaderShiftCurve
+  // from _shiftAnimationOrigin to _shiftAnimationDestination, starting at _shiftAnimationStartTime.
+  // The curve restarts from the present value if the destination or the accumulator is changed by
+  // anything other than the animation itself.
+  BOOL _isAnimatingShift;
+  BOOL _shiftAnimationHasStarted;
+  CGFloat _shiftAnimationOrigin;
+  CGFloat _shiftAnimationDestination;
+  CGFloat _shiftAnimationValue;
+  CFTimeInterval _shiftAnimationStartTime;
+
+  // The inputs of the last frame commit. Scroll and animation ticks that would commit the exact
+  // same frame are skipped.
+  BOOL _lastCommitIsValid;
+  CGFloat _lastCommitShiftAccumulator;
+  CGFloat _lastCommitContentOffsetY;
+  CGFloat _lastCommitTopContentInset;
+  CGFloat _lastCommitAccumulatorMax;
+  CGRect _lastCommitBounds;
 
   BOOL _interfaceOrientationIsChanging;
   BOOL _contentInsetsAreChanging;
@@ -403,6 +418,12 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
   }
 }
 
+- (void)didMoveToSuperview {
+  [super didMoveToSuperview];
+
+  [self mdc_elevationHierarchyDidChange];
+}
+
 - (void)willMoveToWindow:(UIWindow *)newWindow {
   [super willMoveToWindow:newWindow];
 
@@ -413,6 +434,7 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
   [super didMoveToWindow];
 
   [_statusBarShifter didMoveToWindow];
+  [self mdc_elevationHierarchyDidChange];
 }
 
 - (UIView *)hitTest:(CGPoint)point withEvent:(UIEvent *)event {
@@ -846,49 +868,66 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
 - (void)fhv_startDisplayLink {
   [self fhv_stopDisplayLink];
 
-  // NOTE: This may cause a retain cycle.
-  // cl/129917749
-  _shiftAccumulatorDisplayLink =
-      [CADisplayLink displayLinkWithTarget:self
-                                  selector:@selector(fhv_shiftAccumulatorDisplayLinkDidFire:)];
-  [_shiftAccumulatorDisplayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+  _isAnimatingShift = YES;
+  _shiftAnimationHasStarted = NO;
+  [[MDCFlexibleHeaderDisplayLink sharedDisplayLink] addObserver:self];
 }
 
 - (void)fhv_stopDisplayLink {
-  [_shiftAccumulatorDisplayLink invalidate];
-  _shiftAccumulatorDisplayLink = nil;
+  if (!_isAnimatingShift) {
+    return;
+  }
+  _isAnimatingShift = NO;
+  [[MDCFlexibleHeaderDisplayLink sharedDisplayLink] removeObserver:self];
 }
 
-- (void)fhv_shiftAccumulatorDisplayLinkDidFire:(CADisplayLink *)displayLink {
-  // Erase any scrollback that was injected into the accumulator by capping it back down.
-  _shiftAccumulator = MIN([self fhv_accumulatorMax], _shiftAccumulator);
+- (void)flexibleHeaderDisplayLinkDidFire:(MDCFlexibleHeaderDisplayLink *)displayLink {
+  [self fhv_advanceShiftAnimationWithFrameTimestamp:displayLink.timestamp
+                                    targetTimestamp:displayLink.targetTimestamp];
+}
 
-  CGFloat destination;
+- (CGFloat)fhv_shiftAnimationDestination {
   if (self.canAlwaysExpandToMaximumHeight) {
     if (_shiftAccumulator > 0) {  // Shifted
-      destination = _wantsToBeHidden ? [self fhv_accumulatorMax] : 0;
+      return _wantsToBeHidden ? [self fhv_accumulatorMax] : 0;
 
     } else if (_shiftAccumulator < 0) {  // Expanded
-      destination = _wantsToBeHidden ? 0 : [self fhv_accumulatorMin];
+      return _wantsToBeHidden ? 0 : [self fhv_accumulatorMin];
 
     } else {
-      destination = 0;
+      return 0;
     }
+  }
+  return _wantsToBeHidden ? [self fhv_accumulatorMax] : 0;
+}
 
-  } else {
-    destination = _wantsToBeHidden ? [self fhv_accumulatorMax] : 0;
+// Evaluates the shift curve at targetTimestamp, the time at which the frame started at timestamp
+// will be displayed.
+- (void)fhv_advanceShiftAnimationWithFrameTimestamp:(CFTimeInterval)timestamp
+                                    targetTimestamp:(CFTimeInterval)targetTimestamp {
+  if (!_isAnimatingShift) {
+    return;
   }
 
-  CGFloat distanceToDestination = destination - _shiftAccumulator;
+  // Erase any scrollback that was injected into the accumulator by capping it back down.
+  _shiftAccumulator = MIN([self fhv_accumulatorMax], _shiftAccumulator);
+
+  CGFloat destination = [self fhv_shiftAnimationDestination];
+  if (!_shiftAnimationHasStarted || destination != _shiftAnimationDestination ||
+      _shiftAccumulator != _shiftAnimationValue) {
+    _shiftAnimationHasStarted = YES;
+    _shiftAnimationOrigin = _shiftAccumulator;
+    _shiftAnimationDestination = destination;
+    _shiftAnimationStartTime = timestamp;
+  }
 
-  NSTimeInterval duration = displayLink.duration;
+  NSTimeInterval elapsed = targetTimestamp - _shiftAnimationStartTime;
 
 #if TARGET_IPHONE_SIMULATOR
-  duration /= [self fhv_dragCoefficient];
+  elapsed /= [self fhv_dragCoefficient];
 #endif
 
-  // This is a simple "force" that's stronger the further we are from the destination.
-  _shiftAccumulator += (CGFloat)(kAttachmentCoefficient * distanceToDestination * duration);
+  _shiftAccumulator = MDCFlexibleHeaderShiftCurveValue(_shiftAnimationOrigin, destination, elapsed);
 
   if (self.canAlwaysExpandToMaximumHeight) {
     _shiftAccumulator =
@@ -900,13 +939,14 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
   }
 
   // Have we reached our destination?
-  if (fabs(destination - _shiftAccumulator) <= kShiftEpsilon) {
+  if (MDCFabs(destination - _shiftAccumulator) <= MDCFlexibleHeaderShiftCurveEpsilon) {
     _shiftAccumulator = destination;
 
     [self fhv_stopDisplayLink];
   }
+  _shiftAnimationValue = _shiftAccumulator;
 
-  [self fhv_commitAccumulatorToFrame];
+  [self fhv_commitAccumulatorToFrameIfNeeded];
 }
 
 #pragma mark Shift Accumulator
@@ -1016,6 +1056,13 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
 }
 
 - (void)fhv_updateLayout {
+  [self fhv_updateLayoutSkippingRedundantCommit:NO];
+}
+
+// When skipRedundantCommit is YES, the frame is only committed if one of the inputs tracked by
+// fhv_commitAccumulatorToFrameIfNeeded changed. Only content offset changes may skip commits, as
+// other callers update properties (shadow, shift behavior, ...) that the inputs don't cover.
+- (void)fhv_updateLayoutSkippingRedundantCommit:(BOOL)skipRedundantCommit {
   if (!_trackingScrollView) {
     return;
   }
@@ -1059,7 +1106,7 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
       }
     }
 
-    if (![self fhv_isOverExtendingBottom] && !_shiftAccumulatorDisplayLink) {
+    if (![self fhv_isOverExtendingBottom] && !_isAnimatingShift) {
       if (!self.canAlwaysExpandToMaximumHeight) {
         // When we're not allowed to shift offscreen, only allow the header to shift further
         // on-screen in case it was previously off-screen due to a behavior change.
@@ -1142,7 +1189,11 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
     self.bounds = bounds;
   }
 
-  [self fhv_commitAccumulatorToFrame];
+  if (skipRedundantCommit) {
+    [self fhv_commitAccumulatorToFrameIfNeeded];
+  } else {
+    [self fhv_commitAccumulatorToFrame];
+  }
 
   _shiftAccumulatorLastContentOffset = [self fhv_boundedContentOffset];
   _shiftAccumulatorLastContentOffsetIsValid = YES;
@@ -1158,6 +1209,19 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
   }
 }
 
+// Commits the accumulator unless nothing that affects the committed frame, shadow or scroll
+// indicator insets changed since the last commit.
+- (void)fhv_commitAccumulatorToFrameIfNeeded {
+  if (_lastCommitIsValid && _lastCommitShiftAccumulator == _shiftAccumulator &&
+      _lastCommitContentOffsetY == _trackingScrollView.contentOffset.y &&
+      _lastCommitTopContentInset == _trackingScrollView.contentInset.top &&
+      _lastCommitAccumulatorMax == [self fhv_accumulatorMax] &&
+      CGRectEqualToRect(_lastCommitBounds, self.bounds)) {
+    return;
+  }
+  [self fhv_commitAccumulatorToFrame];
+}
+
 // Commit the current shiftOffscreenAccumulator value to the view's position.
 - (void)fhv_commitAccumulatorToFrame {
   if (self.canAlwaysExpandToMaximumHeight) {
@@ -1210,6 +1274,13 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
 
   [_statusBarShifter setOffset:_shiftAccumulator];
 
+  _lastCommitIsValid = YES;
+  _lastCommitShiftAccumulator = _shiftAccumulator;
+  _lastCommitContentOffsetY = _trackingScrollView.contentOffset.y;
+  _lastCommitTopContentInset = _trackingScrollView.contentInset.top;
+  _lastCommitAccumulatorMax = [self fhv_accumulatorMax];
+  _lastCommitBounds = self.bounds;
+
   [self.delegate flexibleHeaderViewFrameDidChange:self];
 }
 
@@ -1275,7 +1346,7 @@ static inline MDCFlexibleHeaderShiftBehavior ShiftBehaviorForCurrentAppContext(
     return;
   }
 
-  [self fhv_updateLayout];
+  [self fhv_updateLayoutSkippingRedundantCommit:YES];
 }
 
 #pragma mark TraitCollection
@@ -0,0 +1,70 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <QuartzCore/QuartzCore.h>
+
+@class MDCFlexibleHeaderDisplayLink;
+
+/** An object that is notified on every frame while it observes the shared display link. */
+@protocol MDCFlexibleHeaderDisplayLinkObserver <NSObject>
+
+/**
+ Called once per frame. All observers receive the same @c timestamp and @c targetTimestamp for a
+ given frame.
+ */
+- (void)flexibleHeaderDisplayLinkDidFire:(nonnull MDCFlexibleHeaderDisplayLink *)displayLink;
+
+@end
+
+/**
+ A display link shared by all flexible header views.
+
+ Nested or sibling headers that animate at the same time are driven by a single CADisplayLink, which
+ is only scheduled while at least one observer is registered. Observers are held weakly, so a header
+ that is deallocated mid-animation is simply dropped.
+
+ This class is not intended to be subclassed.
+ */
+__attribute__((objc_subclassing_restricted)) @interface MDCFlexibleHeaderDisplayLink : NSObject
+
+/** The display link used by all flexible header views. Must only be used on the main thread. */
++ (nonnull instancetype)sharedDisplayLink;
+
+/** Starts notifying @c observer on every frame. Adding an observer twice has no effect. */
+- (void)addObserver:(nonnull id<MDCFlexibleHeaderDisplayLinkObserver>)observer;
+
+/** Stops notifying @c observer. */
+- (void)removeObserver:(nonnull id<MDCFlexibleHeaderDisplayLinkObserver>)observer;
+
+/** Returns YES if @c observer is currently notified on every frame. */
+- (BOOL)containsObserver:(nonnull id<MDCFlexibleHeaderDisplayLinkObserver>)observer;
+
+/** Whether the underlying CADisplayLink is currently scheduled. */
+@property(nonatomic, readonly, getter=isRunning) BOOL running;
+
+/** The number of observers currently registered. */
+@property(nonatomic, readonly) NSUInteger observerCount;
+
+/** The time at which the frame being prepared started. */
+@property(nonatomic, readonly) CFTimeInterval timestamp;
+
+/**
+ The time at which the frame being prepared will be displayed. Animations should be evaluated at
+ this time so that they adapt to the display's refresh rate.
+ */
+@property(nonatomic, readonly) CFTimeInterval targetTimestamp;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+@end
@@ -0,0 +1,110 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCFlexibleHeaderDisplayLink.h"
+
+@implementation MDCFlexibleHeaderDisplayLink {
+  CADisplayLink *_displayLink;
+  NSHashTable<id<MDCFlexibleHeaderDisplayLinkObserver>> *_observers;
+}
+
++ (instancetype)sharedDisplayLink {
+  static MDCFlexibleHeaderDisplayLink *sharedDisplayLink;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    sharedDisplayLink = [[self alloc] initPrivate];
+  });
+  return sharedDisplayLink;
+}
+
+- (instancetype)initPrivate {
+  self = [super init];
+  if (self) {
+    _observers = [NSHashTable weakObjectsHashTable];
+  }
+  return self;
+}
+
+- (void)addObserver:(id<MDCFlexibleHeaderDisplayLinkObserver>)observer {
+  [_observers addObject:observer];
+  [self startIfNeeded];
+}
+
+- (void)removeObserver:(id<MDCFlexibleHeaderDisplayLinkObserver>)observer {
+  [_observers removeObject:observer];
+  if (_observers.count == 0) {
+    [self stop];
+  }
+}
+
+- (BOOL)containsObserver:(id<MDCFlexibleHeaderDisplayLinkObserver>)observer {
+  return [_observers containsObject:observer];
+}
+
+- (BOOL)isRunning {
+  return _displayLink != nil;
+}
+
+- (NSUInteger)observerCount {
+  // NSHashTable's count may include observers that have since been deallocated.
+  return _observers.allObjects.count;
+}
+
+#pragma mark - Private
+
+- (void)startIfNeeded {
+  if (_displayLink) {
+    return;
+  }
+  // The display link retains its target, so it targets this long-lived object rather than the
+  // observers themselves.
+  _displayLink = [CADisplayLink displayLinkWithTarget:self selector:@selector(displayLinkDidFire:)];
+  if (@available(iOS 10.0, *)) {
+    // Run at the display's native refresh rate, e.g. 120Hz on ProMotion displays.
+    _displayLink.preferredFramesPerSecond = 0;
+  }
+#if defined(__IPHONE_15_0) && (__IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_15_0)
+  if (@available(iOS 15.0, *)) {
+    // Prefer 120Hz while tracking a scroll, but let the system fall back to 60Hz, e.g. in Low
+    // Power Mode, rather than asking for a minimum that 60Hz displays can't meet.
+    _displayLink.preferredFrameRateRange = CAFrameRateRangeMake(60, 120, 120);
+  }
+#endif
+  [_displayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+}
+
+- (void)stop {
+  [_displayLink invalidate];
+  _displayLink = nil;
+}
+
+- (void)displayLinkDidFire:(CADisplayLink *)displayLink {
+  _timestamp = displayLink.timestamp;
+  if (@available(iOS 10.0, *)) {
+    _targetTimestamp = displayLink.targetTimestamp;
+  } else {
+    _targetTimestamp = displayLink.timestamp + displayLink.duration;
+  }
+
+  NSArray<id<MDCFlexibleHeaderDisplayLinkObserver>> *observers = _observers.allObjects;
+  if (observers.count == 0) {
+    [self stop];
+    return;
+  }
+  for (id<MDCFlexibleHeaderDisplayLinkObserver> observer in observers) {
+    [observer flexibleHeaderDisplayLinkDidFire:self];
+  }
+}
+
+@end
@@ -0,0 +1,47 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <CoreGraphics/CoreGraphics.h>
+#import <Foundation/Foundation.h>
+
+/**
+ The curve followed by MDCFlexibleHeaderView's shift accumulator when the header animates on- or
+ off-screen.
+
+ The curve is the closed-form solution of an attachment "force" that pulls the accumulator towards
+ its destination proportionally to the remaining distance. Because it is evaluated from the time
+ elapsed since the animation started rather than integrated frame by frame, the header follows the
+ exact same path at 60Hz and 120Hz and replaying the same timestamps always yields the same values.
+ */
+
+/**
+ Returns the accumulator value @c elapsed seconds after animating from @c origin towards
+ @c destination began.
+
+ Once the curve is within MDCFlexibleHeaderShiftCurveEpsilon of @c destination, @c destination is
+ returned.
+ */
+FOUNDATION_EXTERN CGFloat MDCFlexibleHeaderShiftCurveValue(CGFloat origin,
+                                                           CGFloat destination,
+                                                           NSTimeInterval elapsed);
+
+/**
+ Returns the number of seconds it takes the curve to settle at @c destination when starting from
+ @c origin.
+ */
+FOUNDATION_EXTERN NSTimeInterval MDCFlexibleHeaderShiftCurveDuration(CGFloat origin,
+                                                                     CGFloat destination);
+
+/** The distance from the destination within which the curve is considered settled. */
+FOUNDATION_EXTERN const CGFloat MDCFlexibleHeaderShiftCurveEpsilon;
@@ -0,0 +1,43 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCFlexibleHeaderShiftCurve.h"
+
+#import "MaterialMath.h"
+
+// Affects how fast the header shifts on/off-screen while animating. Bigger value = faster.
+static const CGFloat kAttachmentCoefficient = 12;
+
+const CGFloat MDCFlexibleHeaderShiftCurveEpsilon = (CGFloat)0.1;
+
+NSTimeInterval MDCFlexibleHeaderShiftCurveDuration(CGFloat origin, CGFloat destination) {
+  CGFloat distance = MDCFabs(destination - origin);
+  if (distance <= MDCFlexibleHeaderShiftCurveEpsilon) {
+    return 0;
+  }
+  // Solves distance * e^(-k * t) = epsilon for t.
+  return log(distance / MDCFlexibleHeaderShiftCurveEpsilon) / kAttachmentCoefficient;
+}
+
+CGFloat MDCFlexibleHeaderShiftCurveValue(CGFloat origin,
+                                         CGFloat destination,
+                                         NSTimeInterval elapsed) {
+  if (elapsed >= MDCFlexibleHeaderShiftCurveDuration(origin, destination)) {
+    return destination;
+  }
+  if (elapsed <= 0) {
+    return origin;
+  }
+  return destination + (origin - destination) * (CGFloat)exp(-kAttachmentCoefficient * elapsed);
+}
@@ -0,0 +1,115 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialFlexibleHeader.h"
+#import "MaterialScrollTrace.h"
+
+/** Reports layout passes and frame commits of a flexible header to a replayer. */
+@interface FlexibleHeaderScrollTraceReplayTestsHeaderView
+    : MDCFlexibleHeaderView <MDCFlexibleHeaderViewDelegate>
+@property(nonatomic, weak) MDCScrollTraceReplayer *replayer;
+@end
+
+@implementation FlexibleHeaderScrollTraceReplayTestsHeaderView
+
+- (void)layoutSubviews {
+  [super layoutSubviews];
+
+  [self.replayer recordLayoutPass];
+}
+
+- (void)flexibleHeaderViewNeedsStatusBarAppearanceUpdate:(MDCFlexibleHeaderView *)headerView {
+}
+
+- (void)flexibleHeaderViewFrameDidChange:(MDCFlexibleHeaderView *)headerView {
+  [self.replayer recordFrameCommit];
+}
+
+@end
+
+@interface FlexibleHeaderScrollTraceReplayTests : XCTestCase
+@end
+
+@implementation FlexibleHeaderScrollTraceReplayTests
+
+- (MDCScrollTraceReport *)replayTrace:(MDCScrollTrace *)trace
+                                 name:(NSString *)name
+                            frameRate:(NSInteger)frameRate {
+  FlexibleHeaderScrollTraceReplayTestsHeaderView *header =
+      [[FlexibleHeaderScrollTraceReplayTestsHeaderView alloc] init];
+  header.frame = CGRectMake(0, 0, 320, 56);
+  header.maximumHeight = 128;
+  header.shiftBehavior = MDCFlexibleHeaderShiftBehaviorEnabled;
+  header.delegate = header;
+
+  UIScrollView *scrollView = [[UIScrollView alloc] initWithFrame:CGRectMake(0, 0, 320, 480)];
+  scrollView.contentSize = CGSizeMake(320, 10000);
+  header.trackingScrollView = scrollView;
+  [header trackingScrollViewDidScroll];
+
+  MDCScrollTraceReplayer *replayer = [[MDCScrollTraceReplayer alloc] initWithTrace:trace];
+  replayer.name = name;
+  replayer.frameRate = frameRate;
+  header.replayer = replayer;
+
+  MDCScrollTraceReport *report = [replayer replayWithFrameHandler:^(MDCScrollTraceSample sample) {
+    scrollView.contentOffset = sample.contentOffset;
+    [header trackingScrollViewDidScroll];
+    [header layoutIfNeeded];
+  }];
+  NSError *error;
+  XCTAssertTrue([report writeToReportDirectoryIfRequested:&error], @"%@", error);
+  return report;
+}
+
+- (void)testReplayFlingAt60And120Hz {
+  // Given
+  MDCScrollTrace *trace =
+      [MDCScrollTrace decelerationTraceFromContentOffset:CGPointMake(0, -128)
+                                                velocity:CGPointMake(0, 2500)
+                                        decelerationRate:UIScrollViewDecelerationRateNormal
+                                          sampleInterval:1.0 / 120.0];
+
+  for (NSNumber *frameRate in @[ @60, @120 ]) {
+    // When
+    MDCScrollTraceReport *report = [self replayTrace:trace
+                                                name:@"FlexibleHeaderFling"
+                                           frameRate:frameRate.integerValue];
+
+    // Then
+    XCTAssertGreaterThan(report.frameCount, 0U);
+    XCTAssertGreaterThan(report.totalFrameCommitCount, 0U);
+    XCTAssertLessThanOrEqual(report.totalFrameCommitCount, report.frameCount,
+                             @"The header should commit its frame at most once per frame.");
+  }
+}
+
+- (void)testReplayStationaryTraceCommitsNothing {
+  // Given
+  MDCScrollTrace *trace = [MDCScrollTrace traceWithContentOffsetYs:@[ @200, @200, @200, @200 ]
+                                                    sampleInterval:1.0 / 60.0];
+
+  // When
+  MDCScrollTraceReport *report = [self replayTrace:trace
+                                              name:@"FlexibleHeaderStationary"
+                                         frameRate:120];
+
+  // Then
+  XCTAssertLessThanOrEqual(report.totalFrameCommitCount, 1U,
+                           @"Only the first frame's offset change should commit a frame.");
+}
+
+@end
@@ -0,0 +1,243 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "../../src/private/MDCFlexibleHeaderDisplayLink.h"
+#import "../../src/private/MDCFlexibleHeaderShiftCurve.h"
+#import "MaterialFlexibleHeader.h"
+
+// Sampling interval of the recorded scroll trace and of the replayed animation frames.
+static const CFTimeInterval kFrameInterval120Hz = 1.0 / 120.0;
+static const CFTimeInterval kFrameInterval60Hz = 1.0 / 60.0;
+
+// A recorded scroll gesture, as content offset deltas sampled at 120Hz: a fast upward swipe that
+// decays, the finger resting on the screen, then a slower swipe back down that partially reveals
+// the header before the finger lifts.
+static const CGFloat kRecordedScrollTrace[] = {
+    18, 18, 17, 17, 16, 16, 15, 15, 14, 14, 13, 13, 12, 12, 11, 11, 10, 10, 9, 9,
+    8, 8, 7, 7, 6, 6, 5, 5, 4, 4, 3, 3, 2, 2, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    -6, -7, -8, -9, -10, -11, -12, -12, -12, -12, -12, -12, -12, -12, -12, -11, -10, -9, -8, -3,
+};
+
+@interface MDCFlexibleHeaderView (ShiftAnimationTesting)
+- (void)fhv_advanceShiftAnimationWithFrameTimestamp:(CFTimeInterval)timestamp
+                                    targetTimestamp:(CFTimeInterval)targetTimestamp;
+@end
+
+@interface FlexibleHeaderShiftAnimationTestsFrameRecorder : NSObject <MDCFlexibleHeaderViewDelegate>
+@property(nonatomic, readonly) NSMutableArray<NSNumber *> *frameOrigins;
+@end
+
+@implementation FlexibleHeaderShiftAnimationTestsFrameRecorder
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _frameOrigins = [NSMutableArray array];
+  }
+  return self;
+}
+
+- (void)flexibleHeaderViewNeedsStatusBarAppearanceUpdate:(MDCFlexibleHeaderView *)headerView {
+}
+
+- (void)flexibleHeaderViewFrameDidChange:(MDCFlexibleHeaderView *)headerView {
+  [self.frameOrigins addObject:@(CGRectGetMinY(headerView.frame))];
+}
+
+@end
+
+@interface FlexibleHeaderShiftAnimationTests : XCTestCase
+@end
+
+@implementation FlexibleHeaderShiftAnimationTests
+
+/**
+ Creates a header tracking a tall scroll view, replays kRecordedScrollTrace against it and then lets
+ go of the scroll view, leaving the header partially shifted and animating back on-screen.
+ */
+- (MDCFlexibleHeaderView *)headerAfterReplayingTraceWithRecorder:
+    (FlexibleHeaderShiftAnimationTestsFrameRecorder *)recorder {
+  MDCFlexibleHeaderView *header = [[MDCFlexibleHeaderView alloc] init];
+  header.frame = CGRectMake(0, 0, 320, 56);
+  header.shiftBehavior = MDCFlexibleHeaderShiftBehaviorEnabled;
+
+  UIScrollView *scrollView = [[UIScrollView alloc] initWithFrame:CGRectMake(0, 0, 320, 480)];
+  scrollView.contentSize = CGSizeMake(320, 10000);
+  header.trackingScrollView = scrollView;
+  [header trackingScrollViewDidScroll];
+  header.delegate = recorder;
+
+  CGPoint contentOffset = scrollView.contentOffset;
+  for (size_t i = 0; i < sizeof(kRecordedScrollTrace) / sizeof(kRecordedScrollTrace[0]); ++i) {
+    contentOffset.y += kRecordedScrollTrace[i];
+    scrollView.contentOffset = contentOffset;
+    [header trackingScrollViewDidScroll];
+  }
+  [header trackingScrollViewDidEndDraggingWillDecelerate:NO];
+  return header;
+}
+
+/** Advances the header's shift animation at a fixed frame rate until it settles. */
+- (void)settleHeader:(MDCFlexibleHeaderView *)header frameInterval:(CFTimeInterval)frameInterval {
+  CFTimeInterval timestamp = 1000;
+  NSUInteger frameCount = 0;
+  MDCFlexibleHeaderDisplayLink *displayLink = [MDCFlexibleHeaderDisplayLink sharedDisplayLink];
+  while ([displayLink containsObserver:header] && frameCount < 1000) {
+    [header fhv_advanceShiftAnimationWithFrameTimestamp:timestamp
+                                        targetTimestamp:timestamp + frameInterval];
+    timestamp += frameInterval;
+    ++frameCount;
+  }
+}
+
+#pragma mark - Curve
+
+- (void)testCurveStartsAtOriginAndSettlesAtDestination {
+  // When
+  NSTimeInterval duration = MDCFlexibleHeaderShiftCurveDuration(56, 0);
+
+  // Then
+  XCTAssertGreaterThan(duration, 0);
+  XCTAssertEqualWithAccuracy(MDCFlexibleHeaderShiftCurveValue(56, 0, 0), 56, 0.0001);
+  XCTAssertEqualWithAccuracy(MDCFlexibleHeaderShiftCurveValue(56, 0, duration), 0, 0.0001);
+  XCTAssertEqual(MDCFlexibleHeaderShiftCurveDuration(0, MDCFlexibleHeaderShiftCurveEpsilon), 0);
+}
+
+- (void)testCurveIsMonotonic {
+  // Given
+  CGFloat previousValue = 56;
+  NSTimeInterval duration = MDCFlexibleHeaderShiftCurveDuration(56, 0);
+
+  for (NSTimeInterval elapsed = 0; elapsed <= duration; elapsed += kFrameInterval120Hz) {
+    // When
+    CGFloat value = MDCFlexibleHeaderShiftCurveValue(56, 0, elapsed);
+
+    // Then
+    XCTAssertLessThanOrEqual(value, previousValue);
+    previousValue = value;
+  }
+}
+
+#pragma mark - Display link
+
+- (void)testNestedHeadersShareOneDisplayLink {
+  // Given
+  MDCFlexibleHeaderView *outerHeader = [[MDCFlexibleHeaderView alloc] init];
+  MDCFlexibleHeaderView *innerHeader = [[MDCFlexibleHeaderView alloc] init];
+  [outerHeader addSubview:innerHeader];
+  MDCFlexibleHeaderDisplayLink *displayLink = [MDCFlexibleHeaderDisplayLink sharedDisplayLink];
+
+  // When
+  [outerHeader shiftHeaderOffScreenAnimated:YES];
+  [innerHeader shiftHeaderOffScreenAnimated:YES];
+
+  // Then
+  XCTAssertEqual(displayLink.observerCount, 2U);
+  XCTAssertTrue(displayLink.isRunning);
+
+  // When
+  [outerHeader shiftHeaderOnScreenAnimated:NO];
+  [self settleHeader:outerHeader frameInterval:kFrameInterval120Hz];
+  [self settleHeader:innerHeader frameInterval:kFrameInterval120Hz];
+
+  // Then
+  XCTAssertEqual(displayLink.observerCount, 0U);
+  XCTAssertFalse(displayLink.isRunning);
+}
+
+#pragma mark - Trace replay
+
+- (void)testReplayIsDeterministic {
+  // Given
+  FlexibleHeaderShiftAnimationTestsFrameRecorder *firstRecorder =
+      [[FlexibleHeaderShiftAnimationTestsFrameRecorder alloc] init];
+  FlexibleHeaderShiftAnimationTestsFrameRecorder *secondRecorder =
+      [[FlexibleHeaderShiftAnimationTestsFrameRecorder alloc] init];
+
+  // When
+  MDCFlexibleHeaderView *firstHeader = [self headerAfterReplayingTraceWithRecorder:firstRecorder];
+  [self settleHeader:firstHeader frameInterval:kFrameInterval120Hz];
+  MDCFlexibleHeaderView *secondHeader = [self headerAfterReplayingTraceWithRecorder:secondRecorder];
+  [self settleHeader:secondHeader frameInterval:kFrameInterval120Hz];
+
+  // Then
+  XCTAssertGreaterThan(firstRecorder.frameOrigins.count, 0U);
+  XCTAssertEqualObjects(firstRecorder.frameOrigins, secondRecorder.frameOrigins);
+  XCTAssertEqualWithAccuracy(CGRectGetMinY(firstHeader.frame), 0, 0.0001);
+}
+
+- (void)testAnimationFollowsTheSameCurveAt60And120Hz {
+  // Given
+  FlexibleHeaderShiftAnimationTestsFrameRecorder *recorder60Hz =
+      [[FlexibleHeaderShiftAnimationTestsFrameRecorder alloc] init];
+  FlexibleHeaderShiftAnimationTestsFrameRecorder *recorder120Hz =
+      [[FlexibleHeaderShiftAnimationTestsFrameRecorder alloc] init];
+  MDCFlexibleHeaderView *header60Hz = [self headerAfterReplayingTraceWithRecorder:recorder60Hz];
+  MDCFlexibleHeaderView *header120Hz = [self headerAfterReplayingTraceWithRecorder:recorder120Hz];
+  NSUInteger replayFrameCount = recorder60Hz.frameOrigins.count;
+  XCTAssertLessThan(CGRectGetMinY(header60Hz.frame), 0, @"The trace should end partially shifted.");
+
+  // When
+  [self settleHeader:header60Hz frameInterval:kFrameInterval60Hz];
+  [self settleHeader:header120Hz frameInterval:kFrameInterval120Hz];
+
+  // Then
+  NSArray<NSNumber *> *animation60Hz = [recorder60Hz.frameOrigins
+      subarrayWithRange:NSMakeRange(replayFrameCount, recorder60Hz.frameOrigins.count -
+                                                          replayFrameCount)];
+  NSArray<NSNumber *> *animation120Hz = [recorder120Hz.frameOrigins
+      subarrayWithRange:NSMakeRange(replayFrameCount, recorder120Hz.frameOrigins.count -
+                                                          replayFrameCount)];
+  XCTAssertGreaterThan(animation120Hz.count, animation60Hz.count);
+  for (NSUInteger i = 0; i + 1 < animation60Hz.count; ++i) {
+    // Every 60Hz frame is displayed at the same time as every other 120Hz frame.
+    XCTAssertEqualWithAccuracy(animation60Hz[i].doubleValue, animation120Hz[2 * i + 1].doubleValue,
+                               0.001);
+  }
+}
+
+- (void)testRestingFingerDoesNotCommitFrames {
+  // Given
+  FlexibleHeaderShiftAnimationTestsFrameRecorder *recorder =
+      [[FlexibleHeaderShiftAnimationTestsFrameRecorder alloc] init];
+  size_t traceLength = sizeof(kRecordedScrollTrace) / sizeof(kRecordedScrollTrace[0]);
+  size_t restingSampleCount = 0;
+  for (size_t i = 0; i < traceLength; ++i) {
+    if (kRecordedScrollTrace[i] == 0) {
+      ++restingSampleCount;
+    }
+  }
+
+  // When
+  [self headerAfterReplayingTraceWithRecorder:recorder];
+
+  // Then
+  XCTAssertEqual(recorder.frameOrigins.count, traceLength - restingSampleCount);
+}
+
+- (void)testReplayPerformance {
+  [self measureBlock:^{
+    for (NSUInteger i = 0; i < 20; ++i) {
+      FlexibleHeaderShiftAnimationTestsFrameRecorder *recorder =
+          [[FlexibleHeaderShiftAnimationTestsFrameRecorder alloc] init];
+      MDCFlexibleHeaderView *header = [self headerAfterReplayingTraceWithRecorder:recorder];
+      [self settleHeader:header frameInterval:kFrameInterval120Hz];
+    }
+  }];
+}
+
+@end
@@ -16,6 +16,7 @@
 
 #import <MDFInternationalization/MDFInternationalization.h>
 #import <objc/runtime.h>
+#import <os/signpost.h>
 
 #import <MDFTextAccessibility/MDFTextAccessibility.h>
 #import "MaterialButtonBar.h"
@@ -29,6 +30,16 @@ static const CGFloat kNavigationBarMinHeight = 24;
 // KVO contexts
 static char *const kKVOContextMDCNavigationBar = "kKVOContextMDCNavigationBar";
 
+/** The log of the navigation bar's layout signposts, for profiling header layout in Instruments. */
+static os_log_t MDCNavigationBarLayoutLog(void) API_AVAILABLE(ios(12.0)) {
+  static os_log_t log;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    log = os_log_create("com.google.MaterialComponents", "HeaderLayout");
+  });
+  return log;
+}
+
 static NSArray<NSString *> *MDCNavigationBarNavigationItemKVOPaths(void) {
   static dispatch_once_t onceToken;
   static NSArray<NSString *> *forwardingKeyPaths = nil;
@@ -120,6 +131,16 @@ static NSArray<NSString *> *MDCNavigationBarNavigationItemKVOPaths(void) {
   MDCButtonBar *_trailingButtonBar;
 
   __weak UIViewController *_watchingViewController;
+
+  // The inputs and results of the last title measurement. The title is measured as a single line,
+  // so it only needs to be measured again when the title, its font or the available width change.
+  NSString *_measuredTitle;
+  UIFont *_measuredTitleFont;
+  NSLineBreakMode _measuredTitleLineBreakMode;
+  CGSize _measuredTitleBoundingSize;
+  CGSize _measuredTitleSize;
+  CGSize _measuredTitleLabelBoundsSize;
+  CGFloat _measuredTitleTextRectHeight;
 }
 
 @synthesize leadingBarButtonItems = _leadingBarButtonItems;
@@ -237,6 +258,11 @@ static NSArray<NSString *> *MDCNavigationBarNavigationItemKVOPaths(void) {
 - (void)layoutSubviews {
   [super layoutSubviews];
 
+  if (@available(iOS 12.0, *)) {
+    os_signpost_interval_begin(MDCNavigationBarLayoutLog(), OS_SIGNPOST_ID_EXCLUSIVE,
+                               "MDCNavigationBar layout");
+  }
+
   // For pre iOS 11 devices, it's safe to assume that the Safe Area insets' left and right
   // values are zero. DO NOT use this to get the top or bottom Safe Area insets.
   UIEdgeInsets RTLFriendlySafeAreaInsets = UIEdgeInsetsZero;
@@ -275,19 +301,7 @@ static NSArray<NSString *> *MDCNavigationBarNavigationItemKVOPaths(void) {
   }
 
   // Layout TitleLabel
-  NSMutableParagraphStyle *paraStyle = [[NSMutableParagraphStyle alloc] init];
-  paraStyle.lineBreakMode = _titleLabel.lineBreakMode;
-
-  NSDictionary<NSString *, id> *attributes =
-      @{NSFontAttributeName : _titleLabel.font, NSParagraphStyleAttributeName : paraStyle};
-
-  CGSize titleSize = [_titleLabel.text boundingRectWithSize:textFrame.size
-                                                    options:NSStringDrawingTruncatesLastVisibleLine
-                                                 attributes:attributes
-                                                    context:NULL]
-                         .size;
-  titleSize.width = MDCCeil(titleSize.width);
-  titleSize.height = MDCCeil(titleSize.height);
+  CGSize titleSize = [self titleSizeThatFits:textFrame.size];
   CGRect titleFrame = CGRectMake(textFrame.origin.x, 0, titleSize.width, titleSize.height);
   if (self.mdf_effectiveUserInterfaceLayoutDirection == UIUserInterfaceLayoutDirectionRightToLeft) {
     titleFrame = MDFRectFlippedHorizontally(titleFrame, CGRectGetWidth(self.bounds));
@@ -333,8 +347,7 @@ static NSArray<NSString *> *MDCNavigationBarNavigationItemKVOPaths(void) {
 
   // Button and title label alignment
 
-  CGFloat titleTextRectHeight =
-      [_titleLabel textRectForBounds:_titleLabel.bounds limitedToNumberOfLines:0].size.height;
+  CGFloat titleTextRectHeight = [self titleTextRectHeight];
 
   if (_titleLabel.hidden || titleTextRectHeight <= 0) {
     _leadingButtonBar.buttonTitleBaseline = 0;
@@ -347,6 +360,11 @@ static NSArray<NSString *> *MDCNavigationBarNavigationItemKVOPaths(void) {
     _leadingButtonBar.buttonTitleBaseline = titleBaseline;
     _trailingButtonBar.buttonTitleBaseline = titleBaseline;
   }
+
+  if (@available(iOS 12.0, *)) {
+    os_signpost_interval_end(MDCNavigationBarLayoutLog(), OS_SIGNPOST_ID_EXCLUSIVE,
+                             "MDCNavigationBar layout");
+  }
 }
 
 - (CGSize)sizeThatFits:(CGSize)size {
@@ -371,6 +389,63 @@ static NSArray<NSString *> *MDCNavigationBarNavigationItemKVOPaths(void) {
 
 #pragma mark Private
 
+/** Returns YES if the last title measurement was made with the current title and font. */
+- (BOOL)isTitleMeasurementValid {
+  NSString *title = _titleLabel.text;
+  return _measuredTitleFont != nil && _measuredTitleLineBreakMode == _titleLabel.lineBreakMode &&
+         (_measuredTitle == title || [_measuredTitle isEqualToString:title]) &&
+         [_measuredTitleFont isEqual:_titleLabel.font];
+}
+
+- (CGSize)titleSizeThatFits:(CGSize)size {
+  // A single line never grows taller than its natural height, so any height at least as tall as
+  // the measured title gives the same result.
+  if ([self isTitleMeasurementValid] && _measuredTitleBoundingSize.width == size.width &&
+      _measuredTitleBoundingSize.height >= _measuredTitleSize.height &&
+      size.height >= _measuredTitleSize.height) {
+    return _measuredTitleSize;
+  }
+
+  CGSize titleSize = [self measureTitleSizeThatFits:size];
+  _measuredTitle = [_titleLabel.text copy];
+  _measuredTitleFont = _titleLabel.font;
+  _measuredTitleLineBreakMode = _titleLabel.lineBreakMode;
+  _measuredTitleBoundingSize = size;
+  _measuredTitleSize = titleSize;
+  _measuredTitleLabelBoundsSize = CGSizeMake(-1, -1);
+  return titleSize;
+}
+
+/** Measures the title within @c size, without consulting the last measurement. */
+- (CGSize)measureTitleSizeThatFits:(CGSize)size {
+  NSMutableParagraphStyle *paraStyle = [[NSMutableParagraphStyle alloc] init];
+  paraStyle.lineBreakMode = _titleLabel.lineBreakMode;
+
+  NSDictionary<NSString *, id> *attributes =
+      @{NSFontAttributeName : _titleLabel.font, NSParagraphStyleAttributeName : paraStyle};
+
+  CGSize titleSize = [_titleLabel.text boundingRectWithSize:size
+                                                    options:NSStringDrawingTruncatesLastVisibleLine
+                                                 attributes:attributes
+                                                    context:NULL]
+                         .size;
+  titleSize.width = MDCCeil(titleSize.width);
+  titleSize.height = MDCCeil(titleSize.height);
+  return titleSize;
+}
+
+/** The height of the title label's text within its current bounds. */
+- (CGFloat)titleTextRectHeight {
+  CGSize boundsSize = _titleLabel.bounds.size;
+  if (![self isTitleMeasurementValid] ||
+      !CGSizeEqualToSize(boundsSize, _measuredTitleLabelBoundsSize)) {
+    _measuredTitleTextRectHeight =
+        [_titleLabel textRectForBounds:_titleLabel.bounds limitedToNumberOfLines:0].size.height;
+    _measuredTitleLabelBoundsSize = boundsSize;
+  }
+  return _measuredTitleTextRectHeight;
+}
+
 + (NSTextAlignment)textAlignmentFromTitleAlignment:(MDCNavigationBarTitleAlignment)titleAlignment {
   switch (titleAlignment) {
     case MDCNavigationBarTitleAlignmentCenter:
@@ -761,6 +836,18 @@ static NSArray<NSString *> *MDCNavigationBarNavigationItemKVOPaths(void) {
   _trailingButtonBar.enableRippleBehavior = enableRippleBehavior;
 }
 
+- (void)didMoveToSuperview {
+  [super didMoveToSuperview];
+
+  [self mdc_elevationHierarchyDidChange];
+}
+
+- (void)didMoveToWindow {
+  [super didMoveToWindow];
+
+  [self mdc_elevationHierarchyDidChange];
+}
+
 - (CGFloat)mdc_currentElevation {
   return 0;
 }
@@ -0,0 +1,141 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialButtonBar.h"
+#import "MaterialNavigationBar.h"
+
+/** The number of frames in a simulated header height animation. */
+static const NSUInteger kScrollFrameCount = 60;
+
+@interface MDCNavigationBar (MeasurementCounting)
+@property(nonatomic, readonly) UILabel *titleLabel;
+- (MDCButtonBar *)leadingButtonBar;
+- (MDCButtonBar *)trailingButtonBar;
+- (CGSize)measureTitleSizeThatFits:(CGSize)size;
+@end
+
+/** A navigation bar that counts how many times it measures its title. */
+@interface MeasurementCountingNavigationBar : MDCNavigationBar
+@property(nonatomic, assign) NSUInteger titleMeasurementCount;
+@end
+
+@implementation MeasurementCountingNavigationBar
+
+- (CGSize)measureTitleSizeThatFits:(CGSize)size {
+  self.titleMeasurementCount += 1;
+  return [super measureTitleSizeThatFits:size];
+}
+
+@end
+
+@interface NavigationBarMeasurementCountTests : XCTestCase
+@property(nonatomic, strong, nullable) MeasurementCountingNavigationBar *navigationBar;
+@end
+
+@implementation NavigationBarMeasurementCountTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.navigationBar =
+      [[MeasurementCountingNavigationBar alloc] initWithFrame:CGRectMake(0, 0, 375, 56)];
+  self.navigationBar.title = @"Inbox";
+  self.navigationBar.leadingBarButtonItems = @[ [self itemWithTitle:@"Menu"] ];
+  self.navigationBar.trailingBarButtonItems =
+      @[ [self itemWithTitle:@"Search"], [self itemWithTitle:@"More"] ];
+  [self.navigationBar layoutIfNeeded];
+}
+
+- (void)tearDown {
+  self.navigationBar = nil;
+
+  [super tearDown];
+}
+
+- (UIBarButtonItem *)itemWithTitle:(NSString *)title {
+  return [[UIBarButtonItem alloc] initWithTitle:title
+                                          style:UIBarButtonItemStylePlain
+                                         target:nil
+                                         action:nil];
+}
+
+/** Lays the navigation bar out at the heights a header stack view gives it while scrolling. */
+- (void)scrollHeader {
+  for (NSUInteger frame = 0; frame < kScrollFrameCount; ++frame) {
+    CGRect bounds = self.navigationBar.bounds;
+    bounds.size.height = 56 + (CGFloat)frame * 2;
+    self.navigationBar.bounds = bounds;
+    [self.navigationBar layoutIfNeeded];
+    [self.navigationBar.leadingButtonBar layoutIfNeeded];
+    [self.navigationBar.trailingButtonBar layoutIfNeeded];
+  }
+}
+
+- (void)testScrollFramesDoNotMeasureTheTitleAgain {
+  // Given
+  NSUInteger titleMeasurementCount = self.navigationBar.titleMeasurementCount;
+
+  // When
+  [self scrollHeader];
+
+  // Then
+  XCTAssertEqual(titleMeasurementCount, 1U);
+  XCTAssertEqual(self.navigationBar.titleMeasurementCount, titleMeasurementCount);
+}
+
+- (void)testChangingTheTitleMeasuresItOnce {
+  // Given
+  NSUInteger titleMeasurementCount = self.navigationBar.titleMeasurementCount;
+
+  // When
+  self.navigationBar.title = @"Archive";
+  [self scrollHeader];
+
+  // Then
+  XCTAssertEqual(self.navigationBar.titleMeasurementCount, titleMeasurementCount + 1);
+}
+
+- (void)testChangingTheWidthMeasuresTheTitleOnce {
+  // Given
+  NSUInteger titleMeasurementCount = self.navigationBar.titleMeasurementCount;
+
+  // When
+  self.navigationBar.frame = CGRectMake(0, 0, 667, 56);
+  [self scrollHeader];
+
+  // Then
+  XCTAssertEqual(self.navigationBar.titleMeasurementCount, titleMeasurementCount + 1);
+}
+
+- (void)testCachedTitleLayoutMatchesAFreshLayout {
+  // Given
+  [self scrollHeader];
+  CGRect cachedTitleFrame = self.navigationBar.titleLabel.frame;
+
+  // When
+  MDCNavigationBar *freshNavigationBar =
+      [[MDCNavigationBar alloc] initWithFrame:self.navigationBar.frame];
+  freshNavigationBar.title = self.navigationBar.title;
+  freshNavigationBar.leadingBarButtonItems = self.navigationBar.leadingBarButtonItems;
+  freshNavigationBar.trailingBarButtonItems = self.navigationBar.trailingBarButtonItems;
+  [freshNavigationBar layoutIfNeeded];
+
+  // Then
+  XCTAssertTrue(CGRectEqualToRect(cachedTitleFrame, freshNavigationBar.titleLabel.frame));
+}
+
+@end
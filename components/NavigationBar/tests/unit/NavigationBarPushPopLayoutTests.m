@@ -0,0 +1,83 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialNavigationBar.h"
+
+/** The number of push and pop transitions in the benchmark. */
+static const NSUInteger kTransitionCount = 200;
+
+@interface NavigationBarPushPopLayoutTests : XCTestCase
+@property(nonatomic, strong, nullable) MDCNavigationBar *navigationBar;
+@end
+
+@implementation NavigationBarPushPopLayoutTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.navigationBar = [[MDCNavigationBar alloc] initWithFrame:CGRectMake(0, 0, 375, 56)];
+}
+
+- (void)tearDown {
+  [self.navigationBar unobserveNavigationItem];
+  self.navigationBar = nil;
+
+  [super tearDown];
+}
+
+- (UIBarButtonItem *)itemWithTitle:(NSString *)title {
+  return [[UIBarButtonItem alloc] initWithTitle:title
+                                          style:UIBarButtonItemStylePlain
+                                         target:nil
+                                         action:nil];
+}
+
+/** A navigation item like those of the view controllers in an app bar navigation controller. */
+- (UINavigationItem *)navigationItemWithTitle:(NSString *)title {
+  UINavigationItem *navigationItem = [[UINavigationItem alloc] initWithTitle:title];
+  navigationItem.leftBarButtonItems = @[ [self itemWithTitle:@"Back"] ];
+  navigationItem.rightBarButtonItems = @[
+    [self itemWithTitle:@"Edit"], [self itemWithTitle:@"Share"], [self itemWithTitle:@"More"]
+  ];
+  return navigationItem;
+}
+
+- (void)testPushAndPopLayoutPerformance {
+  // Given
+  UINavigationItem *rootItem = [self navigationItemWithTitle:@"Inbox"];
+  UINavigationItem *detailItem = [self navigationItemWithTitle:@"Message"];
+
+  // When
+  [self measureBlock:^{
+    for (NSUInteger transition = 0; transition < kTransitionCount; ++transition) {
+      [self.navigationBar observeNavigationItem:(transition % 2 == 0) ? detailItem : rootItem];
+      [self.navigationBar setNeedsLayout];
+      [self.navigationBar layoutIfNeeded];
+
+      // Layout passes without item changes, e.g. during the transition animation.
+      for (NSUInteger pass = 0; pass < 4; ++pass) {
+        [self.navigationBar setNeedsLayout];
+        [self.navigationBar layoutIfNeeded];
+      }
+    }
+  }];
+
+  // Then
+  XCTAssertEqualObjects(self.navigationBar.title, rootItem.title);
+}
+
+@end
@@ -74,6 +74,18 @@
   _lastOffset = NSNotFound;
 }
 
+- (void)viewDidLoad {
+  [super viewDidLoad];
+
+  [self.view mdc_elevationHierarchyDidChange];
+}
+
+- (void)viewWillAppear:(BOOL)animated {
+  [super viewWillAppear:animated];
+
+  [self.view mdc_elevationHierarchyDidChange];
+}
+
 - (void)viewWillLayoutSubviews {
   [super viewWillLayoutSubviews];
   if (!_isMaskAppliedFirstTime) {
@@ -26,16 +26,15 @@ static const CGFloat kHeaderAnimationDistanceAddedDistanceFromTopSafeAreaInset =
 // This epsilon is defined in units of screen points, and is supposed to be as small as possible
 // yet meaningful for comparison calculations.
 static const CGFloat kEpsilon = (CGFloat)0.001;
-// The buffer for the drawer's scroll view is neeeded to ensure that the KVO receiving the new
-// content offset, which is then changing the content offset of the tracking scroll view, will
-// be able to provide a value as if the scroll view is scrolling at natural speed. This is needed
-// as in cases where the drawer shows in full screen, the scroll offset is 0, and then the scrolling
-// has the behavior as if we are scrolling at the end of the content, and the scrolling isn't
-// smooth.
+// The buffer for the drawer's scroll view is neeeded to ensure that the scroll callback receiving
+// the new content offset, which is then changing the content offset of the tracking scroll view,
+// will be able to provide a value as if the scroll view is scrolling at natural speed. This is
+// needed as in cases where the drawer shows in full screen, the scroll offset is 0, and then the
+// scrolling has the behavior as if we are scrolling at the end of the content, and the scrolling
+// isn't smooth.
 static const CGFloat kScrollViewBufferForPerformance = 20;
 static const CGFloat kDragVelocityThresholdForHidingDrawer = -2;
 static const CGFloat kInitialDrawerHeightFactor = (CGFloat)0.5;
-static NSString *const kContentOffsetKeyPath = @"contentOffset";
 NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
     @"kMDCBottomDrawerScrollViewAccessibilityIdentifier";
 
@@ -70,6 +69,51 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
 
 @end
 
+/**
+ The layout values derived from the cached layout calculations that are needed on every content
+ offset change.
+
+ The model is rebuilt lazily after the layout calculations are recached, or when one of the inputs
+ it was built from changes, so that scrolling the drawer only performs arithmetic on these values
+ instead of re-deriving them from the header, the presenting view and the safe area on every frame.
+ */
+typedef struct MDCBottomDrawerLayoutModel {
+  BOOL valid;
+
+  // The inputs the model was built from.
+  CGRect presentingViewBounds;
+  BOOL hasHeader;
+  BOOL presentsFullScreen;
+
+  CGFloat contentHeaderTopInset;
+  CGFloat contentHeightSurplus;
+  CGFloat contentHeaderHeight;
+  CGFloat topHeaderHeight;
+  CGFloat topSafeAreaInset;
+  CGFloat addedContentHeightThreshold;
+  BOOL contentReachesFullscreen;
+  CGFloat transitionCompleteContentOffset;
+  CGFloat headerAnimationDistance;
+
+  // The top area inset of the header used by the tracking scroll view logic, which is always a
+  // positive non zero value.
+  CGFloat trackingTopAreaInsetForHeader;
+} MDCBottomDrawerLayoutModel;
+
+/** Returns the transition percentage for @c contentOffsetY, see
+ -transitionPercentageForContentOffset:offset:distance:. */
+static CGFloat MDCBottomDrawerTransitionPercentage(const MDCBottomDrawerLayoutModel *model,
+                                                   CGFloat contentOffsetY, CGFloat offset,
+                                                   CGFloat distance) {
+  // If the distance is 0 or negative there is no distance for a transition to occur and therefore
+  // it is set to 1 (100%).
+  if (distance <= 0) {
+    return 1;
+  }
+  return 1 - MAX(0, MIN(1, (model->transitionCompleteContentOffset - contentOffsetY - offset) /
+                               distance));
+}
+
 @interface MDCBottomDrawerContainerViewController (LayoutCalculations)
 
 /**
@@ -85,9 +129,15 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
 // An added height for the scroll view bottom inset.
 @property(nonatomic, readonly) CGFloat addedContentHeight;
 
+// The layout model built from the cached layout calculations.
+@property(nonatomic, readonly) MDCBottomDrawerLayoutModel layoutModel;
+
 // Updates and caches the layout calculations.
 - (void)cacheLayoutCalculations;
 
+// Discards the cached layout calculations, so they are recalculated when next needed.
+- (void)invalidateLayoutCalculations;
+
 /**
  Returns the percentage of the transition animation for a given content offset.
  The transition animation, as defined here, occurs either when the content reaches fullscreen or
@@ -141,7 +191,7 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
 
 @interface MDCBottomDrawerContainerViewController () <UIScrollViewDelegate>
 
-// Whether the scroll view is observed via KVO.
+// Whether content offset changes of the scroll view update the drawer.
 @property(nonatomic) BOOL scrollViewObserved;
 
 // The scroll view is currently being dragged towards bottom.
@@ -181,6 +231,9 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
   CGFloat _headerVCPerferredContentSizeHeightCached;
   CGFloat _scrollToContentOffsetY;
   BOOL _shouldPresentAtFullscreen;
+  MDCBottomDrawerLayoutModel _layoutModel;
+  CGPoint _lastContentOffset;
+  BOOL _isUpdatingForContentOffset;
 }
 
 - (instancetype)initWithOriginalPresentingViewController:
@@ -208,7 +261,6 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
 }
 
 - (void)dealloc {
-  [self removeScrollViewObserver];
   [self.headerShadowLayer removeFromSuperlayer];
   self.headerShadowLayer = nil;
   [[NSNotificationCenter defaultCenter] removeObserver:self];
@@ -245,53 +297,62 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
   return locationInView < contentOriginYConverted;
 }
 
-#pragma mark - KVO
-
-- (void)observeValueForKeyPath:(NSString *)keyPath
-                      ofObject:(id)object
-                        change:(NSDictionary *)change
-                       context:(void *)context {
-  if ([object isKindOfClass:[UIScrollView class]]) {
-    CGPoint contentOffset = [(NSValue *)[change objectForKey:NSKeyValueChangeNewKey] CGPointValue];
-    CGPoint oldContentOffset =
-        [(NSValue *)[change objectForKey:NSKeyValueChangeOldKey] CGPointValue];
-    self.scrollViewIsDraggedToBottom = contentOffset.y == oldContentOffset.y
-                                           ? self.scrollViewIsDraggedToBottom
-                                           : contentOffset.y < oldContentOffset.y;
-
-    // The normalized content offset takes the content offset and updates it if using the
-    // performance logic that comes with setting the tracking scroll view. The reason we update
-    // the content offset is because the performance logic stops the scrolling internally of the
-    // main scroll view using the bounds origin, and we don't want the view update with content
-    // offset to use the outdated content offset of the main scroll view, so we update it
-    // accordingly.
-    CGPoint normalizedContentOffset = contentOffset;
-    if (self.trackingScrollView != nil) {
-      normalizedContentOffset.y = [self updateContentOffsetForPerformantScrolling:contentOffset.y];
-    }
+#pragma mark - Content Offset Changes
+
+/**
+ Updates the drawer for the current content offset of the scroll view.
+
+ This is driven by the scroll view's own per-frame scroll callback rather than by KVO, so a frame
+ costs a single update computed from the precomputed layout model. Changes the update itself makes
+ to the scroll view's bounds are not fed back into another update.
+ */
+- (void)scrollViewContentOffsetDidChange {
+  if (!self.scrollViewObserved || _isUpdatingForContentOffset) {
+    return;
+  }
+  _isUpdatingForContentOffset = YES;
 
-    [self updateViewWithContentOffset:normalizedContentOffset];
+  CGPoint contentOffset = self.scrollView.contentOffset;
+  if (contentOffset.y != _lastContentOffset.y) {
+    self.scrollViewIsDraggedToBottom = contentOffset.y < _lastContentOffset.y;
   }
+
+  MDCBottomDrawerLayoutModel layoutModel = self.layoutModel;
+
+  // The normalized content offset takes the content offset and updates it if using the
+  // performance logic that comes with setting the tracking scroll view. The reason we update
+  // the content offset is because the performance logic stops the scrolling internally of the
+  // main scroll view using the bounds origin, and we don't want the view update with content
+  // offset to use the outdated content offset of the main scroll view, so we update it
+  // accordingly.
+  CGPoint normalizedContentOffset = contentOffset;
+  if (self.trackingScrollView != nil) {
+    normalizedContentOffset.y = [self updateContentOffsetForPerformantScrolling:contentOffset.y
+                                                                    layoutModel:&layoutModel];
+  }
+
+  [self updateViewWithContentOffset:normalizedContentOffset layoutModel:&layoutModel];
+
+  _lastContentOffset = self.scrollView.contentOffset;
+  _isUpdatingForContentOffset = NO;
 }
 
-- (CGFloat)updateContentOffsetForPerformantScrolling:(CGFloat)contentYOffset {
+- (CGFloat)updateContentOffsetForPerformantScrolling:(CGFloat)contentYOffset
+                                         layoutModel:(const MDCBottomDrawerLayoutModel *)model {
   CGFloat normalizedYContentOffset = contentYOffset;
-  CGFloat topAreaInsetForHeader = (self.headerViewController ? MDCDeviceTopSafeAreaInset() : 0);
   // The top area inset for header should be a positive non zero value for the algorithm to
   // correctly work when the drawer is presented in full screen and there is no top inset.
   // The reason being is that otherwise there would be a conflict between if the drawer is currently
   // in full screen and we should move the header view outside the scrollview to remain sticky, or
   // if we aren't in full screen and need the header view to be scrolled as part of the scrolling.
-  if (self.contentHeaderTopInset <= topAreaInsetForHeader + kEpsilon) {
-    topAreaInsetForHeader = kEpsilon;
-  }
+  CGFloat topAreaInsetForHeader = model->trackingTopAreaInsetForHeader;
   CGFloat drawerOffset =
-      self.contentHeaderTopInset - topAreaInsetForHeader + kScrollViewBufferForPerformance;
-  CGFloat headerHeightWithoutInset = self.contentHeaderHeight - topAreaInsetForHeader;
+      model->contentHeaderTopInset - topAreaInsetForHeader + kScrollViewBufferForPerformance;
+  CGFloat headerHeightWithoutInset = model->contentHeaderHeight - topAreaInsetForHeader;
   CGFloat contentDiff = contentYOffset - drawerOffset;
   CGFloat maxScrollOrigin = self.trackingScrollView.contentSize.height -
-                            CGRectGetHeight(self.presentingViewBounds) + headerHeightWithoutInset -
-                            kScrollViewBufferForPerformance;
+                            CGRectGetHeight(model->presentingViewBounds) +
+                            headerHeightWithoutInset - kScrollViewBufferForPerformance;
   BOOL scrollingUpInFull = contentDiff < 0 && CGRectGetMinY(self.trackingScrollView.bounds) > 0;
 
   if (CGRectGetMinY(self.scrollView.bounds) >= drawerOffset || scrollingUpInFull) {
@@ -307,8 +368,8 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
       self.scrollView.bounds = scrollViewBounds;
 
       // Make sure the drawer's scrollView's content size is the full size of the content
-      CGSize scrollViewContentSize = self.presentingViewBounds.size;
-      scrollViewContentSize.height += self.contentHeightSurplus;
+      CGSize scrollViewContentSize = model->presentingViewBounds.size;
+      scrollViewContentSize.height += model->contentHeightSurplus;
       self.scrollView.contentSize = scrollViewContentSize;
 
       // Update the main content view's scrollView offset
@@ -360,18 +421,11 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
     return;
   }
   self.scrollViewObserved = YES;
-  [self.scrollView addObserver:self
-                    forKeyPath:kContentOffsetKeyPath
-                       options:NSKeyValueObservingOptionNew | NSKeyValueObservingOptionOld
-                       context:nil];
+  _lastContentOffset = self.scrollView.contentOffset;
 }
 
 - (void)removeScrollViewObserver {
-  if (!self.scrollViewObserved) {
-    return;
-  }
   self.scrollViewObserved = NO;
-  [self.scrollView removeObserver:self forKeyPath:kContentOffsetKeyPath];
 }
 
 - (void)setDrawerState:(MDCBottomDrawerState)drawerState {
@@ -437,9 +491,7 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
 
 - (void)expandToFullscreenWithDuration:(CGFloat)duration
                             completion:(void (^__nullable)(BOOL finished))completion {
-  _contentHeaderTopInset = NSNotFound;
-  _contentHeightSurplus = NSNotFound;
-  _addedContentHeight = NSNotFound;
+  [self invalidateLayoutCalculations];
   _shouldPresentAtFullscreen = YES;
   [self cacheLayoutCalculations];
   [UIView animateWithDuration:duration
@@ -575,9 +627,7 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
     }
   }
   _shouldPresentAtFullscreen = NO;
-  _contentHeaderTopInset = NSNotFound;
-  _contentHeightSurplus = NSNotFound;
-  _addedContentHeight = NSNotFound;
+  [self invalidateLayoutCalculations];
   [self.view setNeedsLayout];
 }
 
@@ -649,39 +699,45 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
 #pragma mark Content Offset Adaptions (Private)
 
 - (void)updateViewWithContentOffset:(CGPoint)contentOffset {
-  CGFloat transitionPercentage =
-      [self transitionPercentageForContentOffset:contentOffset
-                                          offset:0
-                                        distance:self.headerAnimationDistance];
+  MDCBottomDrawerLayoutModel layoutModel = self.layoutModel;
+  [self updateViewWithContentOffset:contentOffset layoutModel:&layoutModel];
+}
+
+- (void)updateViewWithContentOffset:(CGPoint)contentOffset
+                        layoutModel:(const MDCBottomDrawerLayoutModel *)model {
+  CGFloat transitionPercentage = MDCBottomDrawerTransitionPercentage(
+      model, contentOffset.y, 0, model->headerAnimationDistance);
   CGFloat headerTransitionToTop =
-      contentOffset.y >= self.transitionCompleteContentOffset ? 1 : transitionPercentage;
+      contentOffset.y >= model->transitionCompleteContentOffset ? 1 : transitionPercentage;
   [self.delegate bottomDrawerContainerViewControllerTopTransitionRatio:self
                                                        transitionRatio:transitionPercentage];
 
   [self updateDrawerState:transitionPercentage];
   self.currentlyFullscreen =
-      self.contentReachesFullscreen && headerTransitionToTop >= 1 && contentOffset.y > 0;
+      model->contentReachesFullscreen && headerTransitionToTop >= 1 && contentOffset.y > 0;
   CGFloat fullscreenHeaderHeight =
-      self.contentReachesFullscreen ? self.topHeaderHeight : [self contentHeaderHeight];
+      model->contentReachesFullscreen ? model->topHeaderHeight : model->contentHeaderHeight;
 
   CGFloat contentHeight =
       _contentVCPreferredContentSizeHeightCached + _headerVCPerferredContentSizeHeightCached;
-  if (self.shouldAlwaysExpandHeader && (contentHeight < self.presentingViewBounds.size.height)) {
+  if (self.shouldAlwaysExpandHeader &&
+      (contentHeight < model->presentingViewBounds.size.height)) {
     // Make sure the content offset is greater than the content height surplus or we will divide
     // by 0.
-    if (contentOffset.y > self.contentHeightSurplus) {
+    if (contentOffset.y > model->contentHeightSurplus) {
       CGFloat additionalScrollPassedMaxHeight =
-          self.contentHeaderTopInset -
-          (self.contentHeightSurplus + self.addedContentHeightThreshold);
-      fullscreenHeaderHeight = self.topHeaderHeight;
-      headerTransitionToTop =
-          MIN(1, (contentOffset.y - self.contentHeightSurplus) / additionalScrollPassedMaxHeight);
+          model->contentHeaderTopInset -
+          (model->contentHeightSurplus + model->addedContentHeightThreshold);
+      fullscreenHeaderHeight = model->topHeaderHeight;
+      headerTransitionToTop = MIN(1, (contentOffset.y - model->contentHeightSurplus) /
+                                         additionalScrollPassedMaxHeight);
     }
   }
 
   [self updateContentHeaderWithTransitionToTop:headerTransitionToTop
-                        fullscreenHeaderHeight:fullscreenHeaderHeight];
-  [self updateTopHeaderBottomShadowWithContentOffset:contentOffset];
+                        fullscreenHeaderHeight:fullscreenHeaderHeight
+                                   layoutModel:model];
+  [self updateTopHeaderBottomShadowWithContentOffset:contentOffset layoutModel:model];
   [self updateContentWithHeight:contentOffset.y];
 
   // Calculate the current yOffset of the header and content.
@@ -690,7 +746,7 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
 
   // While animating open or closed, always send back the final target Y offset.
   if (self.animatingPresentation) {
-    yOffset = self.contentHeaderTopInset;
+    yOffset = model->contentHeaderTopInset;
   }
   if (self.animatingDismissal) {
     yOffset = self.view.frame.size.height;
@@ -701,13 +757,14 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
 }
 
 - (void)updateContentHeaderWithTransitionToTop:(CGFloat)headerTransitionToTop
-                        fullscreenHeaderHeight:(CGFloat)fullscreenHeaderHeight {
+                        fullscreenHeaderHeight:(CGFloat)fullscreenHeaderHeight
+                                   layoutModel:(const MDCBottomDrawerLayoutModel *)model {
   if (!self.headerViewController) {
     return;
   }
 
   UIView *contentHeaderView = self.headerViewController.view;
-  BOOL contentReachesFullscreen = self.contentReachesFullscreen;
+  BOOL contentReachesFullscreen = model->contentReachesFullscreen;
 
   if ([self.headerViewController
           respondsToSelector:@selector(updateDrawerHeaderTransitionRatio:)]) {
@@ -718,7 +775,7 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
           updateDrawerHeaderTransitionRatio:contentReachesFullscreen ? headerTransitionToTop : 0];
     }
   }
-  CGFloat contentHeaderHeight = self.contentHeaderHeight;
+  CGFloat contentHeaderHeight = model->contentHeaderHeight;
   CGFloat headersDiff = fullscreenHeaderHeight - contentHeaderHeight;
   CGFloat contentHeaderViewHeight = contentHeaderHeight + headerTransitionToTop * headersDiff;
 
@@ -735,10 +792,10 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
     [self.scrollView addSubview:contentHeaderView];
     [self.view setNeedsLayout];
   }
-  CGFloat contentHeaderViewWidth = self.presentingViewBounds.size.width;
+  CGFloat contentHeaderViewWidth = model->presentingViewBounds.size.width;
   CGFloat contentHeaderViewTop =
       self.currentlyFullscreen ? 0
-                               : self.contentHeaderTopInset - headerTransitionToTop * headersDiff;
+                               : model->contentHeaderTopInset - headerTransitionToTop * headersDiff;
   contentHeaderView.frame =
       CGRectMake(0, contentHeaderViewTop, contentHeaderViewWidth, contentHeaderViewHeight);
   self.shadowedView.frame = contentHeaderView.frame;
@@ -748,13 +805,13 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
   }
 }
 
-- (void)updateTopHeaderBottomShadowWithContentOffset:(CGPoint)contentOffset {
+- (void)updateTopHeaderBottomShadowWithContentOffset:(CGPoint)contentOffset
+                                         layoutModel:(const MDCBottomDrawerLayoutModel *)model {
   self.headerShadowLayer.hidden = !self.currentlyFullscreen;
   if (!self.headerShadowLayer.hidden) {
-    self.headerShadowLayer.opacity =
-        (float)[self transitionPercentageForContentOffset:contentOffset
-                                                   offset:-kVerticalShadowAnimationDistance
-                                                 distance:kVerticalShadowAnimationDistance];
+    self.headerShadowLayer.opacity = (float)MDCBottomDrawerTransitionPercentage(
+        model, contentOffset.y, -kVerticalShadowAnimationDistance,
+        kVerticalShadowAnimationDistance);
   }
 }
 
@@ -815,13 +872,15 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
 - (void)viewWillTransitionToSize:(CGSize)size
        withTransitionCoordinator:(id<UIViewControllerTransitionCoordinator>)coordinator {
   [super viewWillTransitionToSize:size withTransitionCoordinator:coordinator];
-  _contentHeaderTopInset = NSNotFound;
-  _contentHeightSurplus = NSNotFound;
-  _addedContentHeight = NSNotFound;
+  [self invalidateLayoutCalculations];
 }
 
 #pragma mark UIScrollViewDelegate (Private)
 
+- (void)scrollViewDidScroll:(UIScrollView *)scrollView {
+  [self scrollViewContentOffsetDidChange];
+}
+
 - (void)scrollViewWillBeginDragging:(UIScrollView *)scrollView {
   self.scrollViewBeganDraggingFromFullscreen = self.currentlyFullscreen;
 }
@@ -864,6 +923,62 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
   [self cacheLayoutCalculationsWithAddedContentHeight:0];
 }
 
+- (void)invalidateLayoutCalculations {
+  _contentHeaderTopInset = NSNotFound;
+  _contentHeightSurplus = NSNotFound;
+  _addedContentHeight = NSNotFound;
+  _layoutModel.valid = NO;
+}
+
+- (MDCBottomDrawerLayoutModel)layoutModel {
+  CGRect presentingViewBounds = self.presentingViewBounds;
+  BOOL hasHeader = self.headerViewController != nil;
+  CGFloat contentHeaderHeight = self.contentHeaderHeight;
+  BOOL presentsFullScreen = [self shouldPresentFullScreen];
+  if (_layoutModel.valid && _layoutModel.hasHeader == hasHeader &&
+      _layoutModel.presentsFullScreen == presentsFullScreen &&
+      MDCCGFloatEqual(_layoutModel.contentHeaderHeight, contentHeaderHeight) &&
+      CGRectEqualToRect(_layoutModel.presentingViewBounds, presentingViewBounds)) {
+    return _layoutModel;
+  }
+
+  MDCBottomDrawerLayoutModel model = {0};
+  model.presentingViewBounds = presentingViewBounds;
+  model.hasHeader = hasHeader;
+  model.presentsFullScreen = presentsFullScreen;
+  model.contentHeaderHeight = contentHeaderHeight;
+
+  // Reading the cached values recaches the layout calculations if they were invalidated.
+  model.contentHeaderTopInset = self.contentHeaderTopInset;
+  model.contentHeightSurplus = self.contentHeightSurplus;
+  model.topHeaderHeight = self.topHeaderHeight;
+  model.topSafeAreaInset = MDCDeviceTopSafeAreaInset();
+  model.addedContentHeightThreshold = self.addedContentHeightThreshold;
+  model.contentReachesFullscreen = self.contentReachesFullscreen;
+
+  if (model.contentReachesFullscreen) {
+    model.transitionCompleteContentOffset =
+        model.contentHeaderTopInset - (model.topHeaderHeight - model.contentHeaderHeight);
+  } else {
+    model.transitionCompleteContentOffset = model.contentHeightSurplus;
+  }
+
+  model.headerAnimationDistance =
+      MIN(kHeaderAnimationDistanceAddedDistanceFromTopSafeAreaInset, model.contentHeightSurplus);
+  if (model.contentReachesFullscreen) {
+    model.headerAnimationDistance += model.topSafeAreaInset;
+  }
+
+  model.trackingTopAreaInsetForHeader = hasHeader ? model.topSafeAreaInset : 0;
+  if (model.contentHeaderTopInset <= model.trackingTopAreaInsetForHeader + kEpsilon) {
+    model.trackingTopAreaInsetForHeader = kEpsilon;
+  }
+
+  model.valid = YES;
+  _layoutModel = model;
+  return model;
+}
+
 - (void)cacheLayoutCalculationsWithAddedContentHeight:(CGFloat)addedContentHeight {
   CGFloat contentHeaderHeight = self.contentHeaderHeight;
   CGFloat containerHeight = self.presentingViewBounds.size.height;
@@ -918,18 +1033,14 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
     CGFloat addedContentheight = _contentHeaderTopInset - _contentHeightSurplus;
     [self cacheLayoutCalculationsWithAddedContentHeight:addedContentheight];
   }
+  _layoutModel.valid = NO;
 }
 
 - (CGFloat)transitionPercentageForContentOffset:(CGPoint)contentOffset
                                          offset:(CGFloat)offset
                                        distance:(CGFloat)distance {
-  // If the distance is 0 or negative there is no distance for a transition to occur and therefore
-  // it is set to 1 (100%).
-  if (distance <= 0) {
-    return 1;
-  }
-  return 1 - MAX(0, MIN(1, (self.transitionCompleteContentOffset - contentOffset.y - offset) /
-                               distance));
+  MDCBottomDrawerLayoutModel layoutModel = self.layoutModel;
+  return MDCBottomDrawerTransitionPercentage(&layoutModel, contentOffset.y, offset, distance);
 }
 
 - (CGFloat)midAnimationScrollToPositionForOffset:(CGPoint)targetContentOffset {
@@ -983,22 +1094,11 @@ NSString *const kMDCBottomDrawerScrollViewAccessibilityIdentifier =
 }
 
 - (CGFloat)transitionCompleteContentOffset {
-  if (self.contentReachesFullscreen) {
-    CGFloat transitionCompleteContentOffset = self.contentHeaderTopInset;
-    transitionCompleteContentOffset -= self.topHeaderHeight - self.contentHeaderHeight;
-    return transitionCompleteContentOffset;
-  } else {
-    return self.contentHeightSurplus;
-  }
+  return self.layoutModel.transitionCompleteContentOffset;
 }
 
 - (CGFloat)headerAnimationDistance {
-  CGFloat headerAnimationDistance =
-      MIN(kHeaderAnimationDistanceAddedDistanceFromTopSafeAreaInset, self.contentHeightSurplus);
-  if (self.contentReachesFullscreen) {
-    headerAnimationDistance += MDCDeviceTopSafeAreaInset();
-  }
-  return headerAnimationDistance;
+  return self.layoutModel.headerAnimationDistance;
 }
 
 - (CGFloat)addedContentHeightThreshold {
@@ -0,0 +1,176 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "../../src/private/MDCBottomDrawerContainerViewController.h"
+#import "MaterialScrollTrace.h"
+
+@interface MDCBottomDrawerContainerViewController (ScrollTraceReplayTests)
+@property(nonatomic, readonly) UIScrollView *scrollView;
+@end
+
+/** Reports layout passes and content offset updates of a bottom drawer to a replayer. */
+@interface MDCNavigationDrawerScrollTraceReplayTestsContainerViewController
+    : MDCBottomDrawerContainerViewController <MDCBottomDrawerContainerViewControllerDelegate>
+@property(nonatomic, weak) MDCScrollTraceReplayer *replayer;
+@end
+
+@implementation MDCNavigationDrawerScrollTraceReplayTestsContainerViewController
+
+- (void)viewDidLayoutSubviews {
+  [super viewDidLayoutSubviews];
+
+  [self.replayer recordLayoutPass];
+}
+
+- (void)bottomDrawerContainerViewControllerWillChangeState:
+            (MDCBottomDrawerContainerViewController *)containerViewController
+                                               drawerState:(MDCBottomDrawerState)drawerState {
+}
+
+- (void)bottomDrawerContainerViewControllerDidChangeYOffset:
+            (MDCBottomDrawerContainerViewController *)containerViewController
+                                                    yOffset:(CGFloat)yOffset {
+  [self.replayer recordFrameCommit];
+}
+
+- (void)bottomDrawerContainerViewControllerTopTransitionRatio:
+            (MDCBottomDrawerContainerViewController *)containerViewController
+                                              transitionRatio:(CGFloat)transitionRatio {
+}
+
+@end
+
+static const NSInteger kLongListRowCount = 5000;
+static const CGFloat kLongListRowHeight = 48;
+static NSString *const kLongListCellIdentifier = @"cell";
+
+@interface MDCNavigationDrawerScrollTraceReplayTests : XCTestCase <UITableViewDataSource>
+@end
+
+@implementation MDCNavigationDrawerScrollTraceReplayTests
+
+- (MDCScrollTraceReport *)replayTrace:(MDCScrollTrace *)trace frameRate:(NSInteger)frameRate {
+  return [self replayTrace:trace name:@"BottomDrawerFling" frameRate:frameRate tableView:nil];
+}
+
+- (MDCScrollTraceReport *)replayTrace:(MDCScrollTrace *)trace
+                                 name:(NSString *)name
+                            frameRate:(NSInteger)frameRate
+                            tableView:(UITableView *)tableView {
+  UIViewController *presentingViewController = [[UIViewController alloc] init];
+  presentingViewController.view.frame = CGRectMake(0, 0, 375, 667);
+  UIViewController *contentViewController = [[UIViewController alloc] init];
+  contentViewController.preferredContentSize = CGSizeMake(375, 2000);
+  if (tableView) {
+    tableView.frame = presentingViewController.view.bounds;
+    [contentViewController.view addSubview:tableView];
+    contentViewController.preferredContentSize =
+        CGSizeMake(375, kLongListRowCount * kLongListRowHeight);
+  }
+
+  MDCNavigationDrawerScrollTraceReplayTestsContainerViewController *drawer =
+      [[MDCNavigationDrawerScrollTraceReplayTestsContainerViewController alloc]
+          initWithOriginalPresentingViewController:presentingViewController
+                                trackingScrollView:tableView];
+  drawer.contentViewController = contentViewController;
+  drawer.delegate = drawer;
+  drawer.view.frame = presentingViewController.view.frame;
+  [drawer viewWillAppear:NO];
+  [drawer.view layoutIfNeeded];
+
+  MDCScrollTraceReplayer *replayer = [[MDCScrollTraceReplayer alloc] initWithTrace:trace];
+  replayer.name = name;
+  replayer.frameRate = frameRate;
+  drawer.replayer = replayer;
+
+  MDCScrollTraceReport *report = [replayer replayWithFrameHandler:^(MDCScrollTraceSample sample) {
+    drawer.scrollView.contentOffset = sample.contentOffset;
+    [drawer.view layoutIfNeeded];
+  }];
+  [drawer viewDidDisappear:NO];
+
+  NSError *error;
+  XCTAssertTrue([report writeToReportDirectoryIfRequested:&error], @"%@", error);
+  return report;
+}
+
+- (void)testReplayFlingAt60And120Hz {
+  // Given
+  MDCScrollTrace *trace =
+      [MDCScrollTrace decelerationTraceFromContentOffset:CGPointZero
+                                                velocity:CGPointMake(0, 3000)
+                                        decelerationRate:UIScrollViewDecelerationRateNormal
+                                          sampleInterval:1.0 / 120.0];
+
+  for (NSNumber *frameRate in @[ @60, @120 ]) {
+    // When
+    MDCScrollTraceReport *report = [self replayTrace:trace frameRate:frameRate.integerValue];
+
+    // Then
+    XCTAssertGreaterThan(report.frameCount, 0U);
+    XCTAssertGreaterThan(report.totalFrameCommitCount, 0U);
+  }
+}
+
+/**
+ Benchmarks a fling through a drawer that tracks a 5,000-row table view.
+
+ No baseline is recorded for it: the per-frame times depend on the device or simulator it runs on.
+ Set MDC_SCROLL_TRACE_REPORT_DIR to write a report, and compare reports from before and after a
+ change on the same device.
+ */
+- (void)testReplayFlingThroughFiveThousandRowList {
+  // Given
+  MDCScrollTrace *trace =
+      [MDCScrollTrace decelerationTraceFromContentOffset:CGPointZero
+                                                velocity:CGPointMake(0, 8000)
+                                        decelerationRate:UIScrollViewDecelerationRateNormal
+                                          sampleInterval:1.0 / 120.0];
+
+  [self measureBlock:^{
+    UITableView *tableView = [[UITableView alloc] initWithFrame:CGRectZero
+                                                          style:UITableViewStylePlain];
+    tableView.rowHeight = kLongListRowHeight;
+    tableView.dataSource = self;
+    [tableView registerClass:[UITableViewCell class]
+        forCellReuseIdentifier:kLongListCellIdentifier];
+
+    // When
+    MDCScrollTraceReport *report = [self replayTrace:trace
+                                                name:@"BottomDrawerFiveThousandRows"
+                                           frameRate:120
+                                           tableView:tableView];
+
+    // Then
+    XCTAssertGreaterThan(report.totalFrameCommitCount, 0U);
+  }];
+}
+
+#pragma mark - UITableViewDataSource
+
+- (NSInteger)tableView:(UITableView *)tableView numberOfRowsInSection:(NSInteger)section {
+  return kLongListRowCount;
+}
+
+- (UITableViewCell *)tableView:(UITableView *)tableView
+         cellForRowAtIndexPath:(NSIndexPath *)indexPath {
+  UITableViewCell *cell = [tableView dequeueReusableCellWithIdentifier:kLongListCellIdentifier
+                                                          forIndexPath:indexPath];
+  cell.textLabel.text = [NSString stringWithFormat:@"Row %ld", (long)indexPath.row];
+  return cell;
+}
+
+@end
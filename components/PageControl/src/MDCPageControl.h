@@ -76,6 +76,20 @@
  */
 @property(nonatomic) BOOL hidesForSinglePage;
 
+/**
+ The maximum number of page indicators that are rendered at once, or 0 to render one for every
+ page.
+
+ When @c numberOfPages exceeds this value, only the indicators of the pages around the current page
+ are rendered, by a fixed set of layers that are recycled as the current page moves. The control is
+ sized to fit this many indicators, and the rendered indicators are laid out from its leading edge.
+ Scrolling then does the same amount of work no matter how many pages there are, which suits
+ carousels with hundreds of pages.
+
+ The default value is 0.
+ */
+@property(nonatomic) NSInteger maximumNumberOfVisibleIndicators;
+
 #pragma mark Configuring the page colors
 
 /** The color of the non-current page indicators. */
@@ -58,8 +58,10 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
 
 @implementation MDCPageControl {
   UIView *_containerView;
+  // The indicators of the pages in _renderedPageRange, in page order.
   NSMutableArray<MDCPageControlIndicator *> *_indicators;
-  NSMutableArray<NSValue *> *_indicatorPositions;
+  NSRange _renderedPageRange;
+  BOOL _indicatorsAreRTL;
   MDCPageControlIndicator *_animatedIndicator;
   MDCPageControlTrackLayer *_trackLayer;
   CGFloat _trackLength;
@@ -108,15 +110,15 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
 
 - (void)layoutSubviews {
   [super layoutSubviews];
-  if (_numberOfPages == 0 || (_hidesForSinglePage && [_indicators count] == 1)) {
+  if (_numberOfPages == 0 || (_hidesForSinglePage && _numberOfPages == 1)) {
     self.hidden = YES;
     return;
   }
   self.hidden = NO;
 
-  for (NSUInteger pageNumber = 0; pageNumber < _indicators.count; pageNumber++) {
-    MDCPageControlIndicator *indicator = _indicators[pageNumber];
-    if (pageNumber == (NSUInteger)_currentPage) {
+  for (NSUInteger index = 0; index < _indicators.count; index++) {
+    MDCPageControlIndicator *indicator = _indicators[index];
+    if (_renderedPageRange.location + index == (NSUInteger)_currentPage) {
       indicator.hidden = YES;
     }
     indicator.color = _pageIndicatorTintColor;
@@ -139,6 +141,11 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
   [self resetControl];
 }
 
+- (void)setMaximumNumberOfVisibleIndicators:(NSInteger)maximumNumberOfVisibleIndicators {
+  _maximumNumberOfVisibleIndicators = MAX(0, maximumNumberOfVisibleIndicators);
+  [self resetControl];
+}
+
 - (void)setCurrentPage:(NSInteger)currentPage {
   [self setCurrentPage:currentPage animated:NO];
 }
@@ -157,14 +164,15 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
   if (_numberOfPages == 0) {
     return;
   }
+  [self updateRenderedPagesAroundPage:currentPage];
 
   if (animated) {
     // Draw and extend track.
-    CGPoint startPoint = [_indicatorPositions[previousPage] CGPointValue];
-    CGPoint endPoint = [_indicatorPositions[currentPage] CGPointValue];
+    CGPoint startPoint = [self indicatorPositionForPage:previousPage];
+    CGPoint endPoint = [self indicatorPositionForPage:currentPage];
     if (shouldReverse) {
-      startPoint = [_indicatorPositions[currentPage] CGPointValue];
-      endPoint = [_indicatorPositions[previousPage] CGPointValue];
+      startPoint = [self indicatorPositionForPage:currentPage];
+      endPoint = [self indicatorPositionForPage:previousPage];
     }
 
     // Remove track and reveal hidden indicators staggered towards current page indicator. Reveal
@@ -192,13 +200,13 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
                                        completion:completionBlock];
   } else {
     // If not animated, simply move indicator to new position and reset track.
-    CGPoint point = [_indicatorPositions[currentPage] CGPointValue];
+    CGPoint point = [self indicatorPositionForPage:currentPage];
     [_animatedIndicator updateIndicatorTransformX:point.x - kPageControlIndicatorRadius];
     [_trackLayer resetAtPoint:point];
 
     [CATransaction begin];
     [CATransaction setDisableActions:YES];
-    [_indicators[previousPage] setHidden:NO];
+    [[self indicatorForPage:previousPage] setHidden:NO];
     [CATransaction commit];
   }
 }
@@ -216,11 +224,11 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
 #pragma mark - UIView(UIViewGeometry)
 
 - (CGSize)intrinsicContentSize {
-  return [MDCPageControl sizeForNumberOfPages:_numberOfPages];
+  return [MDCPageControl sizeForNumberOfPages:[self visibleIndicatorCount]];
 }
 
 - (CGSize)sizeThatFits:(__unused CGSize)size {
-  return [MDCPageControl sizeForNumberOfPages:_numberOfPages];
+  return [MDCPageControl sizeForNumberOfPages:[self visibleIndicatorCount]];
 }
 
 + (CGSize)sizeForNumberOfPages:(NSInteger)pageCount {
@@ -280,7 +288,8 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
                      NSInteger currentPage = [self scrolledPageNumber:scrollView];
                      [self setCurrentPage:currentPage animated:YES duration:animation.duration];
 
-                     CGFloat transformX = scrolledPercentage * self->_trackLength;
+                     CGFloat transformX =
+                         [self indicatorTransformXForScrolledPercentage:scrolledPercentage];
                      [self->_animatedIndicator updateIndicatorTransformX:transformX
                                                                 animated:YES
                                                                 duration:animation.duration
@@ -288,28 +297,31 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
                    });
 
   } else if (scrolledPercentage >= 0 && scrolledPercentage <= 1 && _numberOfPages > 0) {
+    // Move the rendered indicators first, since positions are relative to the rendered range.
+    NSInteger scrolledPageNumber = [self scrolledPageNumber:scrollView];
+    [self updateRenderedPagesAroundPage:scrolledPageNumber];
+
     // Update active indicator position.
-    CGFloat transformX = scrolledPercentage * _trackLength;
+    CGFloat transformX = [self indicatorTransformXForScrolledPercentage:scrolledPercentage];
     if (!_isDeferredScrolling) {
       [_animatedIndicator updateIndicatorTransformX:transformX];
     }
 
     // Determine endpoints for drawing track depending on direction scrolled.
-    NSInteger scrolledPageNumber = [self scrolledPageNumber:scrollView];
-    CGPoint startPoint = [_indicatorPositions[scrolledPageNumber] CGPointValue];
+    CGPoint startPoint = [self indicatorPositionForPage:scrolledPageNumber];
     CGPoint endPoint = startPoint;
     CGFloat radius = kPageControlIndicatorRadius;
     if (transformX > startPoint.x - radius) {
       if ([self isRTL]) {
-        endPoint = [_indicatorPositions[scrolledPageNumber - 1] CGPointValue];
+        endPoint = [self indicatorPositionForPage:scrolledPageNumber - 1];
       } else {
-        endPoint = [_indicatorPositions[scrolledPageNumber + 1] CGPointValue];
+        endPoint = [self indicatorPositionForPage:scrolledPageNumber + 1];
       }
     } else if (transformX < startPoint.x - radius) {
       if ([self isRTL]) {
-        startPoint = [_indicatorPositions[scrolledPageNumber + 1] CGPointValue];
+        startPoint = [self indicatorPositionForPage:scrolledPageNumber + 1];
       } else {
-        startPoint = [_indicatorPositions[scrolledPageNumber - 1] CGPointValue];
+        startPoint = [self indicatorPositionForPage:scrolledPageNumber - 1];
       }
     }
 
@@ -324,7 +336,7 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
 
     // Hide indicators to be shown with animated reveal once track is removed.
     if (!_isDeferredScrolling) {
-      [_indicators[scrolledPageNumber] setHidden:YES];
+      [[self indicatorForPage:scrolledPageNumber] setHidden:YES];
     }
   }
 }
@@ -332,10 +344,11 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
 - (void)scrollViewDidEndDecelerating:(UIScrollView *)scrollView {
   // Remove track towards current active indicator position.
   NSInteger scrolledPageNumber = [self scrolledPageNumber:scrollView];
-  CGPoint point = [_indicatorPositions[scrolledPageNumber] CGPointValue];
+  CGPoint point = [self indicatorPositionForPage:scrolledPageNumber];
   BOOL shouldReverse = (_currentPage > scrolledPageNumber);
   BOOL sendAction = (_currentPage != scrolledPageNumber);
   _currentPage = scrolledPageNumber;
+  [self updateRenderedPagesAroundPage:scrolledPageNumber];
 
   [_trackLayer removeTrackTowardsPoint:point
                             completion:^{
@@ -360,6 +373,7 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
   NSInteger scrolledPageNumber = [self scrolledPageNumber:scrollView];
   BOOL shouldReverse = (_currentPage > scrolledPageNumber);
   _currentPage = scrolledPageNumber;
+  [self updateRenderedPagesAroundPage:scrolledPageNumber];
   [self revealIndicatorsReversed:shouldReverse];
 }
 
@@ -370,9 +384,11 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
   NSEnumerationOptions options = (reversed) ? NSEnumerationReverse : 0;
 
   __block NSInteger count = 0;
+  NSInteger firstRenderedPage = (NSInteger)_renderedPageRange.location;
   void (^block)(MDCPageControlIndicator *, NSUInteger, BOOL *) =
-      ^(MDCPageControlIndicator *indicator, NSUInteger index, BOOL *stop) {
-        BOOL isCurrentPageIndicator = (NSInteger)index == self.currentPage;
+      ^(MDCPageControlIndicator *indicator, NSUInteger index, __unused BOOL *stop) {
+        NSInteger page = firstRenderedPage + (NSInteger)index;
+        BOOL isCurrentPageIndicator = page == self.currentPage;
 
         // Reveal indicators if hidden and not current page indicator.
         if (indicator.isHidden && !isCurrentPageIndicator) {
@@ -380,7 +396,10 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
               DISPATCH_TIME_NOW, (int64_t)(kPageControlIndicatorShowDelay * count * NSEC_PER_SEC));
 
           dispatch_after(popTime, dispatch_get_main_queue(), ^{
-            [indicator revealIndicator];
+            // The indicator may have been recycled for another page in the meantime.
+            if ([self indicatorForPage:page] == indicator) {
+              [indicator revealIndicator];
+            }
           });
 
           count++;
@@ -422,9 +441,9 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
     // Reset hidden state of indicators.
     [CATransaction begin];
     [CATransaction setDisableActions:YES];
-    for (int i = 0; i < _numberOfPages; i++) {
-      MDCPageControlIndicator *indicator = _indicators[i];
-      indicator.hidden = (i == _currentPage) ? YES : NO;
+    for (NSUInteger index = 0; index < _indicators.count; index++) {
+      MDCPageControlIndicator *indicator = _indicators[index];
+      indicator.hidden = (_renderedPageRange.location + index == (NSUInteger)_currentPage);
     }
     [CATransaction commit];
   }
@@ -491,8 +510,12 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
       [layer removeFromSuperlayer];
     }
   }
-  _indicators = [NSMutableArray arrayWithCapacity:_numberOfPages];
-  _indicatorPositions = [NSMutableArray arrayWithCapacity:_numberOfPages];
+  NSInteger indicatorCount = [self visibleIndicatorCount];
+  _indicators = [NSMutableArray arrayWithCapacity:(NSUInteger)indicatorCount];
+  _indicatorsAreRTL = [self isRTL];
+  _renderedPageRange = NSMakeRange(
+      (NSUInteger)[self firstRenderedPageAroundPage:_currentPage count:indicatorCount],
+      (NSUInteger)indicatorCount);
 
   if (_numberOfPages == 0) {
     [self setNeedsLayout];
@@ -501,36 +524,26 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
 
   // Create indicators.
   CGFloat radius = kPageControlIndicatorRadius;
-  CGFloat margin = kPageControlIndicatorMargin;
-  for (int i = 0; i < _numberOfPages; i++) {
-    CGFloat offsetX = i * (margin + (radius * 2));
-    CGFloat offsetY = radius;
-    CGPoint center = CGPointMake(offsetX + radius, offsetY);
+  for (NSUInteger page = _renderedPageRange.location; page < NSMaxRange(_renderedPageRange);
+       page++) {
+    CGPoint center = [self indicatorPositionForPage:(NSInteger)page];
     MDCPageControlIndicator *indicator = [[MDCPageControlIndicator alloc] initWithCenter:center
                                                                                   radius:radius];
     indicator.opacity = kPageControlIndicatorDefaultOpacity;
     [_containerView.layer addSublayer:indicator];
-    NSInteger pageNumber = i;
-    if ([self isRTL]) {
-      pageNumber = _numberOfPages - 1 - i;
-      [_indicators insertObject:indicator atIndex:0];
-      [_indicatorPositions insertObject:[NSValue valueWithCGPoint:indicator.position] atIndex:0];
-    } else {
-      [_indicators addObject:indicator];
-      [_indicatorPositions addObject:[NSValue valueWithCGPoint:indicator.position]];
-    }
+    [_indicators addObject:indicator];
   }
 
   // Resize container view to keep indicators centered.
   CGFloat frameWidth = _containerView.frame.size.width;
-  CGSize controlSize = [MDCPageControl sizeForNumberOfPages:_numberOfPages];
+  CGSize controlSize = [MDCPageControl sizeForNumberOfPages:indicatorCount];
   _containerView.frame = CGRectInset(_containerView.frame, (frameWidth - controlSize.width) / 2, 0);
   _trackLength = CGRectGetWidth(_containerView.frame) - (radius * 2);
 
   // Add animated indicator that will travel freely across the container. Its transform will be
   // updated by calling its -updateIndicatorTransformX method.
   CGPoint center = CGPointMake(radius, radius);
-  CGPoint point = [_indicatorPositions[_currentPage] CGPointValue];
+  CGPoint point = [self indicatorPositionForPage:_currentPage];
   _animatedIndicator = [[MDCPageControlIndicator alloc] initWithCenter:center radius:radius];
   [_animatedIndicator updateIndicatorTransformX:point.x - kPageControlIndicatorRadius];
   [_containerView.layer addSublayer:_animatedIndicator];
@@ -538,6 +551,114 @@ static inline CGFloat normalizeValue(CGFloat value, CGFloat minRange, CGFloat ma
   [self setNeedsLayout];
 }
 
+/** Returns the number of indicators rendered at once. */
+- (NSInteger)visibleIndicatorCount {
+  if (_maximumNumberOfVisibleIndicators > 0) {
+    return MIN(_numberOfPages, _maximumNumberOfVisibleIndicators);
+  }
+  return _numberOfPages;
+}
+
+/**
+ Returns the x offset of @c column, counted from the left across all pages, relative to the
+ leftmost rendered indicator. @c column may be fractional while scrolling between pages.
+ */
+- (CGFloat)offsetXForColumn:(CGFloat)column {
+  NSInteger firstColumn = (NSInteger)_renderedPageRange.location;
+  if (_indicatorsAreRTL) {
+    firstColumn = _numberOfPages - (NSInteger)NSMaxRange(_renderedPageRange);
+  }
+  return (column - firstColumn) * (kPageControlIndicatorMargin + (kPageControlIndicatorRadius * 2));
+}
+
+/** Returns the center of the indicator of @c page, in the coordinates of the container view. */
+- (CGPoint)indicatorPositionForPage:(NSInteger)page {
+  CGFloat radius = kPageControlIndicatorRadius;
+  NSInteger column = _indicatorsAreRTL ? _numberOfPages - 1 - page : page;
+  return CGPointMake([self offsetXForColumn:column] + radius, radius);
+}
+
+/** Returns the transform of the animated indicator for a scroll view scrolled to @c percentage. */
+- (CGFloat)indicatorTransformXForScrolledPercentage:(CGFloat)percentage {
+  CGFloat offsetX = [self offsetXForColumn:percentage * (_numberOfPages - 1)];
+  return MAX(0, MIN(_trackLength, offsetX));
+}
+
+/** Returns the indicator of @c page, or nil if the page's indicator isn't rendered. */
+- (MDCPageControlIndicator *)indicatorForPage:(NSInteger)page {
+  if (page < 0 || !NSLocationInRange((NSUInteger)page, _renderedPageRange)) {
+    return nil;
+  }
+  return _indicators[(NSUInteger)page - _renderedPageRange.location];
+}
+
+- (NSInteger)firstRenderedPageAroundPage:(NSInteger)page count:(NSInteger)count {
+  return MAX(0, MIN(_numberOfPages - count, page - count / 2));
+}
+
+/**
+ Moves the range of rendered indicators so that it is centered on @c page, where possible.
+
+ Indicators that leave the range are recycled for the pages entering it, and the others shift so
+ that the rendered range always starts at the leading edge of the container.
+ */
+- (void)updateRenderedPagesAroundPage:(NSInteger)page {
+  NSInteger count = (NSInteger)_indicators.count;
+  if (count == _numberOfPages) {
+    return;
+  }
+
+  NSInteger firstPage = [self firstRenderedPageAroundPage:page count:count];
+  NSInteger offset = firstPage - (NSInteger)_renderedPageRange.location;
+  if (offset == 0) {
+    return;
+  }
+  _renderedPageRange.location = (NSUInteger)firstPage;
+
+  if (ABS(offset) >= count) {
+    for (NSInteger index = 0; index < count; index++) {
+      [self configureIndicator:_indicators[(NSUInteger)index] forPage:firstPage + index];
+    }
+  } else if (offset > 0) {
+    for (NSInteger index = 0; index < offset; index++) {
+      MDCPageControlIndicator *indicator = _indicators.firstObject;
+      [_indicators removeObjectAtIndex:0];
+      [_indicators addObject:indicator];
+      [self configureIndicator:indicator forPage:firstPage + count - offset + index];
+    }
+  } else {
+    for (NSInteger index = 0; index < -offset; index++) {
+      MDCPageControlIndicator *indicator = _indicators.lastObject;
+      [_indicators removeLastObject];
+      [_indicators insertObject:indicator atIndex:0];
+      [self configureIndicator:indicator forPage:firstPage - offset - 1 - index];
+    }
+  }
+
+  CGFloat radius = kPageControlIndicatorRadius;
+  [CATransaction begin];
+  [CATransaction setDisableActions:YES];
+  for (NSInteger index = 0; index < count; index++) {
+    CGPoint center = [self indicatorPositionForPage:firstPage + index];
+    _indicators[(NSUInteger)index].frame =
+        CGRectMake(center.x - radius, center.y - radius, radius * 2, radius * 2);
+  }
+  [CATransaction commit];
+}
+
+/** Moves a recycled indicator to @c page and resets its state. */
+- (void)configureIndicator:(MDCPageControlIndicator *)indicator forPage:(NSInteger)page {
+  CGFloat radius = kPageControlIndicatorRadius;
+  CGPoint center = [self indicatorPositionForPage:page];
+
+  [CATransaction begin];
+  [CATransaction setDisableActions:YES];
+  [indicator removeAllAnimations];
+  indicator.frame = CGRectMake(center.x - radius, center.y - radius, radius * 2, radius * 2);
+  indicator.hidden = page == _currentPage;
+  [CATransaction commit];
+}
+
 #pragma mark - Strings
 
 + (NSString *)pageControlAccessibilityLabelWithPage:(NSInteger)currentPage
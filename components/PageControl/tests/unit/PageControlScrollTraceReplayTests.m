@@ -0,0 +1,91 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialPageControl.h"
+#import "MaterialScrollTrace.h"
+
+static const NSInteger kNumberOfPages = 10;
+static const CGFloat kPageWidth = 320;
+
+/** Reports layout passes of a page control to a replayer. */
+@interface PageControlScrollTraceReplayTestsPageControl : MDCPageControl
+@property(nonatomic, weak) MDCScrollTraceReplayer *replayer;
+@end
+
+@implementation PageControlScrollTraceReplayTestsPageControl
+
+- (void)layoutSubviews {
+  [super layoutSubviews];
+
+  [self.replayer recordLayoutPass];
+}
+
+@end
+
+@interface PageControlScrollTraceReplayTests : XCTestCase
+@end
+
+@implementation PageControlScrollTraceReplayTests
+
+- (void)testReplayHorizontalFlingAt60And120Hz {
+  // Given
+  MDCScrollTrace *trace =
+      [MDCScrollTrace decelerationTraceFromContentOffset:CGPointZero
+                                                velocity:CGPointMake(4000, 0)
+                                        decelerationRate:UIScrollViewDecelerationRateNormal
+                                          sampleInterval:1.0 / 120.0];
+
+  for (NSNumber *frameRate in @[ @60, @120 ]) {
+    PageControlScrollTraceReplayTestsPageControl *pageControl =
+        [[PageControlScrollTraceReplayTestsPageControl alloc] init];
+    pageControl.numberOfPages = kNumberOfPages;
+    pageControl.frame = (CGRect){CGPointZero, [MDCPageControl sizeForNumberOfPages:kNumberOfPages]};
+    [pageControl layoutIfNeeded];
+    UIScrollView *scrollView =
+        [[UIScrollView alloc] initWithFrame:CGRectMake(0, 0, kPageWidth, 480)];
+    scrollView.contentSize = CGSizeMake(kPageWidth * kNumberOfPages, 480);
+
+    MDCScrollTraceReplayer *replayer = [[MDCScrollTraceReplayer alloc] initWithTrace:trace];
+    replayer.name = @"PageControlFling";
+    replayer.frameRate = frameRate.integerValue;
+    pageControl.replayer = replayer;
+    __weak MDCScrollTraceReplayer *weakReplayer = replayer;
+    // The page control has no delegate reporting frame changes, so moves of its active indicator
+    // are counted as commits instead.
+    CALayer *animatedIndicator = [pageControl valueForKey:@"animatedIndicator"];
+
+    // When
+    MDCScrollTraceReport *report =
+        [replayer replayWithFrameHandler:^(MDCScrollTraceSample sample) {
+          CATransform3D previousTransform = animatedIndicator.transform;
+          scrollView.contentOffset = sample.contentOffset;
+          [pageControl scrollViewDidScroll:scrollView];
+          [pageControl layoutIfNeeded];
+          if (!CATransform3DEqualToTransform(animatedIndicator.transform, previousTransform)) {
+            [weakReplayer recordFrameCommit];
+          }
+        }];
+
+    // Then
+    NSError *error;
+    XCTAssertTrue([report writeToReportDirectoryIfRequested:&error], @"%@", error);
+    XCTAssertGreaterThan(report.frameCount, 0U);
+    XCTAssertGreaterThan(report.totalFrameCommitCount, 0U);
+    XCTAssertLessThanOrEqual(report.totalFrameCommitCount, report.frameCount);
+  }
+}
+
+@end
@@ -0,0 +1,146 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialPageControl.h"
+
+static const NSInteger kLargeNumberOfPages = 1000;
+static const NSInteger kMaximumNumberOfVisibleIndicators = 9;
+static const CGFloat kPageWidth = 320;
+
+/** The number of scroll ticks per page in the scroll benchmark. */
+static const NSInteger kScrollTicksPerPage = 4;
+
+@interface PageControlWindowedIndicatorTests : XCTestCase
+@property(nonatomic, strong, nullable) MDCPageControl *pageControl;
+@end
+
+@implementation PageControlWindowedIndicatorTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.pageControl = [[MDCPageControl alloc] init];
+  self.pageControl.maximumNumberOfVisibleIndicators = kMaximumNumberOfVisibleIndicators;
+  self.pageControl.numberOfPages = kLargeNumberOfPages;
+  self.pageControl.frame = (CGRect){CGPointZero, self.pageControl.intrinsicContentSize};
+  [self.pageControl layoutIfNeeded];
+}
+
+- (void)tearDown {
+  self.pageControl = nil;
+
+  [super tearDown];
+}
+
+- (NSArray<CALayer *> *)indicators {
+  return [self.pageControl valueForKey:@"indicators"];
+}
+
+- (CALayer *)animatedIndicator {
+  return [self.pageControl valueForKey:@"animatedIndicator"];
+}
+
+- (UIScrollView *)scrollViewForNumberOfPages:(NSInteger)numberOfPages {
+  UIScrollView *scrollView = [[UIScrollView alloc] initWithFrame:CGRectMake(0, 0, kPageWidth, 480)];
+  scrollView.contentSize = CGSizeMake(kPageWidth * numberOfPages, 480);
+  return scrollView;
+}
+
+- (void)testOnlyVisibleIndicatorsAreCreated {
+  // Then
+  XCTAssertEqual([self indicators].count, (NSUInteger)kMaximumNumberOfVisibleIndicators);
+}
+
+- (void)testIndicatorsAreRecycledAroundTheCurrentPage {
+  // Given
+  NSSet<CALayer *> *originalIndicators = [NSSet setWithArray:[self indicators]];
+
+  // When
+  self.pageControl.currentPage = 500;
+
+  // Then
+  NSArray<CALayer *> *indicators = [self indicators];
+  XCTAssertEqualObjects([NSSet setWithArray:indicators], originalIndicators);
+  XCTAssertTrue(indicators[kMaximumNumberOfVisibleIndicators / 2].hidden);
+}
+
+- (void)testIndicatorsStopAtTheLastPage {
+  // When
+  self.pageControl.currentPage = kLargeNumberOfPages - 1;
+
+  // Then
+  NSArray<CALayer *> *indicators = [self indicators];
+  CGFloat width = [MDCPageControl sizeForNumberOfPages:kMaximumNumberOfVisibleIndicators].width;
+  XCTAssertEqualWithAccuracy(CGRectGetMaxX(indicators.lastObject.frame), width, 0.001);
+  XCTAssertTrue(indicators.lastObject.hidden);
+}
+
+- (void)testWindowedModeSizesTheControlForTheVisibleIndicators {
+  // Given
+  CGSize expectedSize = [MDCPageControl sizeForNumberOfPages:kMaximumNumberOfVisibleIndicators];
+
+  // Then
+  XCTAssertTrue(CGSizeEqualToSize(self.pageControl.intrinsicContentSize, expectedSize));
+  XCTAssertTrue(CGSizeEqualToSize([self.pageControl sizeThatFits:CGSizeZero], expectedSize));
+}
+
+- (void)testIndicatorsPastTheFirstWindowAreLaidOutInsideTheControl {
+  // Given
+  UIScrollView *scrollView = [self scrollViewForNumberOfPages:kLargeNumberOfPages];
+  CGFloat width = self.pageControl.intrinsicContentSize.width;
+  NSInteger centerIndex = kMaximumNumberOfVisibleIndicators / 2;
+
+  // When
+  scrollView.contentOffset = CGPointMake(500 * kPageWidth, 0);
+  [self.pageControl scrollViewDidScroll:scrollView];
+
+  // Then
+  NSArray<CALayer *> *indicators = [self indicators];
+  CGFloat pitch = CGRectGetMinX(indicators[1].frame) - CGRectGetMinX(indicators[0].frame);
+  XCTAssertEqualWithAccuracy(CGRectGetMinX(indicators.firstObject.frame), 0, 0.001);
+  XCTAssertEqualWithAccuracy(CGRectGetMaxX(indicators.lastObject.frame), width, 0.001);
+  for (NSUInteger index = 0; index < indicators.count; index++) {
+    XCTAssertEqualWithAccuracy(CGRectGetMinX(indicators[index].frame), index * pitch, 0.001);
+  }
+  XCTAssertTrue(indicators[centerIndex].hidden);
+  XCTAssertEqualWithAccuracy(CGRectGetMinX([self animatedIndicator].frame),
+                             CGRectGetMinX(indicators[centerIndex].frame), 0.001);
+}
+
+- (void)testScrollingThousandPagesPerformance {
+  // Given
+  UIScrollView *scrollView = [self scrollViewForNumberOfPages:kLargeNumberOfPages];
+  CGFloat tickDistance = kPageWidth / kScrollTicksPerPage;
+  NSInteger tickCount = (kLargeNumberOfPages - 1) * kScrollTicksPerPage;
+
+  // When
+  [self measureBlock:^{
+    for (NSInteger tick = 0; tick <= tickCount; tick++) {
+      scrollView.contentOffset = CGPointMake(tick * tickDistance, 0);
+      [self.pageControl scrollViewDidScroll:scrollView];
+    }
+    [self.pageControl scrollViewDidEndDecelerating:scrollView];
+    scrollView.contentOffset = CGPointZero;
+    [self.pageControl scrollViewDidScroll:scrollView];
+    [self.pageControl scrollViewDidEndDecelerating:scrollView];
+  }];
+
+  // Then
+  XCTAssertEqual([self indicators].count, (NSUInteger)kMaximumNumberOfVisibleIndicators);
+  XCTAssertEqual(self.pageControl.currentPage, 0);
+}
+
+@end
@@ -268,6 +268,30 @@ IB_DESIGNABLE
  */
 @property(nonatomic, assign, getter=isContinuous) BOOL continuous;
 
+/**
+ Whether the continuous update events sent while the user drags the thumb are coalesced to at most
+ one per display frame. The thumb still follows every touch, and a final update event is always sent
+ when the user releases the thumb. Has no effect when @c continuous is NO.
+
+ The default value of this property is NO.
+ */
+@property(nonatomic, assign) BOOL coalescesValueChangeEvents;
+
+/**
+ The minimum time, in seconds, between two coalesced update events. Only used when
+ @c coalescesValueChangeEvents is YES. The final event of a drag is sent regardless of this
+ interval.
+
+ The default value of this property is 0, which allows one event per display frame.
+ */
+@property(nonatomic, assign) NSTimeInterval minimumValueChangeEventInterval;
+
+/** The number of update events sent in response to touches. */
+@property(nonatomic, assign, readonly) NSUInteger valueChangeEventCount;
+
+/** The number of value changes from touches that were coalesced instead of sending an event. */
+@property(nonatomic, assign, readonly) NSUInteger coalescedValueChangeEventCount;
+
 /**
  The value from which the filled part of the track is anchored. If set to a value between
  minimumValue and maximumValue, then the filled/colored part of the track extends from the
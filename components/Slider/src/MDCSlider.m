@@ -270,6 +270,18 @@ static inline UIColor *MDCThumbTrackDefaultColor(void) {
   return _thumbTrack.thumbElevation;
 }
 
+- (void)didMoveToSuperview {
+  [super didMoveToSuperview];
+
+  [self mdc_elevationHierarchyDidChange];
+}
+
+- (void)didMoveToWindow {
+  [super didMoveToWindow];
+
+  [self mdc_elevationHierarchyDidChange];
+}
+
 - (CGFloat)mdc_currentElevation {
   return self.thumbElevation;
 }
@@ -298,6 +310,30 @@ static inline UIColor *MDCThumbTrackDefaultColor(void) {
   _thumbTrack.continuousUpdateEvents = continuous;
 }
 
+- (BOOL)coalescesValueChangeEvents {
+  return _thumbTrack.coalescesValueChangeEvents;
+}
+
+- (void)setCoalescesValueChangeEvents:(BOOL)coalescesValueChangeEvents {
+  _thumbTrack.coalescesValueChangeEvents = coalescesValueChangeEvents;
+}
+
+- (NSTimeInterval)minimumValueChangeEventInterval {
+  return _thumbTrack.minimumValueChangeEventInterval;
+}
+
+- (void)setMinimumValueChangeEventInterval:(NSTimeInterval)minimumValueChangeEventInterval {
+  _thumbTrack.minimumValueChangeEventInterval = minimumValueChangeEventInterval;
+}
+
+- (NSUInteger)valueChangeEventCount {
+  return _thumbTrack.valueChangeEventCount;
+}
+
+- (NSUInteger)coalescedValueChangeEventCount {
+  return _thumbTrack.coalescedValueChangeEventCount;
+}
+
 - (CGFloat)value {
   return _thumbTrack.value;
 }
@@ -1380,6 +1380,19 @@ static const CGFloat kEpsilonAccuracy = (CGFloat)0.001;
   XCTAssertFalse(blockCalled);
 }
 
+- (void)testCoalescingValueChangeEventsIsForwardedToThumbTrack {
+  // When
+  self.slider.coalescesValueChangeEvents = YES;
+  self.slider.minimumValueChangeEventInterval = (NSTimeInterval)0.1;
+
+  // Then
+  XCTAssertTrue(self.slider.thumbTrack.coalescesValueChangeEvents);
+  XCTAssertEqualWithAccuracy(self.slider.thumbTrack.minimumValueChangeEventInterval, 0.1,
+                             kEpsilonAccuracy);
+  XCTAssertEqual(self.slider.valueChangeEventCount, 0U);
+  XCTAssertEqual(self.slider.coalescedValueChangeEventCount, 0U);
+}
+
 #pragma mark Private test helpers
 
 - (CGFloat)randomNumber {
@@ -37,6 +37,23 @@
 
 @end
 
+/**
+ Policies used to decide which message is discarded when the pending message queue is full.
+ */
+typedef NS_ENUM(NSInteger, MDCSnackbarPendingMessageDropPolicy) {
+  /**
+   The oldest pending message of the lowest priority is discarded to make room for the incoming
+   message. If every pending message has a higher priority than the incoming message, the incoming
+   message is discarded instead.
+   */
+  MDCSnackbarPendingMessageDropPolicyDropOldest = 0,
+
+  /**
+   The incoming message is discarded.
+   */
+  MDCSnackbarPendingMessageDropPolicyDropNewest = 1,
+};
+
 /**
  Provides a means of displaying an unobtrusive message to the user.
 
@@ -120,6 +137,38 @@
  */
 - (void)setBottomOffset:(CGFloat)offset;
 
+#pragma mark Queueing
+
+/**
+ The maximum number of messages that may be waiting to be shown.
+
+ When a message is passed to @c showMessage: while the queue is full, @c pendingMessageDropPolicy
+ decides which message is discarded. The completion handler of a discarded message is called as if
+ the message had been dismissed without user interaction. The currently showing message does not
+ count towards this limit.
+
+ Default is 0, which means the queue is unbounded.
+ */
+@property(nonatomic, assign) NSUInteger maximumPendingMessageCount;
+
+/**
+ The policy used to discard a message when @c maximumPendingMessageCount is reached.
+
+ Default is @c MDCSnackbarPendingMessageDropPolicyDropOldest.
+ */
+@property(nonatomic, assign) MDCSnackbarPendingMessageDropPolicy pendingMessageDropPolicy;
+
+/**
+ Whether a message that duplicates a showing or pending message is discarded.
+
+ Two messages are duplicates when their attributed text, category, priority and action title are
+ equal. The completion handler of a discarded duplicate is called as if the message had been
+ dismissed without user interaction.
+
+ Default is NO.
+ */
+@property(nonatomic, assign) BOOL coalescesDuplicateMessages;
+
 #pragma mark Suspending
 
 /**
@@ -18,9 +18,11 @@
 #import "MDCSnackbarMessageView.h"
 #import "MaterialApplication.h"
 #import "MaterialOverlayWindow.h"
+#import "MaterialTypography.h"
 
 #import "private/MDCSnackbarManagerInternal.h"
 #import "private/MDCSnackbarMessageInternal.h"
+#import "private/MDCSnackbarMessageQueue.h"
 #import "private/MDCSnackbarMessageViewInternal.h"
 #import "private/MDCSnackbarOverlayView.h"
 
@@ -35,6 +37,20 @@ static BOOL UIViewHasFocusedAccessibilityElement(UIView *view) {
   return NO;
 };
 
+/**
+ The serial queue on which Snackbar message layouts are precomputed.
+ */
+static dispatch_queue_t MDCSnackbarLayoutQueue(void) {
+  static dispatch_queue_t layoutQueue;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    dispatch_queue_attr_t attributes = dispatch_queue_attr_make_with_qos_class(
+        DISPATCH_QUEUE_SERIAL, QOS_CLASS_USER_INITIATED, 0);
+    layoutQueue = dispatch_queue_create("com.material.components.snackbar.layout", attributes);
+  });
+  return layoutQueue;
+}
+
 @class MDCSnackbarManagerSuspensionToken;
 
 /**
@@ -61,9 +77,9 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
 @property(nonatomic, weak) MDCSnackbarManager *manager;
 
 /**
- The list of messages waiting to be displayed.
+ The messages waiting to be displayed.
  */
-@property(nonatomic) NSMutableArray *pendingMessages;
+@property(nonatomic) MDCSnackbarMessageQueue *pendingMessages;
 
 /**
  The current suspension tokens.
@@ -93,6 +109,12 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
  */
 @property(nonatomic) BOOL showingMessage;
 
+/**
+ The content width of the most recently presented Snackbar, or 0 if none has been presented yet.
+ Used as the width for precomputing message layouts, and read from any thread.
+ */
+@property(atomic) CGFloat messageContentWidthHint;
+
 /**
  The delegate for MDCSnackbarManagerDelegate
  */
@@ -124,7 +146,7 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
   self = [super init];
   if (self) {
     _manager = manager;
-    _pendingMessages = [[NSMutableArray alloc] init];
+    _pendingMessages = [[MDCSnackbarMessageQueue alloc] init];
     _suspensionTokens = [NSMutableDictionary dictionary];
   }
   return self;
@@ -132,53 +154,14 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
 
 #pragma mark - Message Displaying
 
-/**
- Determines whether or not a message is eligible to be shown based on the Snackbar manager's current
- configuration.
-
- @note This method should ensure that messages in the same category are not shown out of order.
- */
-- (BOOL)shouldShowMessageRightNowMainThread:(MDCSnackbarMessage *)message {
-  // If there are outstanding suspension tokens for all messages (not just specific categories),
-  // then hold off on displaying.
-  if ([self allMessagesSuspendedMainThread]) {
-    return NO;
-  }
-
-  // If there is an outstanding suspension token for this message category, then hold off on
-  // displaying.
-  if (message.category != nil && [self categorySuspended:message.category]) {
-    return NO;
-  }
-
-  return YES;
-}
-
 - (MDCSnackbarMessage *)dequeueNextShowableMessageMainThread {
-  // NOTE: In pathological cases, the iteration through the pending messages can be an O(n)
-  //       operation. Though we expect `n` to be low, to protect against needless iteration we'll
-  //       do a quick check to see if message displaying is completely suspended.
+  // Category suspensions are tracked by the queue itself, so only the all messages suspension needs
+  // to be checked here.
   if ([self allMessagesSuspendedMainThread]) {
     return nil;
   }
 
-  __block NSUInteger messageIndex = NSNotFound;
-  [self.pendingMessages
-      enumerateObjectsUsingBlock:^(MDCSnackbarMessage *message, NSUInteger idx, BOOL *stop) {
-        if ([self shouldShowMessageRightNowMainThread:message]) {
-          messageIndex = idx;
-          *stop = YES;
-        }
-      }];
-
-  if (messageIndex != NSNotFound) {
-    MDCSnackbarMessage *message = self.pendingMessages[messageIndex];
-    [self.pendingMessages removeObjectAtIndex:messageIndex];
-
-    return message;
-  }
-
-  return nil;
+  return [self.pendingMessages dequeueNextShowableMessage];
 }
 
 // Dequeues and schedules the display of a particular message.
@@ -241,6 +224,9 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
       showSnackbarView:snackbarView
               animated:YES
             completion:^{
+              // Later messages are most likely to be shown at the same width.
+              self.messageContentWidthHint = snackbarView.contentWidth;
+
               if (snackbarView.accessibilityViewIsModal ||
                   ![self isSnackbarTransient:snackbarView]) {
                 UIAccessibilityPostNotification(UIAccessibilityLayoutChangedNotification,
@@ -403,6 +389,73 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
   }
 }
 
+#pragma mark - Layout Precomputation
+
+/**
+ Starts measuring @c message on a background queue so that its view can be configured without
+ measuring text on the main thread.
+
+ Must be called from the main thread. The manager's styling, the typography fonts and the width are
+ all captured here, so the background queue reads no shared state. If the fonts can't be resolved
+ without a trait environment, or the width isn't known until the Snackbar is shown, nothing is
+ measured and the view falls back to measuring itself.
+ */
+- (void)precomputeLayoutForMessage:(MDCSnackbarMessage *)message {
+  MDCSnackbarManager *manager = self.manager;
+  Class viewClass = [message viewClass];
+  if (!manager || ![viewClass isSubclassOfClass:[MDCSnackbarMessageView class]]) {
+    return;
+  }
+
+  // Until a Snackbar has been shown, estimate its width from the overlay it will be shown in.
+  CGFloat contentWidth = self.messageContentWidthHint;
+  if (contentWidth <= 0) {
+    CGFloat viewWidth = [self.overlayView expectedSnackbarViewWidth];
+    UIEdgeInsets safeAreaInsets = UIEdgeInsetsZero;
+    if (@available(iOS 11.0, *)) {
+      safeAreaInsets = self.overlayView.window.safeAreaInsets;
+    }
+    if (viewWidth > 0) {
+      contentWidth = [viewClass contentWidthForViewWidth:viewWidth safeAreaInsets:safeAreaInsets];
+    }
+  }
+  if (contentWidth <= 0) {
+    return;
+  }
+
+  BOOL adjustsFont = manager.mdc_adjustsFontForContentSizeCategory;
+  BOOL adjustsWhenUnavailable =
+      manager.adjustsFontForContentSizeCategoryWhenScaledFontIsUnavailable;
+  UIFont *messageFont = [viewClass messageFontForFont:manager.messageFont
+                    adjustsFontForContentSizeCategory:adjustsFont
+                   adjustsWhenScaledFontIsUnavailable:adjustsWhenUnavailable
+                                     traitEnvironment:nil];
+  UIFont *buttonFont = [viewClass buttonFontForFont:manager.buttonFont
+                  adjustsFontForContentSizeCategory:adjustsFont
+                 adjustsWhenScaledFontIsUnavailable:adjustsWhenUnavailable
+                                   traitEnvironment:nil];
+  if (!messageFont || (message.action && !buttonFont)) {
+    return;
+  }
+  BOOL uppercaseButtonTitle = manager.uppercaseButtonTitle;
+  UIFont *regularFont = nil;
+  UIFont *boldFont = nil;
+  if (!manager.messageFont && !adjustsFont) {
+    regularFont = [MDCTypography body1Font];
+    boldFont = [MDCTypography body2Font];
+  }
+
+  dispatch_async(MDCSnackbarLayoutQueue(), ^{
+    message.precomputedLayout = [viewClass layoutForMessage:message
+                                                messageFont:messageFont
+                                                 buttonFont:buttonFont
+                                       uppercaseButtonTitle:uppercaseButtonTitle
+                                                regularFont:regularFont
+                                                   boldFont:boldFont
+                                               contentWidth:contentWidth];
+  });
+}
+
 #pragma mark - Public API
 
 // Must be called from the main thread only.
@@ -410,18 +463,41 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
   // Ensure that this method is called on the main thread.
   NSAssert([NSThread isMainThread], @"Method is not called on main thread.");
 
+  // A duplicate of the message on screen or of a pending message is discarded before anything of
+  // its category is dismissed, so that the original stays where it is.
+  MDCSnackbarManager *manager = self.manager;
+  if (manager.coalescesDuplicateMessages && [self isDuplicateOfShowingOrPendingMessage:message]) {
+    [message executeCompletionHandlerWithUserInteraction:NO completion:nil];
+    return;
+  }
+
   // Dismiss and call the completion block for all the messages from the same category.
   [self dismissAndCallCompletionBlocksOnMainThreadWithCategory:message.category];
 
   // Add the new message to the queue, the call to @c showNextMessageIfNecessaryMainThread will take
   // care of getting it on screen. At this moment, @c message is the only message of its category
-  // in @c _sPendingMessages.
-  [self.pendingMessages addObject:message];
+  // in @c pendingMessages.
+  self.pendingMessages.maximumCount = manager.maximumPendingMessageCount;
+  self.pendingMessages.dropPolicy = manager.pendingMessageDropPolicy;
+  self.pendingMessages.coalescesDuplicates = manager.coalescesDuplicateMessages;
+  NSArray<MDCSnackbarMessage *> *droppedMessages = [self.pendingMessages enqueueMessage:message];
+  for (MDCSnackbarMessage *droppedMessage in droppedMessages) {
+    [droppedMessage executeCompletionHandlerWithUserInteraction:NO completion:nil];
+  }
 
   // Pulse the UI as needed.
   [self showNextMessageIfNecessaryMainThread];
 }
 
+- (BOOL)isDuplicateOfShowingOrPendingMessage:(MDCSnackbarMessage *)message {
+  if (self.currentSnackbar != nil && !self.currentSnackbar.dismissing &&
+      [MDCSnackbarMessageQueue isMessage:message
+                      duplicateOfMessage:self.currentSnackbar.message]) {
+    return YES;
+  }
+  return [self.pendingMessages containsDuplicateOfMessage:message];
+}
+
 - (void)dismissAndCallCompletionBlocksOnMainThreadWithCategory:(NSString *)categoryToDismiss {
   // Ensure that this method is called on the main thread.
   NSAssert([NSThread isMainThread], @"Method is not called on main thread.");
@@ -439,24 +515,14 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
     }
   }
 
-  // Now that we've ensured that the currently showing Snackbar has been taken care of, we can go
-  // through pending messages and fire off their completion blocks as we remove them from the
-  // queue.
-  NSMutableIndexSet *indexesToRemove = [NSMutableIndexSet indexSet];
-  [self.pendingMessages enumerateObjectsUsingBlock:^(MDCSnackbarMessage *pendingMessage,
-                                                     NSUInteger idx, __unused BOOL *stop) {
-    if (!categoryToDismiss || [pendingMessage.category isEqualToString:categoryToDismiss]) {
-      // Mark the message for removal from the pending messages list.
-      [indexesToRemove addIndex:idx];
-
-      // Notify the outside world that this Snackbar has been completed.
-      [pendingMessage executeCompletionHandlerWithUserInteraction:NO completion:nil];
-    }
-  }];
-
-  // Make sure the queued up messages aren't shown.
-  if ([indexesToRemove count]) {
-    [self.pendingMessages removeObjectsAtIndexes:indexesToRemove];
+  // Now that we've ensured that the currently showing Snackbar has been taken care of, we can
+  // remove the pending messages from the queue so they aren't shown, and fire off their completion
+  // blocks in the order they were queued.
+  NSArray<MDCSnackbarMessage *> *removedMessages =
+      [self.pendingMessages removeMessagesWithCategory:categoryToDismiss];
+  for (MDCSnackbarMessage *pendingMessage in removedMessages) {
+    // Notify the outside world that this Snackbar has been completed.
+    [pendingMessage executeCompletionHandlerWithUserInteraction:NO completion:nil];
   }
 }
 
@@ -473,17 +539,6 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
   return NO;
 }
 
-/**
- Returns YES if message display is suspended for the given category.
- */
-- (BOOL)categorySuspended:(NSString *)category {
-  NSMutableSet *thisCategorySuspensions = self.suspensionTokens[category];
-  if (thisCategorySuspensions.count > 0) {
-    return YES;
-  }
-  return NO;
-}
-
 - (void)addSuspensionIdentifierMainThread:(NSUUID *)identifier forCategory:(NSString *)category {
   // Ensure that this method is called on the main thread.
   NSAssert([NSThread isMainThread], @"Method is not called on main thread.");
@@ -492,6 +547,9 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
   if (tokens == nil) {
     tokens = [NSMutableSet set];
     self.suspensionTokens[category] = tokens;
+    if (![category isEqualToString:kAllMessagesCategory]) {
+      [self.pendingMessages suspendCategory:category];
+    }
   }
 
   [tokens addObject:identifier];
@@ -507,6 +565,9 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
   // If that was the last token for this category, do some cleanup.
   if (tokens != nil && tokens.count == 0) {
     [self.suspensionTokens removeObjectForKey:category];
+    if (![category isEqualToString:kAllMessagesCategory]) {
+      [self.pendingMessages resumeCategory:category];
+    }
   }
 
   // We may have removed the last suspend, so trigger a display.
@@ -576,8 +637,18 @@ static NSString *const kAllMessagesCategory = @"$$___ALL_MESSAGES___$$";
   // Snag a copy now, we'll use that internally.
   MDCSnackbarMessage *message = [inputMessage copy];
 
+  // Measure the message off the main thread while it waits to be shown. The styling it is measured
+  // with belongs to the main thread, so it is captured there.
+  BOOL isMainThread = [NSThread isMainThread];
+  if (isMainThread) {
+    [self.internalManager precomputeLayoutForMessage:message];
+  }
+
   // Ensure that all of our work happens on the main thread.
   dispatch_async(dispatch_get_main_queue(), ^{
+    if (!isMainThread) {
+      [self.internalManager precomputeLayoutForMessage:message];
+    }
     [self.internalManager showMessageMainThread:message];
   });
 }
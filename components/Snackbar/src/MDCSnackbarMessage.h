@@ -42,6 +42,29 @@ extern const NSTimeInterval MDCSnackbarMessageDurationMax;
  */
 extern NSString *__nonnull const MDCSnackbarMessageBoldAttributeName;
 
+/**
+ Priorities used to order pending Snackbar messages.
+
+ Pending messages of a higher priority are always shown before pending messages of a lower priority.
+ Messages of the same priority are shown in the order they were passed to the manager.
+ */
+typedef NS_ENUM(NSInteger, MDCSnackbarMessagePriority) {
+  /**
+   The message is shown after all pending normal and high priority messages.
+   */
+  MDCSnackbarMessagePriorityLow = 0,
+
+  /**
+   The default priority.
+   */
+  MDCSnackbarMessagePriorityNormal = 1,
+
+  /**
+   The message is shown before all pending normal and low priority messages.
+   */
+  MDCSnackbarMessagePriorityHigh = 2,
+};
+
 /**
  Represents a message to unobtrusively show to the user.
 
@@ -131,6 +154,16 @@ extern NSString *__nonnull const MDCSnackbarMessageBoldAttributeName;
  */
 @property(nonatomic, copy, nullable) NSString *category;
 
+/**
+ The priority of the message relative to other pending messages.
+
+ Priority only affects the order in which pending messages are shown; a message that is already on
+ screen is never interrupted by a higher priority message.
+
+ Default is @c MDCSnackbarMessagePriorityNormal.
+ */
+@property(nonatomic, assign) MDCSnackbarMessagePriority priority;
+
 /**
  Redeclaration from UIAccessibility to make clear that this class supports accessibility labels.
  */
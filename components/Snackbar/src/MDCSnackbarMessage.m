@@ -50,6 +50,7 @@ static BOOL _usesLegacySnackbar = NO;
   self = [super init];
   if (self) {
     _duration = kDefaultDuration;
+    _priority = MDCSnackbarMessagePriorityNormal;
   }
   return self;
 }
@@ -63,6 +64,7 @@ static BOOL _usesLegacySnackbar = NO;
   copy.attributedText = self.attributedText;
   copy.duration = self.duration;
   copy.category = self.category;
+  copy.priority = self.priority;
   copy.accessibilityLabel = self.accessibilityLabel;
   copy.accessibilityHint = self.accessibilityHint;
 #pragma clang diagnostic push
@@ -22,6 +22,8 @@
 #import "MaterialMath.h"
 #import "MaterialShadowLayer.h"
 #import "MaterialTypography.h"
+#import "private/MDCSnackbarMessageInternal.h"
+#import "private/MDCSnackbarMessageLayout.h"
 #import "private/MDCSnackbarMessageViewInternal.h"
 #import "private/MDCSnackbarOverlayView.h"
 #import "private/MaterialSnackbarStrings.h"
@@ -104,6 +106,62 @@ static const MDCFontTextStyle kButtonTextStyle = MDCFontTextStyleButton;
 @end
 #endif
 
+/**
+ The label displaying the message text.
+
+ When a precomputed size is set, it is reported as the label's intrinsic content size so that Auto
+ Layout does not re-measure the text.
+ */
+@interface MDCSnackbarMessageLabel : UILabel
+
+/**
+ The size of the text measured ahead of time, or CGSizeZero if the label should measure itself.
+ */
+@property(nonatomic, assign) CGSize precomputedSize;
+
+/** The width the text was wrapped to when @c precomputedSize was measured. */
+@property(nonatomic, assign) CGFloat precomputedWidth;
+
+@end
+
+@implementation MDCSnackbarMessageLabel
+
+- (void)setPrecomputedSize:(CGSize)precomputedSize {
+  if (!CGSizeEqualToSize(_precomputedSize, precomputedSize)) {
+    _precomputedSize = precomputedSize;
+    [self invalidateIntrinsicContentSize];
+  }
+}
+
+- (void)setPrecomputedWidth:(CGFloat)precomputedWidth {
+  if (_precomputedWidth != precomputedWidth) {
+    _precomputedWidth = precomputedWidth;
+    [self invalidateIntrinsicContentSize];
+  }
+}
+
+- (CGSize)intrinsicContentSize {
+  // The precomputed size only holds for the width it was wrapped to. Once the label has been given
+  // a different width, measure the text so that it isn't clipped.
+  CGFloat width = self.preferredMaxLayoutWidth > 0 ? self.preferredMaxLayoutWidth
+                                                    : CGRectGetWidth(self.bounds);
+  BOOL widthMatches = width <= 0 || MDCFabs(width - self.precomputedWidth) <= (CGFloat)0.5;
+  if (!CGSizeEqualToSize(self.precomputedSize, CGSizeZero) && widthMatches) {
+    return self.precomputedSize;
+  }
+  return [super intrinsicContentSize];
+}
+
+- (void)setBounds:(CGRect)bounds {
+  BOOL widthChanged = CGRectGetWidth(bounds) != CGRectGetWidth(self.bounds);
+  [super setBounds:bounds];
+  if (widthChanged && !CGSizeEqualToSize(self.precomputedSize, CGSizeZero)) {
+    [self invalidateIntrinsicContentSize];
+  }
+}
+
+@end
+
 @interface MDCSnackbarMessageView ()
 
 /**
@@ -119,7 +177,7 @@ static const MDCFontTextStyle kButtonTextStyle = MDCFontTextStyleButton;
 /**
  Holds the text label for the main message.
  */
-@property(nonatomic, strong) UILabel *label;
+@property(nonatomic, strong) MDCSnackbarMessageLabel *label;
 
 /**
  The constraints managing this view.
@@ -146,6 +204,12 @@ static const MDCFontTextStyle kButtonTextStyle = MDCFontTextStyleButton;
  */
 @property(nonatomic, copy) MDCSnackbarMessageDismissHandler dismissalHandler;
 
+/**
+ The layout measured on a background queue when the message was passed to the manager, if its fonts
+ match the ones this view uses. Discarded as soon as it no longer describes the view.
+ */
+@property(nonatomic, strong) MDCSnackbarMessageLayout *precomputedLayout;
+
 @end
 
 @interface MDCSnackbarMessageViewButton : MDCFlatButton
@@ -282,31 +346,16 @@ static const MDCFontTextStyle kButtonTextStyle = MDCFontTextStyleButton;
     _actionButtons = [[NSMutableArray alloc] init];
 
     // Set up the title label.
-    _label = [[UILabel alloc] initWithFrame:CGRectZero];
+    _label = [[MDCSnackbarMessageLabel alloc] initWithFrame:CGRectZero];
     [_contentView addSubview:_label];
     // TODO(#2709): Migrate to a single source of truth for fonts
     // If we are using the default (system) font loader, retrieve the
     // font from the UIFont standardFont API.
     [self updateMessageFont];
 
-    NSMutableAttributedString *messageString = [message.attributedText mutableCopy];
-
-    if (!_messageFont && !_mdc_adjustsFontForContentSizeCategory) {
-      // Find any of the bold attributes in the string, and set the proper font for those ranges.
-      // Use NSAttributedStringEnumerationLongestEffectiveRangeNotRequired as opposed to 0,
-      // otherwise it will only work if bold text is in the end.
-      [messageString
-          enumerateAttribute:MDCSnackbarMessageBoldAttributeName
-                     inRange:NSMakeRange(0, messageString.length)
-                     options:NSAttributedStringEnumerationLongestEffectiveRangeNotRequired
-                  usingBlock:^(id value, NSRange range, __unused BOOL *stop) {
-                    UIFont *font = [MDCTypography body1Font];
-                    if ([value boolValue]) {
-                      font = [MDCTypography body2Font];
-                    }
-                    [messageString setAttributes:@{NSFontAttributeName : font} range:range];
-                  }];
-    }
+    NSAttributedString *messageString = [MDCSnackbarMessageLayout
+        attributedTextForMessage:message
+                  applyBoldFonts:!_messageFont && !_mdc_adjustsFontForContentSizeCategory];
 
     // Apply 'global' attributes along the whole string.
     _label.backgroundColor = [UIColor clearColor];
@@ -344,6 +393,21 @@ static const MDCFontTextStyle kButtonTextStyle = MDCFontTextStyleButton;
     _label.textColor = _messageTextColor;
 
     [self initializeMDCSnackbarMessageViewButtons:message withManager:manager];
+
+    // Only adopt the precomputed layout once the fonts have been resolved, so that it can be
+    // checked against them.
+    MDCSnackbarMessageLayout *precomputedLayout = message.precomputedLayout;
+    MDCButton *actionButton = _actionButtons.firstObject;
+    UIFont *buttonFont = [actionButton titleFontForState:UIControlStateNormal];
+    BOOL buttonSizeMatches =
+        !actionButton || MDCFabs(actionButton.intrinsicContentSize.width -
+                                 precomputedLayout.actionButtonSize.width) <= (CGFloat)0.5;
+    if (buttonSizeMatches &&
+        [precomputedLayout isValidForMessageFont:_label.font buttonFont:buttonFont]) {
+      _precomputedLayout = precomputedLayout;
+      _label.precomputedWidth = precomputedLayout.messageWidth;
+      _label.precomputedSize = precomputedLayout.messageSize;
+    }
   }
 
   return self;
@@ -522,48 +586,68 @@ static const MDCFontTextStyle kButtonTextStyle = MDCFontTextStyleButton;
 }
 
 - (void)updateMessageFont {
+  UIFont *font =
+      [[self class] messageFontForFont:_messageFont
+            adjustsFontForContentSizeCategory:_mdc_adjustsFontForContentSizeCategory
+          adjustsWhenScaledFontIsUnavailable:
+              _adjustsFontForContentSizeCategoryWhenScaledFontIsUnavailable
+                             traitEnvironment:self];
+  if (font) {
+    _label.font = font;
+  }
+  [self discardPrecomputedLayout];
+  [self setNeedsLayout];
+}
+
+/**
+ Resolves the font of the message label.
+
+ Returns nil if the label's current font should be kept, or if resolving the font requires a trait
+ environment and @c traitEnvironment is nil.
+ */
++ (UIFont *)messageFontForFont:(UIFont *)messageFont
+    adjustsFontForContentSizeCategory:(BOOL)adjustsFontForContentSizeCategory
+    adjustsWhenScaledFontIsUnavailable:(BOOL)adjustsWhenScaledFontIsUnavailable
+                      traitEnvironment:(id<UITraitEnvironment>)traitEnvironment {
   // If we have a custom font apply it to the label.
   // If not, fall back to the Material specified font.
-  if (_messageFont) {
+  if (messageFont) {
     // If we are automatically adjusting for Dynamic Type resize the font based on the text style
-    if (_mdc_adjustsFontForContentSizeCategory) {
-      if (_messageFont.mdc_scalingCurve) {
-        _label.font = [_messageFont mdc_scaledFontForTraitEnvironment:self];
-      } else if (_adjustsFontForContentSizeCategoryWhenScaledFontIsUnavailable) {
-        _label.font =
-            [_messageFont mdc_fontSizedForMaterialTextStyle:kMessageTextStyle
-                                       scaledForDynamicType:_mdc_adjustsFontForContentSizeCategory];
+    if (adjustsFontForContentSizeCategory) {
+      if (messageFont.mdc_scalingCurve) {
+        return traitEnvironment ? [messageFont mdc_scaledFontForTraitEnvironment:traitEnvironment]
+                                : nil;
+      } else if (adjustsWhenScaledFontIsUnavailable) {
+        return [messageFont mdc_fontSizedForMaterialTextStyle:kMessageTextStyle
+                                         scaledForDynamicType:adjustsFontForContentSizeCategory];
       }
-    } else {
-      _label.font = _messageFont;
+      return nil;
     }
-  } else {
-    // TODO(#2709): Migrate to a single source of truth for fonts
-    // There is no custom font, so use the default font.
-    if (_mdc_adjustsFontForContentSizeCategory) {
-      // If we are using the default (system) font loader, retrieve the
-      // font from the UIFont preferredFont API.
-      if ([MDCTypography.fontLoader isKindOfClass:[MDCSystemFontLoader class]]) {
-        _label.font = [UIFont mdc_preferredFontForMaterialTextStyle:kMessageTextStyle];
-      } else {
-        // There is a custom font loader, retrieve the font and scale it.
-        UIFont *customTypographyFont = [MDCTypography body1Font];
-        _label.font = [customTypographyFont
-            mdc_fontSizedForMaterialTextStyle:kMessageTextStyle
-                         scaledForDynamicType:_mdc_adjustsFontForContentSizeCategory];
-      }
-    } else {
-      // If we are using the default (system) font loader, retrieve the
-      // font from the UIFont standardFont API.
-      if ([MDCTypography.fontLoader isKindOfClass:[MDCSystemFontLoader class]]) {
-        _label.font = [UIFont mdc_standardFontForMaterialTextStyle:kMessageTextStyle];
-      } else {
-        // There is a custom font loader, retrieve the font from it.
-        _label.font = [MDCTypography body1Font];
-      }
+    return messageFont;
+  }
+
+  // TODO(#2709): Migrate to a single source of truth for fonts
+  // There is no custom font, so use the default font.
+  if (adjustsFontForContentSizeCategory) {
+    // If we are using the default (system) font loader, retrieve the
+    // font from the UIFont preferredFont API.
+    if ([MDCTypography.fontLoader isKindOfClass:[MDCSystemFontLoader class]]) {
+      return [UIFont mdc_preferredFontForMaterialTextStyle:kMessageTextStyle];
     }
+    // There is a custom font loader, retrieve the font and scale it.
+    UIFont *customTypographyFont = [MDCTypography body1Font];
+    return [customTypographyFont
+        mdc_fontSizedForMaterialTextStyle:kMessageTextStyle
+                     scaledForDynamicType:adjustsFontForContentSizeCategory];
   }
-  [self setNeedsLayout];
+
+  // If we are using the default (system) font loader, retrieve the
+  // font from the UIFont standardFont API.
+  if ([MDCTypography.fontLoader isKindOfClass:[MDCSystemFontLoader class]]) {
+    return [UIFont mdc_standardFontForMaterialTextStyle:kMessageTextStyle];
+  }
+  // There is a custom font loader, retrieve the font from it.
+  return [MDCTypography body1Font];
 }
 
 - (UIFont *)buttonFont {
@@ -577,55 +661,69 @@ static const MDCFontTextStyle kButtonTextStyle = MDCFontTextStyleButton;
 }
 
 - (void)updateButtonFont {
-  UIFont *finalButtonFont;
+  UIFont *finalButtonFont =
+      [[self class] buttonFontForFont:_buttonFont
+            adjustsFontForContentSizeCategory:_mdc_adjustsFontForContentSizeCategory
+          adjustsWhenScaledFontIsUnavailable:
+              _adjustsFontForContentSizeCategoryWhenScaledFontIsUnavailable
+                             traitEnvironment:self];
 
+  for (MDCButton *button in _actionButtons) {
+    [button setTitleFont:finalButtonFont forState:UIControlStateNormal];
+    [button setTitleFont:finalButtonFont forState:UIControlStateHighlighted];
+  }
+
+  [self discardPrecomputedLayout];
+  [self setNeedsLayout];
+}
+
+/**
+ Resolves the font of the action buttons.
+
+ Returns nil if resolving the font requires a trait environment and @c traitEnvironment is nil.
+ */
++ (UIFont *)buttonFontForFont:(UIFont *)buttonFont
+    adjustsFontForContentSizeCategory:(BOOL)adjustsFontForContentSizeCategory
+    adjustsWhenScaledFontIsUnavailable:(BOOL)adjustsWhenScaledFontIsUnavailable
+                      traitEnvironment:(id<UITraitEnvironment>)traitEnvironment {
   // If we have a custom font apply it to the label.
   // If not, fall back to the Material specified font.
-  if (_buttonFont) {
-    finalButtonFont = _buttonFont;
+  if (buttonFont) {
     // If we are automatically adjusting for Dynamic Type resize the font based on the text style
-    if (_mdc_adjustsFontForContentSizeCategory) {
-      if (_buttonFont.mdc_scalingCurve) {
-        finalButtonFont = [_buttonFont mdc_scaledFontForTraitEnvironment:self];
-      } else if (_adjustsFontForContentSizeCategoryWhenScaledFontIsUnavailable) {
-        finalButtonFont =
-            [_buttonFont mdc_fontSizedForMaterialTextStyle:kButtonTextStyle
-                                      scaledForDynamicType:_mdc_adjustsFontForContentSizeCategory];
-      }
-    }
-  } else {
-    // TODO(#2709): Migrate to a single source of truth for fonts
-    // There is no custom font, so use the default font.
-    if (_mdc_adjustsFontForContentSizeCategory) {
-      // If we are using the default (system) font loader, retrieve the
-      // font from the UIFont preferredFont API.
-      if ([MDCTypography.fontLoader isKindOfClass:[MDCSystemFontLoader class]]) {
-        finalButtonFont = [UIFont mdc_preferredFontForMaterialTextStyle:kButtonTextStyle];
-      } else {
-        // There is a custom font loader, retrieve the font and scale it.
-        UIFont *customTypographyFont = [MDCTypography buttonFont];
-        finalButtonFont = [customTypographyFont
-            mdc_fontSizedForMaterialTextStyle:kButtonTextStyle
-                         scaledForDynamicType:_mdc_adjustsFontForContentSizeCategory];
-      }
-    } else {
-      // If we are using the default (system) font loader, retrieve the
-      // font from the UIFont standardFont API.
-      if ([MDCTypography.fontLoader isKindOfClass:[MDCSystemFontLoader class]]) {
-        finalButtonFont = [UIFont mdc_standardFontForMaterialTextStyle:kButtonTextStyle];
-      } else {
-        // There is a custom font loader, retrieve the font from it.
-        finalButtonFont = [MDCTypography buttonFont];
+    if (adjustsFontForContentSizeCategory) {
+      if (buttonFont.mdc_scalingCurve) {
+        return traitEnvironment ? [buttonFont mdc_scaledFontForTraitEnvironment:traitEnvironment]
+                                : nil;
+      } else if (adjustsWhenScaledFontIsUnavailable) {
+        return [buttonFont mdc_fontSizedForMaterialTextStyle:kButtonTextStyle
+                                        scaledForDynamicType:adjustsFontForContentSizeCategory];
       }
     }
+    return buttonFont;
   }
 
-  for (MDCButton *button in _actionButtons) {
-    [button setTitleFont:finalButtonFont forState:UIControlStateNormal];
-    [button setTitleFont:finalButtonFont forState:UIControlStateHighlighted];
+  // TODO(#2709): Migrate to a single source of truth for fonts
+  // There is no custom font, so use the default font.
+  if (adjustsFontForContentSizeCategory) {
+    // If we are using the default (system) font loader, retrieve the
+    // font from the UIFont preferredFont API.
+    if ([MDCTypography.fontLoader isKindOfClass:[MDCSystemFontLoader class]]) {
+      return [UIFont mdc_preferredFontForMaterialTextStyle:kButtonTextStyle];
+    }
+    // There is a custom font loader, retrieve the font and scale it.
+    UIFont *customTypographyFont = [MDCTypography buttonFont];
+    return [customTypographyFont
+        mdc_fontSizedForMaterialTextStyle:kButtonTextStyle
+                     scaledForDynamicType:adjustsFontForContentSizeCategory];
   }
 
-  [self setNeedsLayout];
+  // If we are using the default (system) font loader, retrieve the
+  // font from the UIFont standardFont API.
+  if ([MDCTypography.fontLoader isKindOfClass:[MDCSystemFontLoader class]]) {
+    return [UIFont mdc_standardFontForMaterialTextStyle:kButtonTextStyle];
+  }
+  // There is a custom font loader, retrieve the font from it.
+  return [MDCTypography buttonFont];
 }
 
 - (BOOL)shouldWaitForDismissalDuringVoiceover {
@@ -926,6 +1024,14 @@ static const MDCFontTextStyle kButtonTextStyle = MDCFontTextStyleButton;
 - (void)layoutSubviews {
   [super layoutSubviews];
 
+  // The precomputed layout assumed a width for the Snackbar's content. If the Snackbar ended up
+  // with a different one, let the label measure itself.
+  if (self.precomputedLayout &&
+      MDCFabs(self.contentWidth - self.precomputedLayout.contentWidth) > (CGFloat)0.5) {
+    [self discardPrecomputedLayout];
+    [self setNeedsLayout];
+  }
+
   // As our layout changes, make sure that the shadow path is kept up-to-date.
   UIBezierPath *path = [UIBezierPath
       bezierPathWithRoundedRect:self.bounds
@@ -937,6 +1043,46 @@ static const MDCFontTextStyle kButtonTextStyle = MDCFontTextStyleButton;
 
 #pragma mark - Sizing
 
+- (void)discardPrecomputedLayout {
+  if (self.precomputedLayout) {
+    self.precomputedLayout = nil;
+    self.label.precomputedSize = CGSizeZero;
+    self.label.precomputedWidth = 0;
+    [self invalidateIntrinsicContentSize];
+  }
+}
+
+- (CGFloat)contentWidth {
+  UIEdgeInsets safeContentMargin = self.safeContentMargin;
+  return CGRectGetWidth(self.containerView.bounds) - safeContentMargin.left -
+         safeContentMargin.right;
+}
+
++ (CGFloat)contentWidthForViewWidth:(CGFloat)viewWidth safeAreaInsets:(UIEdgeInsets)safeAreaInsets {
+  UIEdgeInsets contentMargin = [self contentMarginForSafeAreaInsets:safeAreaInsets];
+  return MAX(0, viewWidth - 2 * kBorderWidth - contentMargin.left - contentMargin.right);
+}
+
++ (MDCSnackbarMessageLayout *)layoutForMessage:(MDCSnackbarMessage *)message
+                                   messageFont:(UIFont *)messageFont
+                                    buttonFont:(UIFont *)buttonFont
+                          uppercaseButtonTitle:(BOOL)uppercaseButtonTitle
+                                   regularFont:(UIFont *)regularFont
+                                      boldFont:(UIFont *)boldFont
+                                  contentWidth:(CGFloat)contentWidth {
+  CGFloat buttonPadding =
+      MDCSnackbarMessage.usesLegacySnackbar ? kLegacyButtonPadding : kButtonPadding;
+  return [[MDCSnackbarMessageLayout alloc] initWithMessage:message
+                                               regularFont:regularFont
+                                                  boldFont:boldFont
+                                               messageFont:messageFont
+                                                buttonFont:buttonFont
+                                      uppercaseButtonTitle:uppercaseButtonTitle
+                                             buttonPadding:buttonPadding
+                                        titleButtonPadding:kTitleButtonPadding
+                                              contentWidth:contentWidth];
+}
+
 - (CGSize)intrinsicContentSize {
   CGFloat height = 0;
 
@@ -967,13 +1113,16 @@ static const MDCFontTextStyle kButtonTextStyle = MDCFontTextStyleButton;
 }
 
 - (UIEdgeInsets)safeContentMargin {
-  UIEdgeInsets contentMargin =
-      MDCSnackbarMessage.usesLegacySnackbar ? kLegacyContentMargin : kContentMargin;
-
   UIEdgeInsets safeAreaInsets = UIEdgeInsetsZero;
   if (@available(iOS 11.0, *)) {
     safeAreaInsets = self.window.safeAreaInsets;
   }
+  return [[self class] contentMarginForSafeAreaInsets:safeAreaInsets];
+}
+
++ (UIEdgeInsets)contentMarginForSafeAreaInsets:(UIEdgeInsets)safeAreaInsets {
+  UIEdgeInsets contentMargin =
+      MDCSnackbarMessage.usesLegacySnackbar ? kLegacyContentMargin : kContentMargin;
 
   // We only take the left and right safeAreaInsets in to account because the bottom is
   // handled by contentSafeBottomInset and we will never overlap the top inset.
@@ -1140,6 +1289,18 @@ static const MDCFontTextStyle kButtonTextStyle = MDCFontTextStyleButton;
 
 #pragma mark - Elevation
 
+- (void)didMoveToSuperview {
+  [super didMoveToSuperview];
+
+  [self mdc_elevationHierarchyDidChange];
+}
+
+- (void)didMoveToWindow {
+  [super didMoveToWindow];
+
+  [self mdc_elevationHierarchyDidChange];
+}
+
 - (CGFloat)mdc_currentElevation {
   return self.elevation;
 }
@@ -14,11 +14,19 @@
 
 #import "MDCSnackbarMessage.h"
 
+@class MDCSnackbarMessageLayout;
+
 /**
  Internal-only methods used by MDCSnackbarMessage and MDCSnackbarManager.
  */
 @interface MDCSnackbarMessage ()
 
+/**
+ The layout measured for this message by MDCSnackbarManager on a background queue, if it has
+ finished. Written from the layout queue and read from the main thread.
+ */
+@property(atomic, strong) MDCSnackbarMessageLayout *precomputedLayout;
+
 /**
  The class of the view which should be instantiated in order to show this message.
 
@@ -0,0 +1,104 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <UIKit/UIKit.h>
+
+@class MDCSnackbarMessage;
+
+/**
+ The measured sizes of a Snackbar message's text and action button.
+
+ Instances are immutable and may be created on any thread. Measurement uses TextKit directly rather
+ than UILabel, so MDCSnackbarManager can compute a layout on a background queue while the message
+ waits to be shown. MDCSnackbarMessageView then uses the precomputed sizes instead of re-measuring
+ its label during the slide-in animation, as long as the fonts and width it ends up with match the
+ ones the layout was computed for.
+ */
+@interface MDCSnackbarMessageLayout : NSObject
+
+/** The font used for text ranges without a font attribute. */
+@property(nonatomic, readonly, nonnull) UIFont *messageFont;
+
+/** The font used for the action button title. Nil if the message has no action. */
+@property(nonatomic, readonly, nullable) UIFont *buttonFont;
+
+/** The width available to the message text and action button together. */
+@property(nonatomic, readonly) CGFloat contentWidth;
+
+/** The width the message text was wrapped to. */
+@property(nonatomic, readonly) CGFloat messageWidth;
+
+/** The size of the wrapped message text, rounded up to whole points. */
+@property(nonatomic, readonly) CGSize messageSize;
+
+/** The size of the action button, or CGSizeZero if the message has no action. */
+@property(nonatomic, readonly) CGSize actionButtonSize;
+
+/**
+ Measures @c message for display in a Snackbar whose content is @c contentWidth points wide.
+
+ Every font is passed in, so that measuring never reads shared styling off the main thread.
+
+ @param message The message to measure.
+ @param regularFont The font of ranges not marked bold, see
+                    @c attributedTextForMessage:regularFont:boldFont:.
+ @param boldFont The font of ranges marked bold, see
+                 @c attributedTextForMessage:regularFont:boldFont:.
+ @param messageFont The font used for text ranges without a font attribute.
+ @param buttonFont The font used for the action button title.
+ @param uppercaseButtonTitle Whether the action button title is displayed in uppercase.
+ @param buttonPadding The padding on each side of the action button title.
+ @param titleButtonPadding The padding between the message text and the action button.
+ @param contentWidth The width available to the message text and action button together.
+ */
+- (nonnull instancetype)initWithMessage:(nonnull MDCSnackbarMessage *)message
+                            regularFont:(nullable UIFont *)regularFont
+                               boldFont:(nullable UIFont *)boldFont
+                            messageFont:(nonnull UIFont *)messageFont
+                             buttonFont:(nullable UIFont *)buttonFont
+                   uppercaseButtonTitle:(BOOL)uppercaseButtonTitle
+                          buttonPadding:(CGFloat)buttonPadding
+                     titleButtonPadding:(CGFloat)titleButtonPadding
+                           contentWidth:(CGFloat)contentWidth NS_DESIGNATED_INITIALIZER;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+/**
+ Returns YES if the layout was measured with the given fonts.
+ */
+- (BOOL)isValidForMessageFont:(nullable UIFont *)messageFont
+                    buttonFont:(nullable UIFont *)buttonFont;
+
+/**
+ Returns the attributed text displayed for @c message.
+
+ When @c applyBoldFonts is YES, ranges marked with @c MDCSnackbarMessageBoldAttributeName are given
+ the MDCTypography body 2 font and all other ranges the body 1 font. Must be called from the main
+ thread.
+ */
++ (nullable NSAttributedString *)attributedTextForMessage:(nonnull MDCSnackbarMessage *)message
+                                           applyBoldFonts:(BOOL)applyBoldFonts;
+
+/**
+ Returns the attributed text displayed for @c message.
+
+ When both fonts are non-nil, ranges marked with @c MDCSnackbarMessageBoldAttributeName are given
+ @c boldFont and all other ranges @c regularFont. Otherwise the message's own attributes are kept.
+ Safe to call from any thread.
+ */
++ (nullable NSAttributedString *)attributedTextForMessage:(nonnull MDCSnackbarMessage *)message
+                                              regularFont:(nullable UIFont *)regularFont
+                                                 boldFont:(nullable UIFont *)boldFont;
+
+@end
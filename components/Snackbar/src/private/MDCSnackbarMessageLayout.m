@@ -0,0 +1,134 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCSnackbarMessageLayout.h"
+
+#import "MDCSnackbarMessage.h"
+#import "MaterialMath.h"
+#import "MaterialTypography.h"
+
+/** Returns the size of @c attributedText wrapped to @c width, measured with TextKit. */
+static CGSize MDCSnackbarMeasureAttributedText(NSAttributedString *attributedText, CGFloat width) {
+  if (attributedText.length == 0) {
+    return CGSizeZero;
+  }
+
+  // TextKit objects are safe to use off the main thread as long as they are confined to it.
+  NSTextStorage *textStorage = [[NSTextStorage alloc] initWithAttributedString:attributedText];
+  NSLayoutManager *layoutManager = [[NSLayoutManager alloc] init];
+  NSTextContainer *textContainer =
+      [[NSTextContainer alloc] initWithSize:CGSizeMake(width, CGFLOAT_MAX)];
+  textContainer.lineFragmentPadding = 0;
+  [layoutManager addTextContainer:textContainer];
+  [textStorage addLayoutManager:layoutManager];
+
+  [layoutManager ensureLayoutForTextContainer:textContainer];
+  CGRect usedRect = [layoutManager usedRectForTextContainer:textContainer];
+  return CGSizeMake(MDCCeil(CGRectGetWidth(usedRect)), MDCCeil(CGRectGetHeight(usedRect)));
+}
+
+/** Returns @c attributedText with @c font applied to every range without a font attribute. */
+static NSAttributedString *MDCSnackbarAttributedTextWithBaseFont(NSAttributedString *attributedText,
+                                                                 UIFont *font) {
+  NSMutableAttributedString *result = [attributedText mutableCopy];
+  [attributedText enumerateAttribute:NSFontAttributeName
+                             inRange:NSMakeRange(0, attributedText.length)
+                             options:0
+                          usingBlock:^(id value, NSRange range, __unused BOOL *stop) {
+                            if (!value) {
+                              [result addAttribute:NSFontAttributeName value:font range:range];
+                            }
+                          }];
+  return result;
+}
+
+@implementation MDCSnackbarMessageLayout
+
+- (instancetype)initWithMessage:(MDCSnackbarMessage *)message
+                    regularFont:(UIFont *)regularFont
+                       boldFont:(UIFont *)boldFont
+                    messageFont:(UIFont *)messageFont
+                     buttonFont:(UIFont *)buttonFont
+           uppercaseButtonTitle:(BOOL)uppercaseButtonTitle
+                  buttonPadding:(CGFloat)buttonPadding
+             titleButtonPadding:(CGFloat)titleButtonPadding
+                   contentWidth:(CGFloat)contentWidth {
+  self = [super init];
+  if (self) {
+    _messageFont = messageFont;
+    _contentWidth = contentWidth;
+
+    _messageWidth = contentWidth;
+    NSString *actionTitle = message.action.title;
+    if (actionTitle && buttonFont) {
+      _buttonFont = buttonFont;
+      if (uppercaseButtonTitle) {
+        actionTitle = [actionTitle uppercaseStringWithLocale:[NSLocale currentLocale]];
+      }
+      CGSize titleSize = MDCSnackbarMeasureAttributedText(
+          [[NSAttributedString alloc] initWithString:actionTitle
+                                          attributes:@{NSFontAttributeName : buttonFont}],
+          CGFLOAT_MAX);
+      _actionButtonSize =
+          CGSizeMake(titleSize.width + 2 * buttonPadding, titleSize.height + 2 * buttonPadding);
+      _messageWidth = MAX(0, contentWidth - _actionButtonSize.width - titleButtonPadding);
+    }
+
+    NSAttributedString *attributedText =
+        [[self class] attributedTextForMessage:message regularFont:regularFont boldFont:boldFont];
+    _messageSize = MDCSnackbarMeasureAttributedText(
+        MDCSnackbarAttributedTextWithBaseFont(attributedText, messageFont), _messageWidth);
+  }
+  return self;
+}
+
+- (BOOL)isValidForMessageFont:(UIFont *)messageFont buttonFont:(UIFont *)buttonFont {
+  if (![self.messageFont isEqual:messageFont]) {
+    return NO;
+  }
+  return self.buttonFont == nil || [self.buttonFont isEqual:buttonFont];
+}
+
++ (NSAttributedString *)attributedTextForMessage:(MDCSnackbarMessage *)message
+                                  applyBoldFonts:(BOOL)applyBoldFonts {
+  if (!applyBoldFonts) {
+    return [self attributedTextForMessage:message regularFont:nil boldFont:nil];
+  }
+  return [self attributedTextForMessage:message
+                            regularFont:[MDCTypography body1Font]
+                               boldFont:[MDCTypography body2Font]];
+}
+
++ (NSAttributedString *)attributedTextForMessage:(MDCSnackbarMessage *)message
+                                     regularFont:(UIFont *)regularFont
+                                        boldFont:(UIFont *)boldFont {
+  NSMutableAttributedString *messageString = [message.attributedText mutableCopy];
+  if (!regularFont || !boldFont) {
+    return messageString;
+  }
+
+  // Find any of the bold attributes in the string, and set the proper font for those ranges.
+  // Use NSAttributedStringEnumerationLongestEffectiveRangeNotRequired as opposed to 0,
+  // otherwise it will only work if bold text is in the end.
+  [messageString enumerateAttribute:MDCSnackbarMessageBoldAttributeName
+                            inRange:NSMakeRange(0, messageString.length)
+                            options:NSAttributedStringEnumerationLongestEffectiveRangeNotRequired
+                         usingBlock:^(id value, NSRange range, __unused BOOL *stop) {
+                           UIFont *font = [value boolValue] ? boldFont : regularFont;
+                           [messageString setAttributes:@{NSFontAttributeName : font} range:range];
+                         }];
+  return messageString;
+}
+
+@end
@@ -0,0 +1,93 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <Foundation/Foundation.h>
+
+#import "MDCSnackbarManager.h"
+#import "MDCSnackbarMessage.h"
+
+/**
+ The queue of messages waiting to be displayed by MDCSnackbarManager.
+
+ Messages are kept in lanes indexed by priority and category. Dequeuing only looks at the head of
+ each non-empty lane, so its cost depends on the number of distinct categories with pending messages
+ rather than on the number of pending messages. Suspending or resuming a category is a single set
+ operation.
+
+ This class is not thread-safe; MDCSnackbarManager only uses it from the main thread.
+ */
+@interface MDCSnackbarMessageQueue : NSObject
+
+/**
+ The number of messages in the queue, including messages of suspended categories.
+ */
+@property(nonatomic, readonly) NSUInteger count;
+
+/**
+ The maximum number of messages in the queue. 0 means the queue is unbounded.
+ */
+@property(nonatomic, assign) NSUInteger maximumCount;
+
+/**
+ The policy applied when a message is enqueued while the queue holds @c maximumCount messages.
+ */
+@property(nonatomic, assign) MDCSnackbarPendingMessageDropPolicy dropPolicy;
+
+/**
+ Whether @c enqueueMessage: discards messages that duplicate a message already in the queue.
+ */
+@property(nonatomic, assign) BOOL coalescesDuplicates;
+
+/**
+ Adds @c message to the end of its priority and category lane.
+
+ @return The messages discarded by coalescing or by the drop policy, which may include @c message
+         itself. The caller is responsible for calling their completion handlers.
+ */
+- (nonnull NSArray<MDCSnackbarMessage *> *)enqueueMessage:(nonnull MDCSnackbarMessage *)message;
+
+/**
+ Returns YES if the queue holds a message that @c message duplicates.
+ */
+- (BOOL)containsDuplicateOfMessage:(nonnull MDCSnackbarMessage *)message;
+
+/**
+ Removes and returns the oldest message of the highest priority whose category is not suspended.
+ */
+- (nullable MDCSnackbarMessage *)dequeueNextShowableMessage;
+
+/**
+ Removes all messages of @c category, or every message if @c category is nil.
+
+ @return The removed messages, in the order they were enqueued.
+ */
+- (nonnull NSArray<MDCSnackbarMessage *> *)removeMessagesWithCategory:(nullable NSString *)category;
+
+/**
+ Prevents messages of @c category from being dequeued until @c resumeCategory: is called.
+ */
+- (void)suspendCategory:(nonnull NSString *)category;
+
+/**
+ Allows messages of @c category to be dequeued again.
+ */
+- (void)resumeCategory:(nonnull NSString *)category;
+
+/**
+ Returns YES if @c message and @c otherMessage would be coalesced into a single message.
+ */
++ (BOOL)isMessage:(nonnull MDCSnackbarMessage *)message
+    duplicateOfMessage:(nullable MDCSnackbarMessage *)otherMessage;
+
+@end
@@ -0,0 +1,306 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCSnackbarMessageQueue.h"
+
+enum {
+  /** The number of values in MDCSnackbarMessagePriority. */
+  kPriorityCount = MDCSnackbarMessagePriorityHigh + 1,
+};
+
+static MDCSnackbarMessagePriority ClampedPriority(MDCSnackbarMessagePriority priority) {
+  return MAX(MDCSnackbarMessagePriorityLow, MIN(MDCSnackbarMessagePriorityHigh, priority));
+}
+
+/** Returns the key of the lane holding messages of @c category. */
+static id<NSCopying> LaneKeyForCategory(NSString *category) {
+  return category ?: (id<NSCopying>)[NSNull null];
+}
+
+/**
+ The subset of a message's properties that identifies duplicates.
+
+ NSArray's hash is its count, so a dedicated key class is used to keep coalescing lookups constant
+ time.
+ */
+@interface MDCSnackbarMessageCoalescingKey : NSObject <NSCopying>
+@property(nonatomic, readonly) NSAttributedString *attributedText;
+@property(nonatomic, readonly) NSString *category;
+@property(nonatomic, readonly) NSString *actionTitle;
+@property(nonatomic, readonly) MDCSnackbarMessagePriority priority;
+- (instancetype)initWithMessage:(MDCSnackbarMessage *)message;
+@end
+
+@implementation MDCSnackbarMessageCoalescingKey {
+  NSUInteger _hash;
+}
+
+- (instancetype)initWithMessage:(MDCSnackbarMessage *)message {
+  self = [super init];
+  if (self) {
+    _attributedText = [message.attributedText copy];
+    _category = [message.category copy];
+    _actionTitle = [message.action.title copy];
+    _priority = ClampedPriority(message.priority);
+    _hash = _attributedText.string.hash ^ (_category.hash << 1) ^ (_actionTitle.hash << 2) ^
+            (NSUInteger)_priority;
+  }
+  return self;
+}
+
+- (NSUInteger)hash {
+  return _hash;
+}
+
+- (BOOL)isEqual:(id)object {
+  if (self == object) {
+    return YES;
+  }
+  if (![object isKindOfClass:[MDCSnackbarMessageCoalescingKey class]]) {
+    return NO;
+  }
+  MDCSnackbarMessageCoalescingKey *other = (MDCSnackbarMessageCoalescingKey *)object;
+  if (_hash != other->_hash || _priority != other.priority) {
+    return NO;
+  }
+  return (self.attributedText == other.attributedText ||
+          [self.attributedText isEqualToAttributedString:other.attributedText]) &&
+         (self.category == other.category || [self.category isEqualToString:other.category]) &&
+         (self.actionTitle == other.actionTitle ||
+          [self.actionTitle isEqualToString:other.actionTitle]);
+}
+
+- (id)copyWithZone:(__unused NSZone *)zone {
+  // Immutable.
+  return self;
+}
+
+@end
+
+/** A message along with the bookkeeping the queue needs for it. */
+@interface MDCSnackbarMessageQueueEntry : NSObject
+@property(nonatomic, strong) MDCSnackbarMessage *message;
+@property(nonatomic, assign) uint64_t sequenceNumber;
+@property(nonatomic, strong) MDCSnackbarMessageCoalescingKey *coalescingKey;
+@end
+
+@implementation MDCSnackbarMessageQueueEntry
+@end
+
+@implementation MDCSnackbarMessageQueue {
+  /**
+   One dictionary per priority, mapping a lane key to the FIFO of entries in that lane. Empty lanes
+   are removed so that iterating a dictionary only visits lanes with pending messages.
+   */
+  NSMutableDictionary<id, NSMutableArray<MDCSnackbarMessageQueueEntry *> *> *_lanes[kPriorityCount];
+
+  /** Categories that may not be dequeued. */
+  NSMutableSet<NSString *> *_suspendedCategories;
+
+  /** Coalescing keys of the messages in the queue. */
+  NSCountedSet<MDCSnackbarMessageCoalescingKey *> *_coalescingKeys;
+
+  /** Monotonically increasing counter used to preserve enqueue order across lanes. */
+  uint64_t _nextSequenceNumber;
+}
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    for (NSInteger priority = 0; priority < kPriorityCount; ++priority) {
+      _lanes[priority] = [NSMutableDictionary dictionary];
+    }
+    _suspendedCategories = [NSMutableSet set];
+    _coalescingKeys = [NSCountedSet set];
+    _dropPolicy = MDCSnackbarPendingMessageDropPolicyDropOldest;
+  }
+  return self;
+}
+
+#pragma mark - Enqueueing
+
+- (NSArray<MDCSnackbarMessage *> *)enqueueMessage:(MDCSnackbarMessage *)message {
+  MDCSnackbarMessageCoalescingKey *coalescingKey =
+      [[MDCSnackbarMessageCoalescingKey alloc] initWithMessage:message];
+  if (self.coalescesDuplicates && [_coalescingKeys countForObject:coalescingKey] > 0) {
+    return @[ message ];
+  }
+
+  NSMutableArray<MDCSnackbarMessage *> *droppedMessages = [NSMutableArray array];
+  MDCSnackbarMessagePriority priority = ClampedPriority(message.priority);
+  if (self.maximumCount > 0 && _count >= self.maximumCount) {
+    MDCSnackbarMessage *evictedMessage = nil;
+    if (self.dropPolicy == MDCSnackbarPendingMessageDropPolicyDropOldest) {
+      evictedMessage = [self removeOldestEntryWithPriorityAtMost:priority].message;
+    }
+    if (!evictedMessage) {
+      return @[ message ];
+    }
+    [droppedMessages addObject:evictedMessage];
+  }
+
+  MDCSnackbarMessageQueueEntry *entry = [[MDCSnackbarMessageQueueEntry alloc] init];
+  entry.message = message;
+  entry.sequenceNumber = _nextSequenceNumber++;
+  entry.coalescingKey = coalescingKey;
+
+  id laneKey = LaneKeyForCategory(message.category);
+  NSMutableArray<MDCSnackbarMessageQueueEntry *> *lane = _lanes[priority][laneKey];
+  if (!lane) {
+    lane = [NSMutableArray array];
+    _lanes[priority][laneKey] = lane;
+  }
+  [lane addObject:entry];
+  [_coalescingKeys addObject:coalescingKey];
+  ++_count;
+
+  return droppedMessages;
+}
+
+- (BOOL)containsDuplicateOfMessage:(MDCSnackbarMessage *)message {
+  MDCSnackbarMessageCoalescingKey *coalescingKey =
+      [[MDCSnackbarMessageCoalescingKey alloc] initWithMessage:message];
+  return [_coalescingKeys countForObject:coalescingKey] > 0;
+}
+
+#pragma mark - Dequeueing
+
+- (MDCSnackbarMessage *)dequeueNextShowableMessage {
+  if (_count == 0) {
+    return nil;
+  }
+
+  for (NSInteger priority = kPriorityCount - 1; priority >= 0; --priority) {
+    id laneKey = [self laneKeyOfOldestHeadWithPriority:priority includingSuspended:NO];
+    if (laneKey) {
+      return [self removeHeadOfLane:laneKey priority:priority].message;
+    }
+  }
+  return nil;
+}
+
+- (NSArray<MDCSnackbarMessage *> *)removeMessagesWithCategory:(NSString *)category {
+  NSMutableArray<MDCSnackbarMessageQueueEntry *> *removedEntries = [NSMutableArray array];
+  for (NSInteger priority = 0; priority < kPriorityCount; ++priority) {
+    if (category) {
+      NSArray<MDCSnackbarMessageQueueEntry *> *lane = _lanes[priority][category];
+      if (lane) {
+        [removedEntries addObjectsFromArray:lane];
+        [_lanes[priority] removeObjectForKey:category];
+      }
+    } else {
+      for (NSArray<MDCSnackbarMessageQueueEntry *> *lane in _lanes[priority].allValues) {
+        [removedEntries addObjectsFromArray:lane];
+      }
+      [_lanes[priority] removeAllObjects];
+    }
+  }
+
+  if (removedEntries.count == 0) {
+    return @[];
+  }
+
+  [removedEntries sortUsingComparator:^NSComparisonResult(MDCSnackbarMessageQueueEntry *entry1,
+                                                          MDCSnackbarMessageQueueEntry *entry2) {
+    if (entry1.sequenceNumber == entry2.sequenceNumber) {
+      return NSOrderedSame;
+    }
+    return entry1.sequenceNumber < entry2.sequenceNumber ? NSOrderedAscending : NSOrderedDescending;
+  }];
+
+  NSMutableArray<MDCSnackbarMessage *> *removedMessages =
+      [NSMutableArray arrayWithCapacity:removedEntries.count];
+  for (MDCSnackbarMessageQueueEntry *entry in removedEntries) {
+    [_coalescingKeys removeObject:entry.coalescingKey];
+    [removedMessages addObject:entry.message];
+  }
+  _count -= removedEntries.count;
+  return removedMessages;
+}
+
+#pragma mark - Suspension
+
+- (void)suspendCategory:(NSString *)category {
+  [_suspendedCategories addObject:category];
+}
+
+- (void)resumeCategory:(NSString *)category {
+  [_suspendedCategories removeObject:category];
+}
+
+#pragma mark - Coalescing
+
++ (BOOL)isMessage:(MDCSnackbarMessage *)message
+    duplicateOfMessage:(MDCSnackbarMessage *)otherMessage {
+  if (!otherMessage) {
+    return NO;
+  }
+  return [[[MDCSnackbarMessageCoalescingKey alloc] initWithMessage:message]
+      isEqual:[[MDCSnackbarMessageCoalescingKey alloc] initWithMessage:otherMessage]];
+}
+
+#pragma mark - Private
+
+/**
+ Returns the key of the lane whose head was enqueued first among the lanes of @c priority, or nil if
+ there is no eligible lane.
+ */
+- (id)laneKeyOfOldestHeadWithPriority:(NSInteger)priority
+                   includingSuspended:(BOOL)includeSuspended {
+  __block id oldestLaneKey = nil;
+  __block uint64_t oldestSequenceNumber = UINT64_MAX;
+  NSSet<NSString *> *suspendedCategories = _suspendedCategories;
+  [_lanes[priority] enumerateKeysAndObjectsUsingBlock:^(
+                        id laneKey, NSMutableArray<MDCSnackbarMessageQueueEntry *> *lane,
+                        __unused BOOL *stop) {
+    if (!includeSuspended && suspendedCategories.count > 0 &&
+        [suspendedCategories containsObject:laneKey]) {
+      return;
+    }
+    uint64_t sequenceNumber = lane.firstObject.sequenceNumber;
+    if (sequenceNumber < oldestSequenceNumber) {
+      oldestSequenceNumber = sequenceNumber;
+      oldestLaneKey = laneKey;
+    }
+  }];
+  return oldestLaneKey;
+}
+
+- (MDCSnackbarMessageQueueEntry *)removeHeadOfLane:(id)laneKey priority:(NSInteger)priority {
+  NSMutableArray<MDCSnackbarMessageQueueEntry *> *lane = _lanes[priority][laneKey];
+  MDCSnackbarMessageQueueEntry *entry = lane.firstObject;
+  [lane removeObjectAtIndex:0];
+  if (lane.count == 0) {
+    [_lanes[priority] removeObjectForKey:laneKey];
+  }
+  [_coalescingKeys removeObject:entry.coalescingKey];
+  --_count;
+  return entry;
+}
+
+/**
+ Removes the oldest entry of the lowest non-empty priority that is not higher than @c priority.
+ Suspended lanes are eligible, since their messages are waiting just like any other.
+ */
+- (MDCSnackbarMessageQueueEntry *)removeOldestEntryWithPriorityAtMost:(NSInteger)priority {
+  for (NSInteger lowerPriority = 0; lowerPriority <= priority; ++lowerPriority) {
+    id laneKey = [self laneKeyOfOldestHeadWithPriority:lowerPriority includingSuspended:YES];
+    if (laneKey) {
+      return [self removeHeadOfLane:laneKey priority:lowerPriority];
+    }
+  }
+  return nil;
+}
+
+@end
@@ -17,6 +17,7 @@
 @class MDCSnackbarManager;
 @class MDCSnackbarMessage;
 @class MDCSnackbarMessageAction;
+@class MDCSnackbarMessageLayout;
 
 /**
  Called by the Snackbar message view when the user interacts with the Snackbar view.
@@ -54,6 +55,51 @@ typedef void (^MDCSnackbarMessageDismissHandler)(BOOL userInitiated,
  */
 @property(nonatomic) BOOL anchoredToScreenBottom;
 
+/**
+ The width available to the message text and buttons, as of the last layout pass.
+ */
+@property(nonatomic, readonly) CGFloat contentWidth;
+
+/**
+ Resolves the message font the same way the view does, without a trait environment.
+
+ Returns nil if the font can't be resolved without a trait environment.
+ */
++ (UIFont *_Nullable)messageFontForFont:(UIFont *_Nullable)messageFont
+      adjustsFontForContentSizeCategory:(BOOL)adjustsFontForContentSizeCategory
+     adjustsWhenScaledFontIsUnavailable:(BOOL)adjustsWhenScaledFontIsUnavailable
+                       traitEnvironment:(id<UITraitEnvironment> _Nullable)traitEnvironment;
+
+/**
+ Resolves the action button font the same way the view does, without a trait environment.
+
+ Returns nil if the font can't be resolved without a trait environment.
+ */
++ (UIFont *_Nullable)buttonFontForFont:(UIFont *_Nullable)buttonFont
+     adjustsFontForContentSizeCategory:(BOOL)adjustsFontForContentSizeCategory
+    adjustsWhenScaledFontIsUnavailable:(BOOL)adjustsWhenScaledFontIsUnavailable
+                      traitEnvironment:(id<UITraitEnvironment> _Nullable)traitEnvironment;
+
+/**
+ Returns the @c contentWidth of a Snackbar view that is @c viewWidth points wide, in a window with
+ @c safeAreaInsets.
+ */
++ (CGFloat)contentWidthForViewWidth:(CGFloat)viewWidth safeAreaInsets:(UIEdgeInsets)safeAreaInsets;
+
+/**
+ Measures @c message using this view's paddings, for a Snackbar whose @c contentWidth is
+ @c contentWidth. Safe to call from any thread, since every font is passed in.
+
+ Pass the fonts of bold and regular ranges when the view would apply them, or nil otherwise.
+ */
++ (MDCSnackbarMessageLayout *_Nonnull)layoutForMessage:(MDCSnackbarMessage *_Nonnull)message
+                                           messageFont:(UIFont *_Nonnull)messageFont
+                                            buttonFont:(UIFont *_Nullable)buttonFont
+                                  uppercaseButtonTitle:(BOOL)uppercaseButtonTitle
+                                           regularFont:(UIFont *_Nullable)regularFont
+                                              boldFont:(UIFont *_Nullable)boldFont
+                                          contentWidth:(CGFloat)contentWidth;
+
 /**
  Creates a Snackbar view to display @c message.
 
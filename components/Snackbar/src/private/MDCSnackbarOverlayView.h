@@ -71,4 +71,12 @@ OBJC_EXTERN NSTimeInterval const MDCSnackbarLegacyTransitionDuration;
 */
 @property(nonatomic) MDCSnackbarAlignment alignment;
 
+/**
+ The width a Snackbar view would be given if it were shown now, or 0 if Snackbar views are sized to
+ fit their message, which is the case in regular width and height environments.
+
+ @note This method must be called from the main thread.
+ */
+- (CGFloat)expectedSnackbarViewWidth;
+
 @end
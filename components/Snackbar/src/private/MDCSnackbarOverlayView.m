@@ -137,18 +137,8 @@ static const CGFloat kMaximumHeight = 80;
     NSNotificationCenter *nc = [NSNotificationCenter defaultCenter];
 
     [nc addObserver:self
-           selector:@selector(keyboardWillShow:)
-               name:MDCKeyboardWatcherKeyboardWillShowNotification
-             object:watcher];
-
-    [nc addObserver:self
-           selector:@selector(keyboardWillBeHidden:)
-               name:MDCKeyboardWatcherKeyboardWillHideNotification
-             object:watcher];
-
-    [nc addObserver:self
-           selector:@selector(keyboardWillChangeFrame:)
-               name:MDCKeyboardWatcherKeyboardWillChangeFrameNotification
+           selector:@selector(keyboardWillUpdate:)
+               name:MDCKeyboardWatcherKeyboardWillUpdateNotification
              object:watcher];
 
     [nc addObserver:self
@@ -252,6 +242,24 @@ static const CGFloat kMaximumHeight = 80;
              : MDCSnackbarSideMargin_CompactWidth;
 }
 
+- (CGFloat)expectedSnackbarViewWidth {
+  UITraitCollection *traitCollection = self.traitCollection;
+  if (traitCollection.horizontalSizeClass == UIUserInterfaceSizeClassRegular &&
+      traitCollection.verticalSizeClass == UIUserInterfaceSizeClassRegular) {
+    return 0;
+  }
+  // Size classes are unspecified until the overlay is in a window, and iPads are usually regular.
+  if (!self.window && UI_USER_INTERFACE_IDIOM() == UIUserInterfaceIdiomPad) {
+    return 0;
+  }
+
+  CGFloat width = CGRectGetWidth(self.bounds) - 2 * [self sideMargin];
+  if (@available(iOS 11.0, *)) {
+    width -= self.mdc_safeAreaInsets.left + self.mdc_safeAreaInsets.right;
+  }
+  return MAX(0, width);
+}
+
 - (void)setSnackbarView:(MDCSnackbarMessageView *)snackbarView {
   if (_snackbarView != snackbarView) {
     [_snackbarView removeFromSuperview];
@@ -618,15 +626,7 @@ static const CGFloat kMaximumHeight = 80;
   }
 }
 
-- (void)keyboardWillShow:(NSNotification *)notification {
-  [self updatesnackbarPositionWithKeyboardUserInfo:[notification userInfo]];
-}
-
-- (void)keyboardWillBeHidden:(NSNotification *)notification {
-  [self updatesnackbarPositionWithKeyboardUserInfo:[notification userInfo]];
-}
-
-- (void)keyboardWillChangeFrame:(NSNotification *)notification {
+- (void)keyboardWillUpdate:(NSNotification *)notification {
   [self updatesnackbarPositionWithKeyboardUserInfo:[notification userInfo]];
 }
 
@@ -0,0 +1,158 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialSnackbar.h"
+
+#import "../../src/private/MDCSnackbarMessageInternal.h"
+#import "../../src/private/MDCSnackbarMessageLayout.h"
+#import "../../src/private/MDCSnackbarMessageViewInternal.h"
+
+@interface MDCSnackbarMessageView (LayoutTesting)
+@property(nonatomic, strong) UILabel *label;
+@end
+
+@interface MDCSnackbarMessageLayoutTests : XCTestCase
+@property(nonatomic, strong) UIFont *messageFont;
+@property(nonatomic, strong) UIFont *buttonFont;
+@end
+
+@implementation MDCSnackbarMessageLayoutTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.messageFont = [UIFont systemFontOfSize:14];
+  self.buttonFont = [UIFont boldSystemFontOfSize:14];
+}
+
+- (void)tearDown {
+  self.messageFont = nil;
+  self.buttonFont = nil;
+
+  [super tearDown];
+}
+
+- (MDCSnackbarMessageLayout *)layoutForMessage:(MDCSnackbarMessage *)message
+                                  contentWidth:(CGFloat)contentWidth {
+  return [MDCSnackbarMessageView layoutForMessage:message
+                                      messageFont:self.messageFont
+                                       buttonFont:self.buttonFont
+                             uppercaseButtonTitle:YES
+                                      regularFont:nil
+                                         boldFont:nil
+                                     contentWidth:contentWidth];
+}
+
+- (void)testLongMessageWrapsToMultipleLines {
+  // Given
+  MDCSnackbarMessage *shortMessage = [MDCSnackbarMessage messageWithText:@"Short"];
+  MDCSnackbarMessage *longMessage = [MDCSnackbarMessage
+      messageWithText:@"A much longer message that cannot possibly fit on a single line of a "
+                      @"Snackbar and therefore has to wrap onto several lines of text."];
+
+  // When
+  MDCSnackbarMessageLayout *shortLayout = [self layoutForMessage:shortMessage contentWidth:200];
+  MDCSnackbarMessageLayout *longLayout = [self layoutForMessage:longMessage contentWidth:200];
+
+  // Then
+  XCTAssertGreaterThan(shortLayout.messageSize.height, 0);
+  XCTAssertGreaterThan(longLayout.messageSize.height, 2 * shortLayout.messageSize.height);
+  XCTAssertLessThanOrEqual(longLayout.messageSize.width, 200);
+}
+
+- (void)testActionButtonReducesMessageWidth {
+  // Given
+  MDCSnackbarMessage *message = [MDCSnackbarMessage messageWithText:@"Message"];
+  message.action = [[MDCSnackbarMessageAction alloc] init];
+  message.action.title = @"Undo";
+
+  // When
+  MDCSnackbarMessageLayout *layout = [self layoutForMessage:message contentWidth:300];
+
+  // Then
+  XCTAssertGreaterThan(layout.actionButtonSize.width, 0);
+  XCTAssertLessThan(layout.messageWidth, 300 - layout.actionButtonSize.width);
+  XCTAssertEqualObjects(layout.buttonFont, self.buttonFont);
+}
+
+- (void)testLayoutIsOnlyValidForMeasuredFonts {
+  // Given
+  MDCSnackbarMessage *message = [MDCSnackbarMessage messageWithText:@"Message"];
+
+  // When
+  MDCSnackbarMessageLayout *layout = [self layoutForMessage:message contentWidth:300];
+
+  // Then
+  XCTAssertTrue([layout isValidForMessageFont:self.messageFont buttonFont:nil]);
+  XCTAssertFalse([layout isValidForMessageFont:[UIFont systemFontOfSize:30] buttonFont:nil]);
+}
+
+- (void)testLayoutCanBeComputedOffTheMainThread {
+  // Given
+  MDCSnackbarMessage *message = [MDCSnackbarMessage messageWithText:@"Message"];
+  MDCSnackbarMessageLayout *mainThreadLayout = [self layoutForMessage:message contentWidth:300];
+  XCTestExpectation *expectation = [self expectationWithDescription:@"measured"];
+  __block MDCSnackbarMessageLayout *backgroundLayout;
+
+  // When
+  dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+    backgroundLayout = [self layoutForMessage:message contentWidth:300];
+    [expectation fulfill];
+  });
+  [self waitForExpectations:@[ expectation ] timeout:3];
+
+  // Then
+  XCTAssertTrue(CGSizeEqualToSize(backgroundLayout.messageSize, mainThreadLayout.messageSize));
+}
+
+- (void)testMessageViewUsesPrecomputedSizeWhenFontsMatch {
+  // Given
+  MDCSnackbarManager *manager = [[MDCSnackbarManager alloc] init];
+  manager.messageFont = self.messageFont;
+  MDCSnackbarMessage *message = [MDCSnackbarMessage messageWithText:@"Message"];
+  message.precomputedLayout = [self layoutForMessage:message contentWidth:300];
+
+  // When
+  MDCSnackbarMessageView *view = [[MDCSnackbarMessageView alloc] initWithMessage:message
+                                                                  dismissHandler:nil
+                                                                 snackbarManager:manager];
+
+  // Then
+  XCTAssertTrue(CGSizeEqualToSize(view.label.intrinsicContentSize,
+                                  message.precomputedLayout.messageSize));
+}
+
+- (void)testMessageLabelMeasuresItselfAtADifferentWidth {
+  // Given
+  MDCSnackbarManager *manager = [[MDCSnackbarManager alloc] init];
+  manager.messageFont = self.messageFont;
+  MDCSnackbarMessage *message = [MDCSnackbarMessage
+      messageWithText:@"A much longer message that cannot possibly fit on a single line of a "
+                      @"Snackbar and therefore has to wrap onto several lines of text."];
+  message.precomputedLayout = [self layoutForMessage:message contentWidth:300];
+  MDCSnackbarMessageView *view = [[MDCSnackbarMessageView alloc] initWithMessage:message
+                                                                  dismissHandler:nil
+                                                                 snackbarManager:manager];
+
+  // When
+  view.label.preferredMaxLayoutWidth = message.precomputedLayout.messageWidth / 2;
+
+  // Then
+  XCTAssertGreaterThan(view.label.intrinsicContentSize.height,
+                       message.precomputedLayout.messageSize.height);
+}
+
+@end
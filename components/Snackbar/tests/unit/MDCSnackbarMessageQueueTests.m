@@ -0,0 +1,225 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "../../src/private/MDCSnackbarMessageQueue.h"
+#import "MaterialSnackbar.h"
+
+static const NSUInteger kStressMessageCount = 10000;
+
+static MDCSnackbarMessage *MessageWith(NSString *text, NSString *category,
+                                       MDCSnackbarMessagePriority priority) {
+  MDCSnackbarMessage *message = [MDCSnackbarMessage messageWithText:text];
+  message.category = category;
+  message.priority = priority;
+  return message;
+}
+
+@interface MDCSnackbarMessageQueueTests : XCTestCase
+@property(nonatomic, strong) MDCSnackbarMessageQueue *queue;
+@end
+
+@implementation MDCSnackbarMessageQueueTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.queue = [[MDCSnackbarMessageQueue alloc] init];
+}
+
+- (void)tearDown {
+  self.queue = nil;
+
+  [super tearDown];
+}
+
+- (void)testDequeueIsFIFOWithinAPriority {
+  // Given
+  [self.queue enqueueMessage:MessageWith(@"1", nil, MDCSnackbarMessagePriorityNormal)];
+  [self.queue enqueueMessage:MessageWith(@"2", @"a", MDCSnackbarMessagePriorityNormal)];
+  [self.queue enqueueMessage:MessageWith(@"3", nil, MDCSnackbarMessagePriorityNormal)];
+
+  // Then
+  XCTAssertEqualObjects([self.queue dequeueNextShowableMessage].text, @"1");
+  XCTAssertEqualObjects([self.queue dequeueNextShowableMessage].text, @"2");
+  XCTAssertEqualObjects([self.queue dequeueNextShowableMessage].text, @"3");
+  XCTAssertNil([self.queue dequeueNextShowableMessage]);
+  XCTAssertEqual(self.queue.count, 0U);
+}
+
+- (void)testHigherPriorityIsDequeuedFirst {
+  // Given
+  [self.queue enqueueMessage:MessageWith(@"low", nil, MDCSnackbarMessagePriorityLow)];
+  [self.queue enqueueMessage:MessageWith(@"normal", nil, MDCSnackbarMessagePriorityNormal)];
+  [self.queue enqueueMessage:MessageWith(@"high", nil, MDCSnackbarMessagePriorityHigh)];
+
+  // Then
+  XCTAssertEqualObjects([self.queue dequeueNextShowableMessage].text, @"high");
+  XCTAssertEqualObjects([self.queue dequeueNextShowableMessage].text, @"normal");
+  XCTAssertEqualObjects([self.queue dequeueNextShowableMessage].text, @"low");
+}
+
+- (void)testSuspendedCategoryIsSkippedUntilResumed {
+  // Given
+  [self.queue enqueueMessage:MessageWith(@"1", @"a", MDCSnackbarMessagePriorityHigh)];
+  [self.queue enqueueMessage:MessageWith(@"2", @"b", MDCSnackbarMessagePriorityNormal)];
+
+  // When
+  [self.queue suspendCategory:@"a"];
+
+  // Then
+  XCTAssertEqualObjects([self.queue dequeueNextShowableMessage].text, @"2");
+  XCTAssertNil([self.queue dequeueNextShowableMessage]);
+  XCTAssertEqual(self.queue.count, 1U);
+
+  // When
+  [self.queue resumeCategory:@"a"];
+
+  // Then
+  XCTAssertEqualObjects([self.queue dequeueNextShowableMessage].text, @"1");
+}
+
+- (void)testRemoveMessagesWithCategoryReturnsMessagesInEnqueueOrder {
+  // Given
+  [self.queue enqueueMessage:MessageWith(@"1", @"a", MDCSnackbarMessagePriorityLow)];
+  [self.queue enqueueMessage:MessageWith(@"2", @"b", MDCSnackbarMessagePriorityNormal)];
+  [self.queue enqueueMessage:MessageWith(@"3", @"a", MDCSnackbarMessagePriorityHigh)];
+
+  // When
+  NSArray<MDCSnackbarMessage *> *removed = [self.queue removeMessagesWithCategory:@"a"];
+
+  // Then
+  XCTAssertEqualObjects([removed valueForKey:@"text"], (@[ @"1", @"3" ]));
+  XCTAssertEqual(self.queue.count, 1U);
+
+  // When
+  removed = [self.queue removeMessagesWithCategory:nil];
+
+  // Then
+  XCTAssertEqualObjects([removed valueForKey:@"text"], (@[ @"2" ]));
+  XCTAssertEqual(self.queue.count, 0U);
+}
+
+- (void)testDuplicatesAreCoalesced {
+  // Given
+  self.queue.coalescesDuplicates = YES;
+  MDCSnackbarMessage *duplicate = MessageWith(@"offline", nil, MDCSnackbarMessagePriorityNormal);
+  [self.queue enqueueMessage:MessageWith(@"offline", nil, MDCSnackbarMessagePriorityNormal)];
+
+  // When
+  NSArray<MDCSnackbarMessage *> *dropped = [self.queue enqueueMessage:duplicate];
+
+  // Then
+  XCTAssertEqual(dropped.count, 1U);
+  XCTAssertEqual(dropped.firstObject, duplicate);
+  XCTAssertEqual(self.queue.count, 1U);
+
+  // When
+  [self.queue dequeueNextShowableMessage];
+
+  // Then
+  XCTAssertEqual([self.queue enqueueMessage:duplicate].count, 0U);
+}
+
+- (void)testContainsDuplicateOfMessage {
+  // Given
+  [self.queue enqueueMessage:MessageWith(@"offline", @"network", MDCSnackbarMessagePriorityNormal)];
+
+  // Then
+  XCTAssertTrue([self.queue
+      containsDuplicateOfMessage:MessageWith(@"offline", @"network",
+                                             MDCSnackbarMessagePriorityNormal)]);
+  XCTAssertFalse([self.queue
+      containsDuplicateOfMessage:MessageWith(@"offline", nil, MDCSnackbarMessagePriorityNormal)]);
+}
+
+- (void)testDropOldestEvictsOldestLowestPriorityMessage {
+  // Given
+  self.queue.maximumCount = 2;
+  self.queue.dropPolicy = MDCSnackbarPendingMessageDropPolicyDropOldest;
+  [self.queue enqueueMessage:MessageWith(@"normal", nil, MDCSnackbarMessagePriorityNormal)];
+  [self.queue enqueueMessage:MessageWith(@"low", nil, MDCSnackbarMessagePriorityLow)];
+
+  // When
+  NSArray<MDCSnackbarMessage *> *dropped =
+      [self.queue enqueueMessage:MessageWith(@"high", nil, MDCSnackbarMessagePriorityHigh)];
+
+  // Then
+  XCTAssertEqualObjects([dropped valueForKey:@"text"], (@[ @"low" ]));
+  XCTAssertEqual(self.queue.count, 2U);
+
+  // When
+  dropped = [self.queue enqueueMessage:MessageWith(@"low2", nil, MDCSnackbarMessagePriorityLow)];
+
+  // Then
+  XCTAssertEqualObjects([dropped valueForKey:@"text"], (@[ @"low2" ]));
+  XCTAssertEqual(self.queue.count, 2U);
+}
+
+- (void)testDropNewestRejectsIncomingMessage {
+  // Given
+  self.queue.maximumCount = 1;
+  self.queue.dropPolicy = MDCSnackbarPendingMessageDropPolicyDropNewest;
+  [self.queue enqueueMessage:MessageWith(@"1", nil, MDCSnackbarMessagePriorityNormal)];
+
+  // When
+  NSArray<MDCSnackbarMessage *> *dropped =
+      [self.queue enqueueMessage:MessageWith(@"2", nil, MDCSnackbarMessagePriorityHigh)];
+
+  // Then
+  XCTAssertEqualObjects([dropped valueForKey:@"text"], (@[ @"2" ]));
+  XCTAssertEqualObjects([self.queue dequeueNextShowableMessage].text, @"1");
+}
+
+- (void)testStressEnqueueAndDequeueTenThousandMessages {
+  // Given
+  NSMutableArray<MDCSnackbarMessage *> *messages =
+      [NSMutableArray arrayWithCapacity:kStressMessageCount];
+  for (NSUInteger i = 0; i < kStressMessageCount; ++i) {
+    NSString *text = [NSString stringWithFormat:@"%lu", (unsigned long)i];
+    NSString *category =
+        (i % 4 == 0) ? nil : [NSString stringWithFormat:@"category%lu", (unsigned long)(i % 16)];
+    MDCSnackbarMessagePriority priority = (MDCSnackbarMessagePriority)(i % 3);
+    [messages addObject:MessageWith(text, category, priority)];
+  }
+
+  [self measureBlock:^{
+    MDCSnackbarMessageQueue *queue = [[MDCSnackbarMessageQueue alloc] init];
+    [queue suspendCategory:@"category1"];
+
+    // When
+    for (MDCSnackbarMessage *message in messages) {
+      [queue enqueueMessage:message];
+    }
+    NSUInteger dequeuedCount = 0;
+    MDCSnackbarMessagePriority previousPriority = MDCSnackbarMessagePriorityHigh;
+    MDCSnackbarMessage *message;
+    while ((message = [queue dequeueNextShowableMessage])) {
+      XCTAssertNotEqualObjects(message.category, @"category1");
+      XCTAssertLessThanOrEqual(message.priority, previousPriority);
+      previousPriority = message.priority;
+      ++dequeuedCount;
+    }
+
+    // Then
+    NSUInteger suspendedCount = kStressMessageCount / 16;
+    XCTAssertEqual(dequeuedCount, kStressMessageCount - suspendedCount);
+    XCTAssertEqual(queue.count, suspendedCount);
+    [queue resumeCategory:@"category1"];
+    XCTAssertEqual([queue removeMessagesWithCategory:nil].count, suspendedCount);
+  }];
+}
+
+@end
@@ -14,6 +14,7 @@
 
 #import <XCTest/XCTest.h>
 #import "../../src/private/MDCSnackbarManagerInternal.h"
+#import "../../src/private/MDCSnackbarMessageViewInternal.h"
 #import "MaterialSnackbar.h"
 
 @interface MDCSnackbarManagerInternal (SnackbarManagerTesting)
@@ -249,6 +250,40 @@
   XCTAssertFalse(blockCalled);
 }
 
+- (void)testShowingADuplicateKeepsTheMessageOnScreen {
+  // Given
+  MDCSnackbarManager *manager = MDCSnackbarManager.defaultManager;
+  manager.coalescesDuplicateMessages = YES;
+  MDCSnackbarMessage *message = [MDCSnackbarMessage messageWithText:@"foo1"];
+  message.duration = 10;
+  MDCSnackbarMessage *duplicateMessage = [MDCSnackbarMessage messageWithText:@"foo1"];
+  duplicateMessage.duration = 10;
+  XCTestExpectation *duplicateExpectation = [self expectationWithDescription:@"discarded"];
+  __block BOOL duplicateUserInitiated = YES;
+  duplicateMessage.completionHandler = ^(BOOL userInitiated) {
+    duplicateUserInitiated = userInitiated;
+    [duplicateExpectation fulfill];
+  };
+  [manager showMessage:message];
+  XCTestExpectation *mainQueueExpectation = [self expectationWithDescription:@"shown"];
+  dispatch_async(dispatch_get_main_queue(), ^{
+    [mainQueueExpectation fulfill];
+  });
+  [self waitForExpectations:@[ mainQueueExpectation ] timeout:1];
+  MDCSnackbarMessageView *messageView = manager.internalManager.currentSnackbar;
+
+  // When
+  [manager showMessage:duplicateMessage];
+  [self waitForExpectations:@[ duplicateExpectation ] timeout:1];
+
+  // Then
+  XCTAssertNotNil(messageView);
+  XCTAssertEqual(manager.internalManager.currentSnackbar, messageView);
+  XCTAssertFalse(messageView.dismissing);
+  XCTAssertFalse(duplicateUserInitiated);
+  manager.coalescesDuplicateMessages = NO;
+}
+
 - (void)testDefaultValueForOverrideBaseElevationIsNegative {
   // Then
   XCTAssertLessThan(MDCSnackbarManager.defaultManager.mdc_overrideBaseElevation, 0);
@@ -482,11 +482,18 @@ static inline UIColor *RippleColor() {
   return [_itemBar sizeThatFits:size];
 }
 
+- (void)didMoveToSuperview {
+  [super didMoveToSuperview];
+
+  [self mdc_elevationHierarchyDidChange];
+}
+
 - (void)didMoveToWindow {
   [super didMoveToWindow];
 
   // Ensure the bar position is up to date before moving to a window.
   [self updateItemBarPosition];
+  [self mdc_elevationHierarchyDidChange];
 }
 
 #pragma mark - Private
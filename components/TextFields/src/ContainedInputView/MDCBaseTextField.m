@@ -21,6 +21,7 @@
 #import "MDCTextControlState.h"
 #import "MaterialMath.h"
 #import "private/MDCBaseTextFieldLayout.h"
+#import "private/MDCBaseTextFieldLayoutInputs.h"
 #import "private/MDCTextControlAssistiveLabelView.h"
 #import "private/MDCTextControlColorViewModel.h"
 #import "private/MDCTextControlLabelAnimation.h"
@@ -33,6 +34,13 @@
 @property(strong, nonatomic) UILabel *label;
 @property(nonatomic, strong) MDCTextControlAssistiveLabelView *assistiveLabelView;
 @property(strong, nonatomic) MDCBaseTextFieldLayout *layout;
+
+/**
+ The most recently calculated layout and the inputs it was calculated from. The layout is reused
+ as long as the inputs don't change.
+ */
+@property(strong, nonatomic) MDCBaseTextFieldLayout *memoizedLayout;
+@property(strong, nonatomic) MDCBaseTextFieldLayoutInputs *memoizedLayoutInputs;
 @property(nonatomic, assign) UIUserInterfaceLayoutDirection layoutDirection;
 @property(nonatomic, assign) MDCTextControlState textControlState;
 @property(nonatomic, assign) MDCTextControlLabelState labelState;
@@ -198,13 +206,21 @@
   return CGRectMake(CGRectGetMinX(textRect), minY, CGRectGetWidth(textRect), systemDefinedHeight);
 }
 
+/**
+ Returns the layout for the text field's current state. Layout passes that don't change any of the
+ layout's inputs, such as most of the ones caused by typing, reuse the previous layout instead of
+ measuring the labels again.
+ */
 - (MDCBaseTextFieldLayout *)calculateLayoutWithTextFieldSize:(CGSize)textFieldSize {
   CGFloat clampedCustomAssistiveLabelDrawPriority =
       [self clampedCustomAssistiveLabelDrawPriority:self.customAssistiveLabelDrawPriority];
   CGFloat clearButtonSideLength = [self clearButtonSideLengthWithTextFieldSize:textFieldSize];
   id<MDCTextControlVerticalPositioningReference> positioningReference =
       [self createPositioningReference];
-  return [[MDCBaseTextFieldLayout alloc]
+  UILabel *leftAssistiveLabel = self.assistiveLabelView.leftAssistiveLabel;
+  UILabel *rightAssistiveLabel = self.assistiveLabelView.rightAssistiveLabel;
+
+  MDCBaseTextFieldLayoutInputs *inputs = [[MDCBaseTextFieldLayoutInputs alloc]
                  initWithTextFieldSize:textFieldSize
                   positioningReference:positioningReference
                                   text:self.text
@@ -217,12 +233,23 @@
                          rightViewMode:self.rightViewMode
                  clearButtonSideLength:clearButtonSideLength
                        clearButtonMode:self.clearButtonMode
-                    leftAssistiveLabel:self.assistiveLabelView.leftAssistiveLabel
-                   rightAssistiveLabel:self.assistiveLabelView.rightAssistiveLabel
+                    leftAssistiveLabel:leftAssistiveLabel
+                   rightAssistiveLabel:rightAssistiveLabel
             assistiveLabelDrawPriority:self.assistiveLabelDrawPriority
       customAssistiveLabelDrawPriority:clampedCustomAssistiveLabelDrawPriority
                                  isRTL:self.isRTL
                              isEditing:self.isEditing];
+  if (self.memoizedLayout && [inputs isEqualToLayoutInputs:self.memoizedLayoutInputs]) {
+    return self.memoizedLayout;
+  }
+
+  MDCBaseTextFieldLayout *layout =
+      [[MDCBaseTextFieldLayout alloc] initWithInputs:inputs
+                                  leftAssistiveLabel:leftAssistiveLabel
+                                 rightAssistiveLabel:rightAssistiveLabel];
+  self.memoizedLayout = layout;
+  self.memoizedLayoutInputs = inputs;
+  return layout;
 }
 
 - (id<MDCTextControlVerticalPositioningReference>)createPositioningReference {
@@ -15,6 +15,7 @@
 #import <Foundation/Foundation.h>
 #import <UIKit/UIKit.h>
 
+#import "MDCBaseTextFieldLayoutInputs.h"
 #import "MDCTextControlAssistiveLabelDrawPriority.h"
 #import "MDCTextControlAssistiveLabelViewLayout.h"
 #import "MDCTextControlVerticalPositioningReference.h"
@@ -39,6 +40,21 @@
 @property(nonatomic, readonly) CGFloat calculatedHeight;
 @property(nonatomic, assign) CGFloat containerHeight;
 
+/**
+ Calculates a layout from plain values. Assistive label text is measured with TextKit, so this can
+ be called on any thread, e.g. to calculate the heights of a form's text fields before they exist.
+ */
+- (nonnull instancetype)initWithInputs:(nonnull MDCBaseTextFieldLayoutInputs *)inputs;
+
+/**
+ Calculates a layout from plain values, letting the given assistive labels measure their own text.
+ The labels must display the assistive label text described by @c inputs. This must be called on
+ the main thread.
+ */
+- (nonnull instancetype)initWithInputs:(nonnull MDCBaseTextFieldLayoutInputs *)inputs
+                    leftAssistiveLabel:(nullable UILabel *)leftAssistiveLabel
+                   rightAssistiveLabel:(nullable UILabel *)rightAssistiveLabel;
+
 /**
   Initializing an MDCBaseTextFieldLayout object with this initializer is tantamount to calculating a
   layout for a TextField. The admittedly long parameter list includes everything that might impact
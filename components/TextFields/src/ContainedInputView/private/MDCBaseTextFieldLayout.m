@@ -24,6 +24,23 @@ static const CGFloat kHorizontalPadding = (CGFloat)12.0;
 
 #pragma mark Object Lifecycle
 
+- (instancetype)initWithInputs:(MDCBaseTextFieldLayoutInputs *)inputs {
+  return [self initWithInputs:inputs leftAssistiveLabel:nil rightAssistiveLabel:nil];
+}
+
+- (instancetype)initWithInputs:(MDCBaseTextFieldLayoutInputs *)inputs
+            leftAssistiveLabel:(UILabel *)leftAssistiveLabel
+           rightAssistiveLabel:(UILabel *)rightAssistiveLabel {
+  self = [super init];
+  if (self) {
+    [self calculateLayoutWithInputs:inputs
+                 leftAssistiveLabel:leftAssistiveLabel
+                rightAssistiveLabel:rightAssistiveLabel];
+    return self;
+  }
+  return nil;
+}
+
 - (instancetype)initWithTextFieldSize:(CGSize)textFieldSize
                  positioningReference:
                      (id<MDCTextControlVerticalPositioningReference>)positioningReference
@@ -44,63 +61,53 @@ static const CGFloat kHorizontalPadding = (CGFloat)12.0;
      customAssistiveLabelDrawPriority:(CGFloat)customAssistiveLabelDrawPriority
                                 isRTL:(BOOL)isRTL
                             isEditing:(BOOL)isEditing {
-  self = [super init];
-  if (self) {
-    [self calculateLayoutWithTextFieldSize:textFieldSize
-                      positioningReference:positioningReference
-                                      text:text
-                                      font:font
-                              floatingFont:floatingFont
-                                     label:label
-                                  leftView:leftView
-                              leftViewMode:leftViewMode
-                                 rightView:rightView
-                             rightViewMode:rightViewMode
-                     clearButtonSideLength:clearButtonSideLength
-                           clearButtonMode:clearButtonMode
-                        leftAssistiveLabel:leftAssistiveLabel
-                       rightAssistiveLabel:rightAssistiveLabel
-                assistiveLabelDrawPriority:assistiveLabelDrawPriority
-          customAssistiveLabelDrawPriority:customAssistiveLabelDrawPriority
-                                     isRTL:isRTL
-                                 isEditing:isEditing];
-    return self;
-  }
-  return nil;
+  MDCBaseTextFieldLayoutInputs *inputs =
+      [[MDCBaseTextFieldLayoutInputs alloc] initWithTextFieldSize:textFieldSize
+                                             positioningReference:positioningReference
+                                                             text:text
+                                                             font:font
+                                                     floatingFont:floatingFont
+                                                            label:label
+                                                         leftView:leftView
+                                                     leftViewMode:leftViewMode
+                                                        rightView:rightView
+                                                    rightViewMode:rightViewMode
+                                            clearButtonSideLength:clearButtonSideLength
+                                                  clearButtonMode:clearButtonMode
+                                               leftAssistiveLabel:leftAssistiveLabel
+                                              rightAssistiveLabel:rightAssistiveLabel
+                                       assistiveLabelDrawPriority:assistiveLabelDrawPriority
+                                 customAssistiveLabelDrawPriority:customAssistiveLabelDrawPriority
+                                                            isRTL:isRTL
+                                                        isEditing:isEditing];
+  return [self initWithInputs:inputs
+           leftAssistiveLabel:leftAssistiveLabel
+          rightAssistiveLabel:rightAssistiveLabel];
 }
 
 #pragma mark Layout Calculation
 
-- (void)calculateLayoutWithTextFieldSize:(CGSize)textFieldSize
-                    positioningReference:
-                        (id<MDCTextControlVerticalPositioningReference>)positioningReference
-                                    text:(NSString *)text
-                                    font:(UIFont *)font
-                            floatingFont:(UIFont *)floatingFont
-                                   label:(UILabel *)label
-                                leftView:(UIView *)leftView
-                            leftViewMode:(UITextFieldViewMode)leftViewMode
-                               rightView:(UIView *)rightView
-                           rightViewMode:(UITextFieldViewMode)rightViewMode
-                   clearButtonSideLength:(CGFloat)clearButtonSideLength
-                         clearButtonMode:(UITextFieldViewMode)clearButtonMode
-                      leftAssistiveLabel:(nonnull UILabel *)leftAssistiveLabel
-                     rightAssistiveLabel:(nonnull UILabel *)rightAssistiveLabel
-              assistiveLabelDrawPriority:
-                  (MDCTextControlAssistiveLabelDrawPriority)assistiveLabelDrawPriority
-        customAssistiveLabelDrawPriority:(CGFloat)customAssistiveLabelDrawPriority
-                                   isRTL:(BOOL)isRTL
-                               isEditing:(BOOL)isEditing {
-  BOOL displaysLeftView = [self displaysSideView:leftView
-                                        viewMode:leftViewMode
-                                       isEditing:isEditing];
-  BOOL displaysRightView = [self displaysSideView:rightView
-                                         viewMode:rightViewMode
-                                        isEditing:isEditing];
-  BOOL displaysClearButton = [self shouldDisplayClearButtonWithViewMode:clearButtonMode
+- (void)calculateLayoutWithInputs:(MDCBaseTextFieldLayoutInputs *)inputs
+               leftAssistiveLabel:(UILabel *)leftAssistiveLabel
+              rightAssistiveLabel:(UILabel *)rightAssistiveLabel {
+  BOOL isRTL = inputs.isRTL;
+  BOOL isEditing = inputs.isEditing;
+  UIFont *font = inputs.font;
+  UIFont *floatingFont = inputs.floatingFont;
+  CGFloat clearButtonSideLength = inputs.clearButtonSideLength;
+  CGSize leftViewSize = inputs.leftViewSize;
+  CGSize rightViewSize = inputs.rightViewSize;
+
+  BOOL displaysLeftView = [self displaysSideViewWithSize:leftViewSize
+                                                viewMode:inputs.leftViewMode
+                                               isEditing:isEditing];
+  BOOL displaysRightView = [self displaysSideViewWithSize:rightViewSize
+                                                 viewMode:inputs.rightViewMode
+                                                isEditing:isEditing];
+  BOOL displaysClearButton = [self shouldDisplayClearButtonWithViewMode:inputs.clearButtonMode
                                                               isEditing:isEditing
-                                                                   text:text];
-  CGFloat leftViewWidth = CGRectGetWidth(leftView.frame);
+                                                                hasText:inputs.hasText];
+  CGFloat leftViewWidth = leftViewSize.width;
   CGFloat leftViewMinX = 0;
   CGFloat leftViewMaxX = 0;
   if (displaysLeftView) {
@@ -108,11 +115,11 @@ static const CGFloat kHorizontalPadding = (CGFloat)12.0;
     leftViewMaxX = leftViewMinX + leftViewWidth;
   }
 
-  CGFloat textFieldWidth = textFieldSize.width;
+  CGFloat textFieldWidth = inputs.textFieldSize.width;
   CGFloat rightViewMinX = 0;
   if (displaysRightView) {
     CGFloat rightViewMaxX = textFieldWidth - kHorizontalPadding;
-    rightViewMinX = rightViewMaxX - CGRectGetWidth(rightView.frame);
+    rightViewMinX = rightViewMaxX - rightViewSize.width;
   }
 
   CGFloat clearButtonMinX = 0;
@@ -124,28 +131,28 @@ static const CGFloat kHorizontalPadding = (CGFloat)12.0;
     clearButtonMinX = clearButtonMaxX - clearButtonSideLength;
   }
 
-  CGFloat floatingLabelMinY = positioningReference.paddingBetweenContainerTopAndFloatingLabel;
+  CGFloat floatingLabelMinY = inputs.paddingBetweenContainerTopAndFloatingLabel;
   CGFloat floatingLabelHeight = floatingFont.lineHeight;
   CGFloat floatingLabelMaxY = floatingLabelMinY + floatingLabelHeight;
 
   CGFloat textRectMinYWithFloatingLabel =
-      floatingLabelMaxY + positioningReference.paddingBetweenFloatingLabelAndEditingText;
+      floatingLabelMaxY + inputs.paddingBetweenFloatingLabelAndEditingText;
 
   CGFloat textRectHeight = [self textHeightWithFont:font];
   CGFloat textRectCenterYWithFloatingLabel =
       textRectMinYWithFloatingLabel + ((CGFloat)0.5 * textRectHeight);
 
-  CGFloat textRectMinYNormal = positioningReference.paddingBetweenContainerTopAndNormalLabel;
+  CGFloat textRectMinYNormal = inputs.paddingBetweenContainerTopAndNormalLabel;
   CGFloat textRectCenterYNormal = textRectMinYNormal + ((CGFloat)0.5 * textRectHeight);
-  CGFloat containerMidY = (CGFloat)0.5 * positioningReference.containerHeight;
+  CGFloat containerMidY = (CGFloat)0.5 * inputs.containerHeight;
 
-  CGFloat leftViewHeight = CGRectGetHeight(leftView.frame);
+  CGFloat leftViewHeight = leftViewSize.height;
   CGFloat leftViewMinY = 0;
   if (displaysLeftView) {
     leftViewMinY = [self minYForSubviewWithHeight:leftViewHeight centerY:containerMidY];
   }
 
-  CGFloat rightViewHeight = CGRectGetHeight(rightView.frame);
+  CGFloat rightViewHeight = rightViewSize.height;
   CGFloat rightViewMinY = 0;
   if (displaysRightView) {
     rightViewMinY = [self minYForSubviewWithHeight:rightViewHeight centerY:containerMidY];
@@ -207,14 +214,14 @@ static const CGFloat kHorizontalPadding = (CGFloat)12.0;
 
   CGRect leftViewFrame = CGRectMake(leftViewMinX, leftViewMinY, leftViewWidth, leftViewHeight);
   CGRect rightViewFrame =
-      CGRectMake(rightViewMinX, rightViewMinY, CGRectGetWidth(rightView.frame), rightViewHeight);
+      CGRectMake(rightViewMinX, rightViewMinY, rightViewSize.width, rightViewHeight);
 
   CGRect clearButtonFrameNormal =
       CGRectMake(clearButtonMinX, clearButtonMinY, clearButtonSideLength, clearButtonSideLength);
   CGRect clearButtonFrameFloating = CGRectMake(clearButtonMinX, clearButtonFloatingMinY,
                                                clearButtonSideLength, clearButtonSideLength);
 
-  CGRect labelFrameNormal = [self labelFrameWithText:label.text
+  CGRect labelFrameNormal = [self labelFrameWithText:inputs.labelText
                                           labelState:MDCTextControlLabelStateNormal
                                                 font:font
                                         floatingFont:floatingFont
@@ -223,7 +230,7 @@ static const CGFloat kHorizontalPadding = (CGFloat)12.0;
                                            labelMaxX:labelMaxX
                                             textRect:textRectNormal
                                                isRTL:isRTL];
-  CGRect labelFrameFloating = [self labelFrameWithText:label.text
+  CGRect labelFrameFloating = [self labelFrameWithText:inputs.labelText
                                             labelState:MDCTextControlLabelStateFloating
                                                   font:font
                                           floatingFont:floatingFont
@@ -233,17 +240,37 @@ static const CGFloat kHorizontalPadding = (CGFloat)12.0;
                                               textRect:textRectNormal
                                                  isRTL:isRTL];
 
-  self.assistiveLabelViewLayout = [[MDCTextControlAssistiveLabelViewLayout alloc]
-                         initWithWidth:textFieldWidth
-                    leftAssistiveLabel:leftAssistiveLabel
-                   rightAssistiveLabel:rightAssistiveLabel
-            assistiveLabelDrawPriority:assistiveLabelDrawPriority
-      customAssistiveLabelDrawPriority:customAssistiveLabelDrawPriority
-                     horizontalPadding:kHorizontalPadding
-           paddingAboveAssistiveLabels:positioningReference.paddingAboveAssistiveLabels
-           paddingBelowAssistiveLabels:positioningReference.paddingBelowAssistiveLabels
-                                 isRTL:isRTL];
-  self.assistiveLabelViewFrame = CGRectMake(0, positioningReference.containerHeight, textFieldWidth,
+  // When the assistive labels themselves are available they measure their own text, which keeps
+  // on-screen text fields pixel-identical to UILabel's rendering. Otherwise the text is measured
+  // with TextKit, which is safe off the main thread.
+  if (leftAssistiveLabel && rightAssistiveLabel) {
+    self.assistiveLabelViewLayout = [[MDCTextControlAssistiveLabelViewLayout alloc]
+                           initWithWidth:textFieldWidth
+                      leftAssistiveLabel:leftAssistiveLabel
+                     rightAssistiveLabel:rightAssistiveLabel
+              assistiveLabelDrawPriority:inputs.assistiveLabelDrawPriority
+        customAssistiveLabelDrawPriority:inputs.customAssistiveLabelDrawPriority
+                       horizontalPadding:kHorizontalPadding
+             paddingAboveAssistiveLabels:inputs.paddingAboveAssistiveLabels
+             paddingBelowAssistiveLabels:inputs.paddingBelowAssistiveLabels
+                                   isRTL:isRTL];
+  } else {
+    self.assistiveLabelViewLayout = [[MDCTextControlAssistiveLabelViewLayout alloc]
+                           initWithWidth:textFieldWidth
+                  leftAssistiveLabelText:inputs.leftAssistiveLabelText
+                  leftAssistiveLabelFont:inputs.leftAssistiveLabelFont
+         leftAssistiveLabelNumberOfLines:inputs.leftAssistiveLabelNumberOfLines
+                 rightAssistiveLabelText:inputs.rightAssistiveLabelText
+                 rightAssistiveLabelFont:inputs.rightAssistiveLabelFont
+        rightAssistiveLabelNumberOfLines:inputs.rightAssistiveLabelNumberOfLines
+              assistiveLabelDrawPriority:inputs.assistiveLabelDrawPriority
+        customAssistiveLabelDrawPriority:inputs.customAssistiveLabelDrawPriority
+                       horizontalPadding:kHorizontalPadding
+             paddingAboveAssistiveLabels:inputs.paddingAboveAssistiveLabels
+             paddingBelowAssistiveLabels:inputs.paddingBelowAssistiveLabels
+                                   isRTL:isRTL];
+  }
+  self.assistiveLabelViewFrame = CGRectMake(0, inputs.containerHeight, textFieldWidth,
                                             self.assistiveLabelViewLayout.calculatedHeight);
   self.leftViewFrame = leftViewFrame;
   self.rightViewFrame = rightViewFrame;
@@ -255,18 +282,18 @@ static const CGFloat kHorizontalPadding = (CGFloat)12.0;
   self.labelFrameNormal = labelFrameNormal;
   self.leftViewHidden = !displaysLeftView;
   self.rightViewHidden = !displaysRightView;
-  self.containerHeight = positioningReference.containerHeight;
+  self.containerHeight = inputs.containerHeight;
 }
 
 - (CGFloat)minYForSubviewWithHeight:(CGFloat)height centerY:(CGFloat)centerY {
   return (CGFloat)round((double)(centerY - ((CGFloat)0.5 * height)));
 }
 
-- (BOOL)displaysSideView:(UIView *)subview
-                viewMode:(UITextFieldViewMode)viewMode
-               isEditing:(BOOL)isEditing {
+- (BOOL)displaysSideViewWithSize:(CGSize)size
+                        viewMode:(UITextFieldViewMode)viewMode
+                       isEditing:(BOOL)isEditing {
   BOOL displaysSideView = NO;
-  if (subview && !CGSizeEqualToSize(CGSizeZero, subview.frame.size)) {
+  if (!CGSizeEqualToSize(CGSizeZero, size)) {
     switch (viewMode) {
       case UITextFieldViewModeWhileEditing:
         displaysSideView = isEditing;
@@ -289,8 +316,7 @@ static const CGFloat kHorizontalPadding = (CGFloat)12.0;
 
 - (BOOL)shouldDisplayClearButtonWithViewMode:(UITextFieldViewMode)viewMode
                                    isEditing:(BOOL)isEditing
-                                        text:(NSString *)text {
-  BOOL hasText = text.length > 0;
+                                     hasText:(BOOL)hasText {
   switch (viewMode) {
     case UITextFieldViewModeWhileEditing:
       return isEditing && hasText;
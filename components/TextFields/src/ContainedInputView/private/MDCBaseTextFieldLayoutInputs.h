@@ -0,0 +1,136 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <Foundation/Foundation.h>
+#import <UIKit/UIKit.h>
+
+#import "MDCTextControlAssistiveLabelDrawPriority.h"
+#import "MDCTextControlVerticalPositioningReference.h"
+
+/**
+ A plain value description of everything that can affect an MDCBaseTextFieldLayout.
+
+ MDCBaseTextFieldLayoutInputs objects only keep the values the layout calculation actually reads.
+ For example, the text only matters to the layout through whether it is empty, and side views only
+ matter through their sizes. Two equal inputs objects therefore always produce identical layouts,
+ which lets MDCBaseTextField reuse its previous layout when, for example, typing a character changes
+ nothing geometric.
+
+ Inputs can be created from a text field's views on the main thread, or from values on any thread.
+ Together with MDCBaseTextFieldLayout's @c -initWithInputs:, the latter allows the heights of text
+ fields to be calculated on a background queue before the text fields are created.
+ */
+@interface MDCBaseTextFieldLayoutInputs : NSObject
+
+@property(nonatomic, assign, readonly) CGSize textFieldSize;
+@property(nonatomic, assign, readonly) BOOL hasText;
+@property(nonatomic, strong, readonly, nonnull) UIFont *font;
+@property(nonatomic, strong, readonly, nonnull) UIFont *floatingFont;
+@property(nonatomic, copy, readonly, nullable) NSString *labelText;
+@property(nonatomic, assign, readonly) CGSize leftViewSize;
+@property(nonatomic, assign, readonly) UITextFieldViewMode leftViewMode;
+@property(nonatomic, assign, readonly) CGSize rightViewSize;
+@property(nonatomic, assign, readonly) UITextFieldViewMode rightViewMode;
+@property(nonatomic, assign, readonly) CGFloat clearButtonSideLength;
+@property(nonatomic, assign, readonly) UITextFieldViewMode clearButtonMode;
+/** The text of the left assistive label, or nil if it is hidden or has none. */
+@property(nonatomic, copy, readonly, nullable) NSAttributedString *leftAssistiveLabelText;
+@property(nonatomic, strong, readonly, nullable) UIFont *leftAssistiveLabelFont;
+@property(nonatomic, assign, readonly) NSInteger leftAssistiveLabelNumberOfLines;
+/** The text of the right assistive label, or nil if it is hidden or has none. */
+@property(nonatomic, copy, readonly, nullable) NSAttributedString *rightAssistiveLabelText;
+@property(nonatomic, strong, readonly, nullable) UIFont *rightAssistiveLabelFont;
+@property(nonatomic, assign, readonly) NSInteger rightAssistiveLabelNumberOfLines;
+@property(nonatomic, assign, readonly)
+    MDCTextControlAssistiveLabelDrawPriority assistiveLabelDrawPriority;
+@property(nonatomic, assign, readonly) CGFloat customAssistiveLabelDrawPriority;
+@property(nonatomic, assign, readonly) BOOL isRTL;
+@property(nonatomic, assign, readonly) BOOL isEditing;
+
+/**
+ The values of the positioning reference the inputs were created with. The positioning reference
+ itself is not kept, since style objects vend a new one for every layout pass.
+ */
+@property(nonatomic, assign, readonly) CGFloat paddingBetweenContainerTopAndFloatingLabel;
+@property(nonatomic, assign, readonly) CGFloat paddingBetweenContainerTopAndNormalLabel;
+@property(nonatomic, assign, readonly) CGFloat paddingBetweenFloatingLabelAndEditingText;
+@property(nonatomic, assign, readonly) CGFloat paddingBetweenEditingTextAndContainerBottom;
+@property(nonatomic, assign, readonly) CGFloat paddingAboveAssistiveLabels;
+@property(nonatomic, assign, readonly) CGFloat paddingBelowAssistiveLabels;
+@property(nonatomic, assign, readonly) CGFloat containerHeight;
+
+/**
+ Creates inputs from plain values. This can be called on any thread.
+
+ Side views are described by their sizes, with CGSizeZero meaning there is no side view. Assistive
+ labels are described by their text, font and maximum number of lines, with nil text meaning the
+ label is hidden or empty.
+ */
+- (nonnull instancetype)initWithTextFieldSize:(CGSize)textFieldSize
+                         positioningReference:
+                             (nonnull id<MDCTextControlVerticalPositioningReference>)
+                                 positioningReference
+                                         text:(nullable NSString *)text
+                                         font:(nonnull UIFont *)font
+                                 floatingFont:(nonnull UIFont *)floatingFont
+                                    labelText:(nullable NSString *)labelText
+                                 leftViewSize:(CGSize)leftViewSize
+                                 leftViewMode:(UITextFieldViewMode)leftViewMode
+                                rightViewSize:(CGSize)rightViewSize
+                                rightViewMode:(UITextFieldViewMode)rightViewMode
+                        clearButtonSideLength:(CGFloat)clearButtonSideLength
+                              clearButtonMode:(UITextFieldViewMode)clearButtonMode
+                       leftAssistiveLabelText:(nullable NSAttributedString *)leftAssistiveLabelText
+                       leftAssistiveLabelFont:(nullable UIFont *)leftAssistiveLabelFont
+              leftAssistiveLabelNumberOfLines:(NSInteger)leftAssistiveLabelNumberOfLines
+                      rightAssistiveLabelText:(nullable NSAttributedString *)rightAssistiveLabelText
+                      rightAssistiveLabelFont:(nullable UIFont *)rightAssistiveLabelFont
+             rightAssistiveLabelNumberOfLines:(NSInteger)rightAssistiveLabelNumberOfLines
+                   assistiveLabelDrawPriority:
+                       (MDCTextControlAssistiveLabelDrawPriority)assistiveLabelDrawPriority
+             customAssistiveLabelDrawPriority:(CGFloat)customAssistiveLabelDrawPriority
+                                        isRTL:(BOOL)isRTL
+                                    isEditing:(BOOL)isEditing NS_DESIGNATED_INITIALIZER;
+
+/**
+ Captures the layout inputs from a text field's views. The parameters are the same as those of
+ MDCBaseTextFieldLayout's view-based initializer. This must be called on the main thread.
+ */
+- (nonnull instancetype)initWithTextFieldSize:(CGSize)textFieldSize
+                         positioningReference:
+                             (nonnull id<MDCTextControlVerticalPositioningReference>)
+                                 positioningReference
+                                         text:(nullable NSString *)text
+                                         font:(nonnull UIFont *)font
+                                 floatingFont:(nonnull UIFont *)floatingFont
+                                        label:(nonnull UILabel *)label
+                                     leftView:(nullable UIView *)leftView
+                                 leftViewMode:(UITextFieldViewMode)leftViewMode
+                                    rightView:(nullable UIView *)rightView
+                                rightViewMode:(UITextFieldViewMode)rightViewMode
+                        clearButtonSideLength:(CGFloat)clearButtonSideLength
+                              clearButtonMode:(UITextFieldViewMode)clearButtonMode
+                           leftAssistiveLabel:(nonnull UILabel *)leftAssistiveLabel
+                          rightAssistiveLabel:(nonnull UILabel *)rightAssistiveLabel
+                   assistiveLabelDrawPriority:
+                       (MDCTextControlAssistiveLabelDrawPriority)assistiveLabelDrawPriority
+             customAssistiveLabelDrawPriority:(CGFloat)customAssistiveLabelDrawPriority
+                                        isRTL:(BOOL)isRTL
+                                    isEditing:(BOOL)isEditing;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+- (BOOL)isEqualToLayoutInputs:(nullable MDCBaseTextFieldLayoutInputs *)inputs;
+
+@end
@@ -0,0 +1,222 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCBaseTextFieldLayoutInputs.h"
+
+static BOOL MDCBaseTextFieldLayoutObjectsEqual(id object1, id object2) {
+  return object1 == object2 || [object1 isEqual:object2];
+}
+
+/** Mixes @c value into @c hash, so that equal values in different fields don't cancel out. */
+static inline NSUInteger MDCBaseTextFieldLayoutHashCombine(NSUInteger hash, NSUInteger value) {
+  return hash * 31 + value;
+}
+
+/** Returns a hash of @c value that is equal for values that compare equal, including 0 and -0. */
+static inline NSUInteger MDCBaseTextFieldLayoutFloatHash(CGFloat value) {
+  return (NSUInteger)(NSInteger)value;
+}
+
+@implementation MDCBaseTextFieldLayoutInputs
+
+#pragma mark Object Lifecycle
+
+- (instancetype)initWithTextFieldSize:(CGSize)textFieldSize
+                 positioningReference:
+                     (id<MDCTextControlVerticalPositioningReference>)positioningReference
+                                 text:(NSString *)text
+                                 font:(UIFont *)font
+                         floatingFont:(UIFont *)floatingFont
+                            labelText:(NSString *)labelText
+                         leftViewSize:(CGSize)leftViewSize
+                         leftViewMode:(UITextFieldViewMode)leftViewMode
+                        rightViewSize:(CGSize)rightViewSize
+                        rightViewMode:(UITextFieldViewMode)rightViewMode
+                clearButtonSideLength:(CGFloat)clearButtonSideLength
+                      clearButtonMode:(UITextFieldViewMode)clearButtonMode
+               leftAssistiveLabelText:(NSAttributedString *)leftAssistiveLabelText
+               leftAssistiveLabelFont:(UIFont *)leftAssistiveLabelFont
+      leftAssistiveLabelNumberOfLines:(NSInteger)leftAssistiveLabelNumberOfLines
+              rightAssistiveLabelText:(NSAttributedString *)rightAssistiveLabelText
+              rightAssistiveLabelFont:(UIFont *)rightAssistiveLabelFont
+     rightAssistiveLabelNumberOfLines:(NSInteger)rightAssistiveLabelNumberOfLines
+           assistiveLabelDrawPriority:
+               (MDCTextControlAssistiveLabelDrawPriority)assistiveLabelDrawPriority
+     customAssistiveLabelDrawPriority:(CGFloat)customAssistiveLabelDrawPriority
+                                isRTL:(BOOL)isRTL
+                            isEditing:(BOOL)isEditing {
+  self = [super init];
+  if (self) {
+    _textFieldSize = textFieldSize;
+    _hasText = text.length > 0;
+    _font = font;
+    _floatingFont = floatingFont;
+    _labelText = [labelText copy];
+    _leftViewSize = leftViewSize;
+    _leftViewMode = leftViewMode;
+    _rightViewSize = rightViewSize;
+    _rightViewMode = rightViewMode;
+    _clearButtonSideLength = clearButtonSideLength;
+    _clearButtonMode = clearButtonMode;
+    _leftAssistiveLabelText =
+        leftAssistiveLabelText.length > 0 ? [leftAssistiveLabelText copy] : nil;
+    _leftAssistiveLabelFont = leftAssistiveLabelFont;
+    _leftAssistiveLabelNumberOfLines = leftAssistiveLabelNumberOfLines;
+    _rightAssistiveLabelText =
+        rightAssistiveLabelText.length > 0 ? [rightAssistiveLabelText copy] : nil;
+    _rightAssistiveLabelFont = rightAssistiveLabelFont;
+    _rightAssistiveLabelNumberOfLines = rightAssistiveLabelNumberOfLines;
+    _assistiveLabelDrawPriority = assistiveLabelDrawPriority;
+    _customAssistiveLabelDrawPriority = customAssistiveLabelDrawPriority;
+    _isRTL = isRTL;
+    _isEditing = isEditing;
+    _paddingBetweenContainerTopAndFloatingLabel =
+        positioningReference.paddingBetweenContainerTopAndFloatingLabel;
+    _paddingBetweenContainerTopAndNormalLabel =
+        positioningReference.paddingBetweenContainerTopAndNormalLabel;
+    _paddingBetweenFloatingLabelAndEditingText =
+        positioningReference.paddingBetweenFloatingLabelAndEditingText;
+    _paddingBetweenEditingTextAndContainerBottom =
+        positioningReference.paddingBetweenEditingTextAndContainerBottom;
+    _paddingAboveAssistiveLabels = positioningReference.paddingAboveAssistiveLabels;
+    _paddingBelowAssistiveLabels = positioningReference.paddingBelowAssistiveLabels;
+    _containerHeight = positioningReference.containerHeight;
+  }
+  return self;
+}
+
+- (instancetype)initWithTextFieldSize:(CGSize)textFieldSize
+                 positioningReference:
+                     (id<MDCTextControlVerticalPositioningReference>)positioningReference
+                                 text:(NSString *)text
+                                 font:(UIFont *)font
+                         floatingFont:(UIFont *)floatingFont
+                                label:(UILabel *)label
+                             leftView:(UIView *)leftView
+                         leftViewMode:(UITextFieldViewMode)leftViewMode
+                            rightView:(UIView *)rightView
+                        rightViewMode:(UITextFieldViewMode)rightViewMode
+                clearButtonSideLength:(CGFloat)clearButtonSideLength
+                      clearButtonMode:(UITextFieldViewMode)clearButtonMode
+                   leftAssistiveLabel:(UILabel *)leftAssistiveLabel
+                  rightAssistiveLabel:(UILabel *)rightAssistiveLabel
+           assistiveLabelDrawPriority:
+               (MDCTextControlAssistiveLabelDrawPriority)assistiveLabelDrawPriority
+     customAssistiveLabelDrawPriority:(CGFloat)customAssistiveLabelDrawPriority
+                                isRTL:(BOOL)isRTL
+                            isEditing:(BOOL)isEditing {
+  return [self initWithTextFieldSize:textFieldSize
+                  positioningReference:positioningReference
+                                  text:text
+                                  font:font
+                          floatingFont:floatingFont
+                             labelText:label.text
+                          leftViewSize:leftView.frame.size
+                          leftViewMode:leftViewMode
+                         rightViewSize:rightView.frame.size
+                         rightViewMode:rightViewMode
+                 clearButtonSideLength:clearButtonSideLength
+                       clearButtonMode:clearButtonMode
+                leftAssistiveLabelText:leftAssistiveLabel.hidden
+                                           ? nil
+                                           : leftAssistiveLabel.attributedText
+                leftAssistiveLabelFont:leftAssistiveLabel.font
+       leftAssistiveLabelNumberOfLines:leftAssistiveLabel.numberOfLines
+               rightAssistiveLabelText:rightAssistiveLabel.hidden
+                                           ? nil
+                                           : rightAssistiveLabel.attributedText
+               rightAssistiveLabelFont:rightAssistiveLabel.font
+      rightAssistiveLabelNumberOfLines:rightAssistiveLabel.numberOfLines
+            assistiveLabelDrawPriority:assistiveLabelDrawPriority
+      customAssistiveLabelDrawPriority:customAssistiveLabelDrawPriority
+                                 isRTL:isRTL
+                             isEditing:isEditing];
+}
+
+#pragma mark Equality
+
+- (BOOL)isEqual:(id)object {
+  if (self == object) {
+    return YES;
+  }
+  if (![object isKindOfClass:[MDCBaseTextFieldLayoutInputs class]]) {
+    return NO;
+  }
+  return [self isEqualToLayoutInputs:(MDCBaseTextFieldLayoutInputs *)object];
+}
+
+- (NSUInteger)hash {
+  // Hashes the fields that most often tell two layout passes apart. Fields left out, e.g. the
+  // paddings, still take part in -isEqual:.
+  NSUInteger hash = MDCBaseTextFieldLayoutFloatHash(self.textFieldSize.width);
+  hash = MDCBaseTextFieldLayoutHashCombine(
+      hash, MDCBaseTextFieldLayoutFloatHash(self.textFieldSize.height));
+  hash = MDCBaseTextFieldLayoutHashCombine(hash,
+                                           MDCBaseTextFieldLayoutFloatHash(self.containerHeight));
+  hash = MDCBaseTextFieldLayoutHashCombine(hash, (NSUInteger)self.hasText);
+  hash = MDCBaseTextFieldLayoutHashCombine(hash, (NSUInteger)self.isEditing);
+  hash = MDCBaseTextFieldLayoutHashCombine(hash, (NSUInteger)self.isRTL);
+  hash = MDCBaseTextFieldLayoutHashCombine(hash, self.font.hash);
+  hash = MDCBaseTextFieldLayoutHashCombine(hash, self.floatingFont.hash);
+  hash = MDCBaseTextFieldLayoutHashCombine(hash, self.labelText.hash);
+  hash = MDCBaseTextFieldLayoutHashCombine(hash, self.leftAssistiveLabelText.hash);
+  hash = MDCBaseTextFieldLayoutHashCombine(hash, self.leftAssistiveLabelFont.hash);
+  hash = MDCBaseTextFieldLayoutHashCombine(hash, self.rightAssistiveLabelText.hash);
+  hash = MDCBaseTextFieldLayoutHashCombine(hash, self.rightAssistiveLabelFont.hash);
+  return hash;
+}
+
+- (BOOL)isEqualToLayoutInputs:(MDCBaseTextFieldLayoutInputs *)inputs {
+  if (!inputs) {
+    return NO;
+  }
+  // The cheap scalar comparisons come first, since they are the ones most likely to differ between
+  // two layout passes.
+  return CGSizeEqualToSize(self.textFieldSize, inputs.textFieldSize) &&
+         self.hasText == inputs.hasText && self.isEditing == inputs.isEditing &&
+         self.isRTL == inputs.isRTL && CGSizeEqualToSize(self.leftViewSize, inputs.leftViewSize) &&
+         self.leftViewMode == inputs.leftViewMode &&
+         CGSizeEqualToSize(self.rightViewSize, inputs.rightViewSize) &&
+         self.rightViewMode == inputs.rightViewMode &&
+         self.clearButtonSideLength == inputs.clearButtonSideLength &&
+         self.clearButtonMode == inputs.clearButtonMode &&
+         self.leftAssistiveLabelNumberOfLines == inputs.leftAssistiveLabelNumberOfLines &&
+         self.rightAssistiveLabelNumberOfLines == inputs.rightAssistiveLabelNumberOfLines &&
+         self.assistiveLabelDrawPriority == inputs.assistiveLabelDrawPriority &&
+         self.customAssistiveLabelDrawPriority == inputs.customAssistiveLabelDrawPriority &&
+         self.paddingBetweenContainerTopAndFloatingLabel ==
+             inputs.paddingBetweenContainerTopAndFloatingLabel &&
+         self.paddingBetweenContainerTopAndNormalLabel ==
+             inputs.paddingBetweenContainerTopAndNormalLabel &&
+         self.paddingBetweenFloatingLabelAndEditingText ==
+             inputs.paddingBetweenFloatingLabelAndEditingText &&
+         self.paddingBetweenEditingTextAndContainerBottom ==
+             inputs.paddingBetweenEditingTextAndContainerBottom &&
+         self.paddingAboveAssistiveLabels == inputs.paddingAboveAssistiveLabels &&
+         self.paddingBelowAssistiveLabels == inputs.paddingBelowAssistiveLabels &&
+         self.containerHeight == inputs.containerHeight &&
+         MDCBaseTextFieldLayoutObjectsEqual(self.font, inputs.font) &&
+         MDCBaseTextFieldLayoutObjectsEqual(self.floatingFont, inputs.floatingFont) &&
+         MDCBaseTextFieldLayoutObjectsEqual(self.labelText, inputs.labelText) &&
+         MDCBaseTextFieldLayoutObjectsEqual(self.leftAssistiveLabelText,
+                                            inputs.leftAssistiveLabelText) &&
+         MDCBaseTextFieldLayoutObjectsEqual(self.rightAssistiveLabelText,
+                                            inputs.rightAssistiveLabelText) &&
+         MDCBaseTextFieldLayoutObjectsEqual(self.leftAssistiveLabelFont,
+                                            inputs.leftAssistiveLabelFont) &&
+         MDCBaseTextFieldLayoutObjectsEqual(self.rightAssistiveLabelFont,
+                                            inputs.rightAssistiveLabelFont);
+}
+
+@end
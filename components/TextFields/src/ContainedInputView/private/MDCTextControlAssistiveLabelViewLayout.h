@@ -41,4 +41,27 @@
          paddingBelowAssistiveLabels:(CGFloat)paddingBelowAssistiveLabels
                                isRTL:(BOOL)isRTL;
 
+/**
+ Calculates the same layout as @c -initWithWidth:leftAssistiveLabel:..., from the assistive labels'
+ contents instead of the labels themselves. It does not touch any views, so it can be called on any
+ thread.
+
+ Pass nil text for an assistive label that is hidden. The font is applied to ranges of the text
+ that have no font attribute, and is used to determine the line height, as UILabel does.
+ */
+- (instancetype)initWithWidth:(CGFloat)superviewWidth
+              leftAssistiveLabelText:(NSAttributedString *)leftAssistiveLabelText
+              leftAssistiveLabelFont:(UIFont *)leftAssistiveLabelFont
+     leftAssistiveLabelNumberOfLines:(NSInteger)leftAssistiveLabelNumberOfLines
+             rightAssistiveLabelText:(NSAttributedString *)rightAssistiveLabelText
+             rightAssistiveLabelFont:(UIFont *)rightAssistiveLabelFont
+    rightAssistiveLabelNumberOfLines:(NSInteger)rightAssistiveLabelNumberOfLines
+          assistiveLabelDrawPriority:
+              (MDCTextControlAssistiveLabelDrawPriority)assistiveLabelDrawPriority
+    customAssistiveLabelDrawPriority:(CGFloat)customAssistiveLabelDrawPriority
+                   horizontalPadding:(CGFloat)horizontalPadding
+         paddingAboveAssistiveLabels:(CGFloat)paddingAboveAssistiveLabels
+         paddingBelowAssistiveLabels:(CGFloat)paddingBelowAssistiveLabels
+                               isRTL:(BOOL)isRTL;
+
 @end
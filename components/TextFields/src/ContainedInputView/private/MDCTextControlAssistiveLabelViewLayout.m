@@ -14,6 +14,32 @@
 
 #import "MDCTextControlAssistiveLabelViewLayout.h"
 
+#import "MaterialMath.h"
+
+/** Returns the size of an assistive label constrained to @c maxWidth. */
+typedef CGSize (^MDCTextControlAssistiveLabelSizer)(CGFloat maxWidth);
+
+/**
+ Returns @c text with @c font applied to every range without a font attribute, the way UILabel
+ displays attributed text.
+ */
+static NSAttributedString *MDCTextControlAttributedTextWithBaseFont(NSAttributedString *text,
+                                                                    UIFont *font) {
+  if (!font) {
+    return text;
+  }
+  NSMutableAttributedString *result = [text mutableCopy];
+  [text enumerateAttribute:NSFontAttributeName
+                   inRange:NSMakeRange(0, text.length)
+                   options:0
+                usingBlock:^(id value, NSRange range, __unused BOOL *stop) {
+                  if (!value) {
+                    [result addAttribute:NSFontAttributeName value:font range:range];
+                  }
+                }];
+  return result;
+}
+
 @interface MDCTextControlAssistiveLabelViewLayout ()
 
 @property(nonatomic, assign) CGRect leftAssistiveLabelFrame;
@@ -38,9 +64,17 @@
                                isRTL:(BOOL)isRTL {
   self = [super init];
   if (self) {
+    MDCTextControlAssistiveLabelSizer leftAssistiveLabelSizer = ^CGSize(CGFloat maxWidth) {
+      return [self assistiveLabelSizeWithLabel:leftAssistiveLabel constrainedToWidth:maxWidth];
+    };
+    MDCTextControlAssistiveLabelSizer rightAssistiveLabelSizer = ^CGSize(CGFloat maxWidth) {
+      return [self assistiveLabelSizeWithLabel:rightAssistiveLabel constrainedToWidth:maxWidth];
+    };
     [self calculateLayoutWithSuperviewWidth:superviewWidth
-                         leftAssistiveLabel:leftAssistiveLabel
-                        rightAssistiveLabel:rightAssistiveLabel
+                    leftAssistiveLabelSizer:leftAssistiveLabelSizer
+               leftAssistiveLabelLineHeight:leftAssistiveLabel.font.lineHeight
+                   rightAssistiveLabelSizer:rightAssistiveLabelSizer
+              rightAssistiveLabelLineHeight:rightAssistiveLabel.font.lineHeight
                  assistiveLabelDrawPriority:assistiveLabelDrawPriority
            customAssistiveLabelDrawPriority:customAssistiveLabelDrawPriority
                           horizontalPadding:horizontalPadding
@@ -52,11 +86,56 @@
   return nil;
 }
 
+- (instancetype)initWithWidth:(CGFloat)superviewWidth
+              leftAssistiveLabelText:(NSAttributedString *)leftAssistiveLabelText
+              leftAssistiveLabelFont:(UIFont *)leftAssistiveLabelFont
+     leftAssistiveLabelNumberOfLines:(NSInteger)leftAssistiveLabelNumberOfLines
+             rightAssistiveLabelText:(NSAttributedString *)rightAssistiveLabelText
+             rightAssistiveLabelFont:(UIFont *)rightAssistiveLabelFont
+    rightAssistiveLabelNumberOfLines:(NSInteger)rightAssistiveLabelNumberOfLines
+          assistiveLabelDrawPriority:
+              (MDCTextControlAssistiveLabelDrawPriority)assistiveLabelDrawPriority
+    customAssistiveLabelDrawPriority:(CGFloat)customAssistiveLabelDrawPriority
+                   horizontalPadding:(CGFloat)horizontalPadding
+         paddingAboveAssistiveLabels:(CGFloat)paddingAboveAssistiveLabels
+         paddingBelowAssistiveLabels:(CGFloat)paddingBelowAssistiveLabels
+                               isRTL:(BOOL)isRTL {
+  self = [super init];
+  if (self) {
+    MDCTextControlAssistiveLabelSizer leftAssistiveLabelSizer = ^CGSize(CGFloat maxWidth) {
+      return [self assistiveLabelSizeWithText:leftAssistiveLabelText
+                                         font:leftAssistiveLabelFont
+                                numberOfLines:leftAssistiveLabelNumberOfLines
+                           constrainedToWidth:maxWidth];
+    };
+    MDCTextControlAssistiveLabelSizer rightAssistiveLabelSizer = ^CGSize(CGFloat maxWidth) {
+      return [self assistiveLabelSizeWithText:rightAssistiveLabelText
+                                         font:rightAssistiveLabelFont
+                                numberOfLines:rightAssistiveLabelNumberOfLines
+                           constrainedToWidth:maxWidth];
+    };
+    [self calculateLayoutWithSuperviewWidth:superviewWidth
+                    leftAssistiveLabelSizer:leftAssistiveLabelSizer
+               leftAssistiveLabelLineHeight:leftAssistiveLabelFont.lineHeight
+                   rightAssistiveLabelSizer:rightAssistiveLabelSizer
+              rightAssistiveLabelLineHeight:rightAssistiveLabelFont.lineHeight
+                 assistiveLabelDrawPriority:assistiveLabelDrawPriority
+           customAssistiveLabelDrawPriority:customAssistiveLabelDrawPriority
+                          horizontalPadding:horizontalPadding
+                paddingAboveAssistiveLabels:paddingAboveAssistiveLabels
+                paddingBelowAssistiveLabels:paddingBelowAssistiveLabels
+                                      isRTL:isRTL];
+  }
+  return self;
+}
+
 #pragma mark Layout Calculation
 
 - (void)calculateLayoutWithSuperviewWidth:(CGFloat)superviewWidth
-                       leftAssistiveLabel:(UILabel *)leftAssistiveLabel
-                      rightAssistiveLabel:(UILabel *)rightAssistiveLabel
+                  leftAssistiveLabelSizer:(MDCTextControlAssistiveLabelSizer)leftSizer
+             leftAssistiveLabelLineHeight:(CGFloat)leftAssistiveLabelLineHeight
+                 rightAssistiveLabelSizer:(MDCTextControlAssistiveLabelSizer)rightSizer
+            rightAssistiveLabelLineHeight:(CGFloat)rightAssistiveLabelLineHeight
                assistiveLabelDrawPriority:
                    (MDCTextControlAssistiveLabelDrawPriority)assistiveLabelDrawPriority
          customAssistiveLabelDrawPriority:(CGFloat)customAssistiveLabelDrawPriority
@@ -74,8 +153,12 @@
   CGFloat trailingAssistiveLabelWidth = 0;
   CGSize leadingAssistiveLabelSize = CGSizeZero;
   CGSize trailingAssistiveLabelSize = CGSizeZero;
-  UILabel *leadingAssistiveLabel = isRTL ? rightAssistiveLabel : leftAssistiveLabel;
-  UILabel *trailingAssistiveLabel = isRTL ? leftAssistiveLabel : rightAssistiveLabel;
+  MDCTextControlAssistiveLabelSizer leadingAssistiveLabelSizer = isRTL ? rightSizer : leftSizer;
+  MDCTextControlAssistiveLabelSizer trailingAssistiveLabelSizer = isRTL ? leftSizer : rightSizer;
+  CGFloat leadingAssistiveLabelLineHeight =
+      isRTL ? rightAssistiveLabelLineHeight : leftAssistiveLabelLineHeight;
+  CGFloat trailingAssistiveLabelLineHeight =
+      isRTL ? leftAssistiveLabelLineHeight : rightAssistiveLabelLineHeight;
   switch (assistiveLabelDrawPriority) {
     case MDCTextControlAssistiveLabelDrawPriorityCustom:
       leadingAssistiveLabelWidth = [self
@@ -83,37 +166,29 @@
                                                   customDrawPriority:
                                                       customAssistiveLabelDrawPriority];
       trailingAssistiveLabelWidth = assistiveLabelsCombinedMaxWidth - leadingAssistiveLabelWidth;
-      leadingAssistiveLabelSize = [self assistiveLabelSizeWithLabel:leadingAssistiveLabel
-                                                 constrainedToWidth:leadingAssistiveLabelWidth];
-      trailingAssistiveLabelSize = [self assistiveLabelSizeWithLabel:trailingAssistiveLabel
-                                                  constrainedToWidth:trailingAssistiveLabelWidth];
+      leadingAssistiveLabelSize = leadingAssistiveLabelSizer(leadingAssistiveLabelWidth);
+      trailingAssistiveLabelSize = trailingAssistiveLabelSizer(trailingAssistiveLabelWidth);
       break;
     case MDCTextControlAssistiveLabelDrawPriorityLeading:
-      leadingAssistiveLabelSize =
-          [self assistiveLabelSizeWithLabel:leadingAssistiveLabel
-                         constrainedToWidth:assistiveLabelsCombinedMaxWidth];
-      if ([self isLabelMultilineWithLabel:leadingAssistiveLabel size:leadingAssistiveLabelSize]) {
+      leadingAssistiveLabelSize = leadingAssistiveLabelSizer(assistiveLabelsCombinedMaxWidth);
+      if ([self isLabelMultilineWithLineHeight:leadingAssistiveLabelLineHeight
+                                          size:leadingAssistiveLabelSize]) {
         trailingAssistiveLabelSize = CGSizeZero;
       } else {
-        trailingAssistiveLabelSize =
-            [self assistiveLabelSizeWithLabel:trailingAssistiveLabel
-                           constrainedToWidth:assistiveLabelsCombinedMaxWidth -
-                                              leadingAssistiveLabelSize.width];
+        trailingAssistiveLabelSize = trailingAssistiveLabelSizer(assistiveLabelsCombinedMaxWidth -
+                                                                 leadingAssistiveLabelSize.width);
       }
       break;
     case MDCTextControlAssistiveLabelDrawPriorityTrailing:
       // Pass through (.trailing is the default priority)
     default:
-      trailingAssistiveLabelSize =
-          [self assistiveLabelSizeWithLabel:trailingAssistiveLabel
-                         constrainedToWidth:assistiveLabelsCombinedMaxWidth];
-      if ([self isLabelMultilineWithLabel:trailingAssistiveLabel size:trailingAssistiveLabelSize]) {
+      trailingAssistiveLabelSize = trailingAssistiveLabelSizer(assistiveLabelsCombinedMaxWidth);
+      if ([self isLabelMultilineWithLineHeight:trailingAssistiveLabelLineHeight
+                                          size:trailingAssistiveLabelSize]) {
         leadingAssistiveLabelSize = CGSizeZero;
       } else {
-        leadingAssistiveLabelSize =
-            [self assistiveLabelSizeWithLabel:leadingAssistiveLabel
-                           constrainedToWidth:assistiveLabelsCombinedMaxWidth -
-                                              trailingAssistiveLabelSize.width];
+        leadingAssistiveLabelSize = leadingAssistiveLabelSizer(assistiveLabelsCombinedMaxWidth -
+                                                               trailingAssistiveLabelSize.width);
       }
       break;
   }
@@ -161,14 +236,39 @@
   return size;
 }
 
+/**
+ Measures assistive label text the way UILabel's @c -sizeThatFits: does, without a UILabel, so that
+ it can be used off the main thread.
+ */
+- (CGSize)assistiveLabelSizeWithText:(NSAttributedString *)text
+                                font:(UIFont *)font
+                       numberOfLines:(NSInteger)numberOfLines
+                  constrainedToWidth:(CGFloat)maxWidth {
+  if (maxWidth <= 0 || text.length <= 0) {
+    return CGSizeZero;
+  }
+  CGSize fittingSize = CGSizeMake(maxWidth, CGFLOAT_MAX);
+  CGRect rect = [MDCTextControlAttributedTextWithBaseFont(text, font)
+      boundingRectWithSize:fittingSize
+                   options:NSStringDrawingUsesLineFragmentOrigin
+                   context:nil];
+  CGSize size = CGSizeMake(MDCCeil(CGRectGetWidth(rect)), MDCCeil(CGRectGetHeight(rect)));
+  if (numberOfLines > 0) {
+    size.height = MIN(size.height, MDCCeil(numberOfLines * font.lineHeight));
+  }
+  if (size.width > maxWidth) {
+    size.width = maxWidth;
+  }
+  return size;
+}
+
 - (CGFloat)leadingAssistiveLabelWidthWithCombinedAssistiveLabelsWidth:
                (CGFloat)totalAssistiveLabelsWidth
                                                    customDrawPriority:(CGFloat)customDrawPriority {
   return customDrawPriority * totalAssistiveLabelsWidth;
 }
 
-- (BOOL)isLabelMultilineWithLabel:(UILabel *)label size:(CGSize)size {
-  CGFloat lineHeight = label.font.lineHeight;
+- (BOOL)isLabelMultilineWithLineHeight:(CGFloat)lineHeight size:(CGSize)size {
   return round((double)(size.height / lineHeight)) > 1;
 }
 
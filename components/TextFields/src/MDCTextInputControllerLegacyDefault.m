@@ -18,6 +18,8 @@
 #import "MDCTextInputUnderlineView.h"
 #import "private/MDCTextInputArt.h"
 
+#import "MaterialColor.h"
+#import "MaterialGlyphCache.h"
 #import "MaterialTypography.h"
 
 #pragma mark - Constants
@@ -77,16 +79,20 @@ static CGFloat _underlineHeightNormalLegacyDefault =
                  MDCTextInputControllerLegacyDefaultClearButtonImageSquareWidthHeight);
 
   CGFloat scale = [UIScreen mainScreen].scale;
-  CGRect bounds = CGRectMake(0, 0, clearButtonSize.width * scale, clearButtonSize.height * scale);
-  UIGraphicsBeginImageContextWithOptions(bounds.size, false, scale);
-  [color setFill];
-
-  [MDCPathForClearButtonLegacyImageFrame(bounds) fill];
-  UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
-  UIGraphicsEndImageContext();
-
-  image = [image imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
-  return image;
+  CGSize imageSize = CGSizeMake(clearButtonSize.width * scale, clearButtonSize.height * scale);
+  // The fill color's opacity survives in the template image, so it is part of the glyph's name.
+  UITraitCollection *traitCollection =
+      self.textInput.traitCollection ?: [UIScreen mainScreen].traitCollection;
+  UIColor *resolvedColor = [color mdc_resolvedColorWithTraitCollection:traitCollection];
+  NSString *glyphName = MDCClearButtonLegacyGlyphNameForColor(resolvedColor);
+  MDCGlyphDrawingBlock drawingBlock = ^(CGRect bounds) {
+    [resolvedColor setFill];
+    [MDCPathForClearButtonLegacyImageFrame(bounds) fill];
+  };
+  return [[MDCGlyphCache sharedCache] templateImageForGlyphNamed:glyphName
+                                                            size:imageSize
+                                                           scale:scale
+                                                    drawingBlock:drawingBlock];
 }
 
 #pragma mark - Properties Implementation
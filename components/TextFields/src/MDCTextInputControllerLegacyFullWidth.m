@@ -23,6 +23,8 @@
 #import "private/MDCTextInputArt.h"
 
 #import "MaterialAnimationTiming.h"
+#import "MaterialColor.h"
+#import "MaterialGlyphCache.h"
 #import "MaterialMath.h"
 #import "MaterialPalettes.h"
 #import "MaterialTypography.h"
@@ -57,16 +59,20 @@ static const CGFloat MDCTextInputControllerLegacyFullWidthClearButtonImageSquare
                  MDCTextInputControllerLegacyFullWidthClearButtonImageSquareWidthHeight);
 
   CGFloat scale = [UIScreen mainScreen].scale;
-  CGRect bounds = CGRectMake(0, 0, clearButtonSize.width * scale, clearButtonSize.height * scale);
-  UIGraphicsBeginImageContextWithOptions(bounds.size, false, scale);
-  [color setFill];
-
-  [MDCPathForClearButtonLegacyImageFrame(bounds) fill];
-  UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
-  UIGraphicsEndImageContext();
-
-  image = [image imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
-  return image;
+  CGSize imageSize = CGSizeMake(clearButtonSize.width * scale, clearButtonSize.height * scale);
+  // The fill color's opacity survives in the template image, so it is part of the glyph's name.
+  UITraitCollection *traitCollection =
+      self.textInput.traitCollection ?: [UIScreen mainScreen].traitCollection;
+  UIColor *resolvedColor = [color mdc_resolvedColorWithTraitCollection:traitCollection];
+  NSString *glyphName = MDCClearButtonLegacyGlyphNameForColor(resolvedColor);
+  MDCGlyphDrawingBlock drawingBlock = ^(CGRect bounds) {
+    [resolvedColor setFill];
+    [MDCPathForClearButtonLegacyImageFrame(bounds) fill];
+  };
+  return [[MDCGlyphCache sharedCache] templateImageForGlyphNamed:glyphName
+                                                            size:imageSize
+                                                           scale:scale
+                                                    drawingBlock:drawingBlock];
 }
 
 @end
@@ -130,6 +130,22 @@ static inline UIBezierPath *MDCPathForClearButtonImageFrame(CGRect frame) {
   return ic_clear_path;
 }
 
+/**
+ Returns the glyph cache name of the legacy clear button image filled with @c color, which should
+ already be resolved for the current traits.
+
+ The name is made of the color's RGBA components, so equal colors share one image and colors that
+ differ never do. Colors without RGBA components, e.g. pattern colors, fall back to their hash.
+ */
+static inline NSString *MDCClearButtonLegacyGlyphNameForColor(UIColor *color) {
+  CGFloat red = 0, green = 0, blue = 0, alpha = 0;
+  if ([color getRed:&red green:&green blue:&blue alpha:&alpha]) {
+    return [NSString stringWithFormat:@"ic_clear_legacy-%a-%a-%a-%a", (double)red, (double)green,
+                                      (double)blue, (double)alpha];
+  }
+  return [NSString stringWithFormat:@"ic_clear_legacy-hash-%lu", (unsigned long)color.hash];
+}
+
 static inline UIBezierPath *MDCPathForClearButtonLegacyImageFrame(CGRect frame) {
   // GENERATED CODE
 
@@ -25,6 +25,7 @@
 #import "MDCTextInputUnderlineView.h"
 
 #import "MaterialAnimationTiming.h"
+#import "MaterialGlyphCache.h"
 #import "MaterialMath.h"
 #import "MaterialPalettes.h"
 #import "MaterialTypography.h"
@@ -590,16 +591,14 @@ static inline UIColor *MDCTextInputUnderlineColor() {
   CGSize clearButtonSize = CGSizeMake(MDCTextInputClearButtonImageSquareWidthHeight,
                                       MDCTextInputClearButtonImageSquareWidthHeight);
 
-  CGRect bounds = CGRectMake(0, 0, clearButtonSize.width, clearButtonSize.height);
-  UIGraphicsBeginImageContextWithOptions(bounds.size, false, 0);
-  [UIColor.grayColor setFill];
-
-  [MDCPathForClearButtonImageFrame(bounds) fill];
-  UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
-  UIGraphicsEndImageContext();
-
-  image = [image imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
-  return image;
+  MDCGlyphDrawingBlock drawingBlock = ^(CGRect bounds) {
+    [UIColor.grayColor setFill];
+    [MDCPathForClearButtonImageFrame(bounds) fill];
+  };
+  return [[MDCGlyphCache sharedCache] templateImageForGlyphNamed:@"ic_clear"
+                                                            size:clearButtonSize
+                                                           scale:0
+                                                    drawingBlock:drawingBlock];
 }
 
 - (void)clearButtonDidTouch {
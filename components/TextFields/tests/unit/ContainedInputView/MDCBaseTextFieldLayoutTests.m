@@ -15,6 +15,7 @@
 #import <XCTest/XCTest.h>
 
 #import "../../../src/ContainedInputView/private/MDCBaseTextFieldLayout.h"
+#import "../../../src/ContainedInputView/private/MDCBaseTextFieldLayoutInputs.h"
 #import "../../../src/ContainedInputView/private/MDCTextControlAssistiveLabelView.h"
 #import "../../../src/ContainedInputView/private/MDCTextControlVerticalPositioningReferenceBase.h"
 #import "MaterialTextFields+ContainedInputView.h"
@@ -68,6 +69,69 @@
   return layout;
 }
 
+- (MDCBaseTextFieldLayoutInputs *)
+    createInputsWithLeftAssistiveLabel:(UILabel *)leftAssistiveLabel
+                   rightAssistiveLabel:(UILabel *)rightAssistiveLabel
+            assistiveLabelDrawPriority:
+                (MDCTextControlAssistiveLabelDrawPriority)assistiveLabelDrawPriority
+                                 isRTL:(BOOL)isRTL {
+  UIFont *font = [UIFont systemFontOfSize:[UIFont systemFontSize]];
+  UILabel *label = [[UILabel alloc] init];
+  label.text = @"Label";
+  return [[MDCBaseTextFieldLayoutInputs alloc]
+                 initWithTextFieldSize:CGSizeMake(200, 60)
+                  positioningReference:[[MDCTextControlVerticalPositioningReferenceBase alloc] init]
+                                  text:@"Text"
+                                  font:font
+                          floatingFont:[font fontWithSize:(font.pointSize * (CGFloat)0.5)]
+                                 label:label
+                              leftView:[self createSideView]
+                          leftViewMode:UITextFieldViewModeAlways
+                             rightView:nil
+                         rightViewMode:UITextFieldViewModeNever
+                 clearButtonSideLength:19
+                       clearButtonMode:UITextFieldViewModeAlways
+                    leftAssistiveLabel:leftAssistiveLabel
+                   rightAssistiveLabel:rightAssistiveLabel
+            assistiveLabelDrawPriority:assistiveLabelDrawPriority
+      customAssistiveLabelDrawPriority:(CGFloat)0.6
+                                 isRTL:isRTL
+                             isEditing:YES];
+}
+
+- (void)assertLayout:(MDCBaseTextFieldLayout *)layout
+    matchesViewMeasuredLayout:(MDCBaseTextFieldLayout *)viewMeasuredLayout {
+  XCTAssertTrue(CGRectEqualToRect(layout.textRectNormal, viewMeasuredLayout.textRectNormal));
+  XCTAssertTrue(CGRectEqualToRect(layout.textRectFloating, viewMeasuredLayout.textRectFloating));
+  XCTAssertTrue(CGRectEqualToRect(layout.labelFrameNormal, viewMeasuredLayout.labelFrameNormal));
+  XCTAssertTrue(
+      CGRectEqualToRect(layout.labelFrameFloating, viewMeasuredLayout.labelFrameFloating));
+  XCTAssertTrue(CGRectEqualToRect(layout.leftViewFrame, viewMeasuredLayout.leftViewFrame));
+  XCTAssertTrue(CGRectEqualToRect(layout.rightViewFrame, viewMeasuredLayout.rightViewFrame));
+  XCTAssertTrue(
+      CGRectEqualToRect(layout.clearButtonFrameNormal, viewMeasuredLayout.clearButtonFrameNormal));
+  XCTAssertEqual(layout.leftViewHidden, viewMeasuredLayout.leftViewHidden);
+  XCTAssertEqual(layout.rightViewHidden, viewMeasuredLayout.rightViewHidden);
+
+  // TextKit and UILabel may round the assistive labels' text differently by a fraction of a point.
+  MDCTextControlAssistiveLabelViewLayout *assistiveLayout = layout.assistiveLabelViewLayout;
+  MDCTextControlAssistiveLabelViewLayout *viewMeasuredAssistiveLayout =
+      viewMeasuredLayout.assistiveLabelViewLayout;
+  CGRect frames[] = {assistiveLayout.leftAssistiveLabelFrame,
+                     assistiveLayout.rightAssistiveLabelFrame};
+  CGRect viewMeasuredFrames[] = {viewMeasuredAssistiveLayout.leftAssistiveLabelFrame,
+                                 viewMeasuredAssistiveLayout.rightAssistiveLabelFrame};
+  for (NSUInteger i = 0; i < 2; ++i) {
+    XCTAssertEqualWithAccuracy(CGRectGetMinX(frames[i]), CGRectGetMinX(viewMeasuredFrames[i]), 1);
+    XCTAssertEqualWithAccuracy(CGRectGetMinY(frames[i]), CGRectGetMinY(viewMeasuredFrames[i]), 1);
+    XCTAssertEqualWithAccuracy(CGRectGetWidth(frames[i]), CGRectGetWidth(viewMeasuredFrames[i]),
+                               1);
+    XCTAssertEqualWithAccuracy(CGRectGetHeight(frames[i]), CGRectGetHeight(viewMeasuredFrames[i]),
+                               1);
+  }
+  XCTAssertEqualWithAccuracy(layout.calculatedHeight, viewMeasuredLayout.calculatedHeight, 1);
+}
+
 #pragma mark Tests
 
 - (void)testTextHeightWithFont {
@@ -139,4 +203,167 @@
   XCTAssertTrue(editingLayout.rightViewHidden);
 }
 
+- (void)testValueLayoutMatchesViewMeasuredLayout {
+  MDCTextControlAssistiveLabelDrawPriority drawPriorities[] = {
+      MDCTextControlAssistiveLabelDrawPriorityTrailing,
+      MDCTextControlAssistiveLabelDrawPriorityLeading,
+      MDCTextControlAssistiveLabelDrawPriorityCustom,
+  };
+  NSArray<NSString *> *texts = @[
+    @"",
+    @"Helper text",
+    @"A long error message that wraps onto several lines below a two hundred point text field",
+  ];
+  for (NSUInteger priorityIndex = 0; priorityIndex < 3; ++priorityIndex) {
+    for (NSString *leftText in texts) {
+      for (NSString *rightText in texts) {
+        for (NSNumber *isRTL in @[ @NO, @YES ]) {
+          // Given
+          MDCTextControlAssistiveLabelView *assistiveLabelView =
+              [[MDCTextControlAssistiveLabelView alloc] init];
+          assistiveLabelView.leftAssistiveLabel.text = leftText;
+          assistiveLabelView.rightAssistiveLabel.text = rightText;
+          MDCBaseTextFieldLayoutInputs *inputs =
+              [self createInputsWithLeftAssistiveLabel:assistiveLabelView.leftAssistiveLabel
+                                   rightAssistiveLabel:assistiveLabelView.rightAssistiveLabel
+                            assistiveLabelDrawPriority:drawPriorities[priorityIndex]
+                                                 isRTL:isRTL.boolValue];
+
+          // When
+          MDCBaseTextFieldLayout *viewMeasuredLayout = [[MDCBaseTextFieldLayout alloc]
+                   initWithInputs:inputs
+               leftAssistiveLabel:assistiveLabelView.leftAssistiveLabel
+              rightAssistiveLabel:assistiveLabelView.rightAssistiveLabel];
+          MDCBaseTextFieldLayout *layout = [[MDCBaseTextFieldLayout alloc] initWithInputs:inputs];
+
+          // Then
+          [self assertLayout:layout matchesViewMeasuredLayout:viewMeasuredLayout];
+        }
+      }
+    }
+  }
+}
+
+- (void)testHiddenAssistiveLabelsTakeNoSpace {
+  // Given
+  MDCTextControlAssistiveLabelView *assistiveLabelView =
+      [[MDCTextControlAssistiveLabelView alloc] init];
+  assistiveLabelView.leftAssistiveLabel.text = @"Helper text";
+  assistiveLabelView.leftAssistiveLabel.hidden = YES;
+  MDCBaseTextFieldLayoutInputs *inputs =
+      [self createInputsWithLeftAssistiveLabel:assistiveLabelView.leftAssistiveLabel
+                           rightAssistiveLabel:assistiveLabelView.rightAssistiveLabel
+                    assistiveLabelDrawPriority:MDCTextControlAssistiveLabelDrawPriorityTrailing
+                                         isRTL:NO];
+
+  // When
+  MDCBaseTextFieldLayout *layout = [[MDCBaseTextFieldLayout alloc] initWithInputs:inputs];
+
+  // Then
+  XCTAssertNil(inputs.leftAssistiveLabelText);
+  XCTAssertTrue(CGRectIsEmpty(layout.assistiveLabelViewLayout.leftAssistiveLabelFrame));
+}
+
+- (void)testInputsCapturedFromEqualViewsAreEqualAndHashEqually {
+  // Given
+  MDCTextControlAssistiveLabelView *assistiveLabelView =
+      [[MDCTextControlAssistiveLabelView alloc] init];
+  assistiveLabelView.leftAssistiveLabel.text = @"Helper text";
+
+  // When
+  MDCBaseTextFieldLayoutInputs *inputs =
+      [self createInputsWithLeftAssistiveLabel:assistiveLabelView.leftAssistiveLabel
+                           rightAssistiveLabel:assistiveLabelView.rightAssistiveLabel
+                    assistiveLabelDrawPriority:MDCTextControlAssistiveLabelDrawPriorityTrailing
+                                         isRTL:NO];
+  MDCBaseTextFieldLayoutInputs *otherInputs =
+      [self createInputsWithLeftAssistiveLabel:assistiveLabelView.leftAssistiveLabel
+                           rightAssistiveLabel:assistiveLabelView.rightAssistiveLabel
+                    assistiveLabelDrawPriority:MDCTextControlAssistiveLabelDrawPriorityTrailing
+                                         isRTL:NO];
+
+  // Then
+  XCTAssertEqualObjects(inputs, otherInputs);
+  XCTAssertEqual(inputs.hash, otherInputs.hash);
+}
+
+- (void)testInputsDifferWhenOnlyAnAssistiveLabelsFontOrVisibilityChanges {
+  // Given
+  MDCTextControlAssistiveLabelView *assistiveLabelView =
+      [[MDCTextControlAssistiveLabelView alloc] init];
+  assistiveLabelView.leftAssistiveLabel.text = @"Helper text";
+  MDCBaseTextFieldLayoutInputs *inputs =
+      [self createInputsWithLeftAssistiveLabel:assistiveLabelView.leftAssistiveLabel
+                           rightAssistiveLabel:assistiveLabelView.rightAssistiveLabel
+                    assistiveLabelDrawPriority:MDCTextControlAssistiveLabelDrawPriorityTrailing
+                                         isRTL:NO];
+
+  // When
+  assistiveLabelView.leftAssistiveLabel.font = [UIFont systemFontOfSize:30];
+  MDCBaseTextFieldLayoutInputs *refontedInputs =
+      [self createInputsWithLeftAssistiveLabel:assistiveLabelView.leftAssistiveLabel
+                           rightAssistiveLabel:assistiveLabelView.rightAssistiveLabel
+                    assistiveLabelDrawPriority:MDCTextControlAssistiveLabelDrawPriorityTrailing
+                                         isRTL:NO];
+  assistiveLabelView.leftAssistiveLabel.hidden = YES;
+  MDCBaseTextFieldLayoutInputs *hiddenInputs =
+      [self createInputsWithLeftAssistiveLabel:assistiveLabelView.leftAssistiveLabel
+                           rightAssistiveLabel:assistiveLabelView.rightAssistiveLabel
+                    assistiveLabelDrawPriority:MDCTextControlAssistiveLabelDrawPriorityTrailing
+                                         isRTL:NO];
+
+  // Then
+  XCTAssertNotEqualObjects(inputs, refontedInputs);
+  XCTAssertNotEqualObjects(refontedInputs, hiddenInputs);
+}
+
+- (void)testValueLayoutCanBeCalculatedOffTheMainThread {
+  // Given
+  UIFont *font = [UIFont systemFontOfSize:[UIFont systemFontSize]];
+  NSAttributedString *helperText = [[NSAttributedString alloc] initWithString:@"Helper text"];
+  MDCBaseTextFieldLayout *mainThreadLayout;
+  __block MDCBaseTextFieldLayout *backgroundLayout;
+  MDCBaseTextFieldLayoutInputs * (^createInputs)(void) = ^{
+    return [[MDCBaseTextFieldLayoutInputs alloc]
+                   initWithTextFieldSize:CGSizeMake(200, 60)
+                    positioningReference:[[MDCTextControlVerticalPositioningReferenceBase alloc]
+                                             init]
+                                    text:@"Text"
+                                    font:font
+                            floatingFont:font
+                               labelText:@"Label"
+                            leftViewSize:CGSizeMake(20, 20)
+                            leftViewMode:UITextFieldViewModeAlways
+                           rightViewSize:CGSizeZero
+                           rightViewMode:UITextFieldViewModeNever
+                   clearButtonSideLength:19
+                         clearButtonMode:UITextFieldViewModeWhileEditing
+                  leftAssistiveLabelText:helperText
+                  leftAssistiveLabelFont:font
+         leftAssistiveLabelNumberOfLines:0
+                 rightAssistiveLabelText:nil
+                 rightAssistiveLabelFont:font
+        rightAssistiveLabelNumberOfLines:0
+              assistiveLabelDrawPriority:MDCTextControlAssistiveLabelDrawPriorityTrailing
+        customAssistiveLabelDrawPriority:0
+                                   isRTL:NO
+                               isEditing:YES];
+  };
+  mainThreadLayout = [[MDCBaseTextFieldLayout alloc] initWithInputs:createInputs()];
+  XCTestExpectation *expectation = [self expectationWithDescription:@"calculated"];
+
+  // When
+  dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+    backgroundLayout = [[MDCBaseTextFieldLayout alloc] initWithInputs:createInputs()];
+    [expectation fulfill];
+  });
+  [self waitForExpectations:@[ expectation ] timeout:3];
+
+  // Then
+  XCTAssertEqual(backgroundLayout.calculatedHeight, mainThreadLayout.calculatedHeight);
+  XCTAssertGreaterThan(backgroundLayout.calculatedHeight, backgroundLayout.containerHeight);
+  XCTAssertTrue(CGRectEqualToRect(backgroundLayout.textRectFloating,
+                                  mainThreadLayout.textRectFloating));
+}
+
 @end
@@ -17,10 +17,16 @@
 #import <objc/runtime.h>
 #import "MaterialTextFields+ContainedInputView.h"
 
+#import "../../../src/ContainedInputView/private/MDCBaseTextFieldLayout.h"
 #import "../../../src/ContainedInputView/private/MDCTextControlLabelState.h"
 
+static const NSUInteger kFormFieldCount = 30;
+static const NSUInteger kTypedCharacterCount = 1000;
+
 @interface MDCBaseTextField (Private)
 @property(nonatomic, assign) UIUserInterfaceLayoutDirection layoutDirection;
+@property(strong, nonatomic) MDCBaseTextFieldLayout *layout;
+- (MDCBaseTextFieldLayout *)calculateLayoutWithTextFieldSize:(CGSize)textFieldSize;
 - (CGRect)adjustTextAreaFrame:(CGRect)textRect
     withParentClassTextAreaFrame:(CGRect)parentClassTextAreaFrame;
 - (BOOL)shouldPlaceholderBeVisibleWithPlaceholder:(NSString *)placeholder
@@ -339,4 +345,114 @@
                                      labelState:MDCTextControlLabelStateFloating]);
 }
 
+- (void)testLayoutIsReusedWhenTypingDoesNotChangeGeometry {
+  // Given
+  MDCBaseTextField *textField = [[MDCBaseTextField alloc] initWithFrame:CGRectMake(0, 0, 200, 60)];
+  textField.label.text = @"Label";
+  textField.text = @"a";
+  [textField layoutIfNeeded];
+  MDCBaseTextFieldLayout *layout = textField.layout;
+
+  // When
+  textField.text = @"ab";
+  [textField setNeedsLayout];
+  [textField layoutIfNeeded];
+
+  // Then
+  XCTAssertNotNil(layout);
+  XCTAssertEqual(textField.layout, layout);
+}
+
+- (void)testLayoutIsRecalculatedWhenInputsChange {
+  // Given
+  MDCBaseTextField *textField = [[MDCBaseTextField alloc] initWithFrame:CGRectMake(0, 0, 200, 60)];
+  textField.label.text = @"Label";
+  [textField layoutIfNeeded];
+  MDCBaseTextFieldLayout *layout = textField.layout;
+
+  // When
+  textField.label.text = @"A much longer label";
+  [textField setNeedsLayout];
+  [textField layoutIfNeeded];
+  MDCBaseTextFieldLayout *relabeledLayout = textField.layout;
+  textField.leadingAssistiveLabel.text = @"Assistive text";
+  [textField setNeedsLayout];
+  [textField layoutIfNeeded];
+  MDCBaseTextFieldLayout *assistiveLayout = textField.layout;
+  textField.frame = CGRectMake(0, 0, 300, 60);
+  [textField layoutIfNeeded];
+
+  // Then
+  XCTAssertNotEqual(relabeledLayout, layout);
+  XCTAssertGreaterThan(CGRectGetWidth(relabeledLayout.labelFrameNormal),
+                       CGRectGetWidth(layout.labelFrameNormal));
+  XCTAssertNotEqual(assistiveLayout, relabeledLayout);
+  XCTAssertNotEqual(textField.layout, assistiveLayout);
+}
+
+- (void)testMemoizedLayoutMatchesFreshLayout {
+  // Given
+  MDCBaseTextField *textField = [[MDCBaseTextField alloc] initWithFrame:CGRectMake(0, 0, 200, 60)];
+  textField.label.text = @"Label";
+  textField.leadingView = [self createSideView];
+  textField.leadingViewMode = UITextFieldViewModeAlways;
+  textField.text = @"text";
+  [textField layoutIfNeeded];
+  CGSize fittingSize = CGSizeMake(200, CGFLOAT_MAX);
+  MDCBaseTextFieldLayout *memoizedLayout = [textField calculateLayoutWithTextFieldSize:fittingSize];
+
+  // When
+  MDCBaseTextField *freshTextField =
+      [[MDCBaseTextField alloc] initWithFrame:CGRectMake(0, 0, 200, 60)];
+  freshTextField.label.text = @"Label";
+  freshTextField.leadingView = [self createSideView];
+  freshTextField.leadingViewMode = UITextFieldViewModeAlways;
+  freshTextField.text = @"other text";
+  MDCBaseTextFieldLayout *freshLayout =
+      [freshTextField calculateLayoutWithTextFieldSize:fittingSize];
+
+  // Then
+  XCTAssertTrue(CGRectEqualToRect(memoizedLayout.labelFrameNormal, freshLayout.labelFrameNormal));
+  XCTAssertTrue(CGRectEqualToRect(memoizedLayout.textRectNormal, freshLayout.textRectNormal));
+  XCTAssertTrue(CGRectEqualToRect(memoizedLayout.leftViewFrame, freshLayout.leftViewFrame));
+  XCTAssertEqualWithAccuracy(memoizedLayout.calculatedHeight, freshLayout.calculatedHeight,
+                             0.001);
+}
+
+- (void)testTypingOneThousandCharactersIntoThirtyFieldForm {
+  // Given
+  UIView *form = [[UIView alloc] initWithFrame:CGRectMake(0, 0, 320, kFormFieldCount * 80)];
+  NSMutableArray<MDCBaseTextField *> *textFields = [NSMutableArray array];
+  for (NSUInteger i = 0; i < kFormFieldCount; ++i) {
+    MDCBaseTextField *textField =
+        [[MDCBaseTextField alloc] initWithFrame:CGRectMake(0, i * 80, 320, 60)];
+    textField.label.text = [NSString stringWithFormat:@"Field %lu", (unsigned long)i];
+    textField.leadingAssistiveLabel.text = @"Assistive text";
+    textField.clearButtonMode = UITextFieldViewModeWhileEditing;
+    [form addSubview:textField];
+    [textFields addObject:textField];
+  }
+  [form layoutIfNeeded];
+
+  [self measureBlock:^{
+    // When
+    for (MDCBaseTextField *textField in textFields) {
+      textField.text = nil;
+      [textField layoutIfNeeded];
+    }
+    for (NSUInteger i = 0; i < kTypedCharacterCount; ++i) {
+      MDCBaseTextField *textField = textFields[i % kFormFieldCount];
+      textField.text = [(textField.text ?: @"") stringByAppendingString:@"a"];
+      [textField setNeedsLayout];
+      [textField layoutIfNeeded];
+    }
+
+    // Then
+    for (MDCBaseTextField *textField in textFields) {
+      XCTAssertGreaterThan(textField.text.length, 0U);
+      XCTAssertNotNil(textField.layout);
+    }
+  }];
+}
+
 @end
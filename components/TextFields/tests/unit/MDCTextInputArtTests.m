@@ -0,0 +1,55 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#import <XCTest/XCTest.h>
+
+#import "../../src/private/MDCTextInputArt.h"
+
+/** Unit tests for the drawing helpers in MDCTextInputArt.h. */
+@interface MDCTextInputArtTests : XCTestCase
+@end
+
+@implementation MDCTextInputArtTests
+
+- (void)testClearButtonGlyphNamesOfEqualColorsAreEqual {
+  // Given
+  UIColor *grayColor = [UIColor colorWithWhite:0 alpha:(CGFloat)0.54];
+  UIColor *rgbColor = [UIColor colorWithRed:0 green:0 blue:0 alpha:(CGFloat)0.54];
+
+  // When
+  NSString *grayName = MDCClearButtonLegacyGlyphNameForColor(grayColor);
+  NSString *rgbName = MDCClearButtonLegacyGlyphNameForColor(rgbColor);
+
+  // Then
+  XCTAssertEqualObjects(grayName, rgbName);
+}
+
+- (void)testClearButtonGlyphNamesOfSlightlyDifferentColorsDiffer {
+  // Given
+  UIColor *color = [UIColor colorWithRed:(CGFloat)0.2 green:(CGFloat)0.4 blue:(CGFloat)0.6 alpha:1];
+  UIColor *otherColor = [UIColor colorWithRed:(CGFloat)0.2
+                                        green:(CGFloat)0.4
+                                         blue:(CGFloat)0.6
+                                        alpha:(CGFloat)0.999];
+
+  // When
+  NSString *name = MDCClearButtonLegacyGlyphNameForColor(color);
+  NSString *otherName = MDCClearButtonLegacyGlyphNameForColor(otherColor);
+
+  // Then
+  XCTAssertNotEqualObjects(name, otherName);
+}
+
+@end
@@ -0,0 +1,31 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#import <CoreFoundation/CoreFoundation.h>
+
+// Orders of the observers that Material components add to the main run loop. Lower orders run
+// earlier. All of them run before Core Animation commits the current transaction.
+
+/**
+ The order of the keyboard watcher's observer.
+
+ The keyboard watcher posts its coalesced keyboard notification from this observer. Observers of
+ that notification may move or present overlays, e.g. snackbars, so it has to run before the overlay
+ animation observer for those changes to be reported in the same run loop turn.
+ */
+static const CFIndex MDCKeyboardWatcherRunLoopObserverOrder = -1;
+
+/** The order of the overlay animation observer, which reports overlay frame changes. */
+static const CFIndex MDCOverlayAnimationRunLoopObserverOrder = 0;
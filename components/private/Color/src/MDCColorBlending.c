@@ -0,0 +1,36 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Plain C, also built on its own by the :color_blending_benchmark target.
+
+#include "MDCColorBlending.h"
+
+void MDCPremultipliedRGBABlendArrays(const MDCPremultipliedRGBA *colors,
+                                     const MDCPremultipliedRGBA *backgroundColors,
+                                     MDCPremultipliedRGBA *results,
+                                     size_t count) {
+  for (size_t index = 0; index < count; ++index) {
+    results[index] = MDCPremultipliedRGBABlend(colors[index], backgroundColors[index]);
+  }
+}
+
+void MDCPremultipliedRGBABlendArrayOverColor(const MDCPremultipliedRGBA *colors,
+                                             const MDCPremultipliedRGBA *backgroundColor,
+                                             MDCPremultipliedRGBA *results,
+                                             size_t count) {
+  MDCPremultipliedRGBA background = *backgroundColor;
+  for (size_t index = 0; index < count; ++index) {
+    results[index] = MDCPremultipliedRGBABlend(colors[index], background);
+  }
+}
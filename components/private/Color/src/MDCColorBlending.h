@@ -0,0 +1,112 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// This header and its implementation are plain C with no Apple frameworks, so the blending kernel
+// can be built and benchmarked on any platform with clang or GCC.
+
+#ifndef MDC_COLOR_BLENDING_H
+#define MDC_COLOR_BLENDING_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ A color as premultiplied red, green, blue and alpha components, each from 0 to 1.
+
+ Components are doubles so that blending matches the precision of @c CGFloat on 64-bit devices. It
+ is a plain struct, rather than a vector extension type, so that passing it by value has the same
+ ABI with every compiler and target.
+ */
+typedef struct {
+  double red;
+  double green;
+  double blue;
+  double alpha;
+} MDCPremultipliedRGBA;
+
+/** Returns the premultiplied form of a color given by its straight (unpremultiplied) components. */
+static inline MDCPremultipliedRGBA MDCPremultipliedRGBAMake(double red,
+                                                            double green,
+                                                            double blue,
+                                                            double alpha) {
+  MDCPremultipliedRGBA color = {red * alpha, green * alpha, blue * alpha, alpha};
+  return color;
+}
+
+/**
+ Returns the straight (unpremultiplied) components of @c color. A fully transparent color has all
+ its components set to 0.
+ */
+static inline void MDCPremultipliedRGBAGetComponents(MDCPremultipliedRGBA color,
+                                                     double *red,
+                                                     double *green,
+                                                     double *blue,
+                                                     double *alpha) {
+  if (color.alpha > 0) {
+    *red = color.red / color.alpha;
+    *green = color.green / color.alpha;
+    *blue = color.blue / color.alpha;
+  } else {
+    *red = 0;
+    *green = 0;
+    *blue = 0;
+  }
+  *alpha = color.alpha;
+}
+
+/**
+ Returns @c color composited over @c backgroundColor with the source-over operator. In premultiplied
+ form this is the same multiply-add on all four components, which compilers vectorize.
+ More info about Alpha compositing: https://en.wikipedia.org/wiki/Alpha_compositing
+ */
+static inline MDCPremultipliedRGBA MDCPremultipliedRGBABlend(MDCPremultipliedRGBA color,
+                                                             MDCPremultipliedRGBA backgroundColor) {
+  double backgroundWeight = 1 - color.alpha;
+  MDCPremultipliedRGBA result = {
+      color.red + backgroundColor.red * backgroundWeight,
+      color.green + backgroundColor.green * backgroundWeight,
+      color.blue + backgroundColor.blue * backgroundWeight,
+      color.alpha + backgroundColor.alpha * backgroundWeight,
+  };
+  return result;
+}
+
+/**
+ Composites each of @c count colors over the background color at the same index.
+
+ @c results may be the same array as @c colors or @c backgroundColors.
+ */
+void MDCPremultipliedRGBABlendArrays(const MDCPremultipliedRGBA *colors,
+                                     const MDCPremultipliedRGBA *backgroundColors,
+                                     MDCPremultipliedRGBA *results,
+                                     size_t count);
+
+/**
+ Composites each of @c count colors over the same background color.
+
+ @c results may be the same array as @c colors.
+ */
+void MDCPremultipliedRGBABlendArrayOverColor(const MDCPremultipliedRGBA *colors,
+                                             const MDCPremultipliedRGBA *backgroundColor,
+                                             MDCPremultipliedRGBA *results,
+                                             size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // MDC_COLOR_BLENDING_H
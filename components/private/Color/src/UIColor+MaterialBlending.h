@@ -26,4 +26,16 @@
 + (nonnull UIColor *)mdc_blendColor:(nonnull UIColor *)color
                 withBackgroundColor:(nonnull UIColor *)backgroundColor;
 
+/**
+ Blends each of the colors over the same background color, e.g. every color role of a theme over
+ its surface. Equivalent to calling @c mdc_blendColor:withBackgroundColor: for each color, but
+ reads the background color once and blends all the colors in one pass.
+
+ @param colors UIColor values that sit on top.
+ @param backgroundColor UIColor on the background.
+ @return The blended colors, in the same order as @c colors.
+ */
++ (nonnull NSArray<UIColor *> *)mdc_blendColors:(nonnull NSArray<UIColor *> *)colors
+                            withBackgroundColor:(nonnull UIColor *)backgroundColor;
+
 @end
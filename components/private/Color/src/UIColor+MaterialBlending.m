@@ -14,32 +14,51 @@
 
 #import "UIColor+MaterialBlending.h"
 
-/**
- Helper method to blend a color channel with a background color channel using alpha composition.
- More info about Alpha compositing: https://en.wikipedia.org/wiki/Alpha_compositing
-
- @params value is the value of color channel
- @params bValue is the value of background color channel
- @params alpha is the alpha of color channel
- @params bAlpha is the alpha of background color channel
- */
-
-static CGFloat blendColorChannel(CGFloat value, CGFloat bValue, CGFloat alpha, CGFloat bAlpha) {
-  return ((1 - alpha) * bValue * bAlpha + alpha * value) / (alpha + bAlpha * (1 - alpha));
+#import "MDCColorBlending.h"
+
+/** Returns the premultiplied components of @c color, or transparent black if it has none. */
+static MDCPremultipliedRGBA PremultipliedRGBAFromColor(UIColor *color) {
+  CGFloat red = 0.0, green = 0.0, blue = 0.0, alpha = 0.0;
+  [color getRed:&red green:&green blue:&blue alpha:&alpha];
+  return MDCPremultipliedRGBAMake(red, green, blue, alpha);
+}
+
+static UIColor *ColorFromPremultipliedRGBA(MDCPremultipliedRGBA color) {
+  double red = 0.0, green = 0.0, blue = 0.0, alpha = 0.0;
+  MDCPremultipliedRGBAGetComponents(color, &red, &green, &blue, &alpha);
+  return [UIColor colorWithRed:(CGFloat)red
+                         green:(CGFloat)green
+                          blue:(CGFloat)blue
+                         alpha:(CGFloat)alpha];
 }
 
 @implementation UIColor (MaterialBlending)
 
 + (UIColor *)mdc_blendColor:(UIColor *)color withBackgroundColor:(UIColor *)backgroundColor {
-  CGFloat red = 0.0, green = 0.0, blue = 0.0, alpha = 0.0;
-  [color getRed:&red green:&green blue:&blue alpha:&alpha];
-  CGFloat bRed = 0.0, bGreen = 0.0, bBlue = 0.0, bAlpha = 0.0;
-  [backgroundColor getRed:&bRed green:&bGreen blue:&bBlue alpha:&bAlpha];
+  return ColorFromPremultipliedRGBA(MDCPremultipliedRGBABlend(
+      PremultipliedRGBAFromColor(color), PremultipliedRGBAFromColor(backgroundColor)));
+}
+
++ (NSArray<UIColor *> *)mdc_blendColors:(NSArray<UIColor *> *)colors
+                    withBackgroundColor:(UIColor *)backgroundColor {
+  NSUInteger count = colors.count;
+  if (count == 0) {
+    return @[];
+  }
+
+  MDCPremultipliedRGBA *components = malloc(count * sizeof(MDCPremultipliedRGBA));
+  for (NSUInteger index = 0; index < count; ++index) {
+    components[index] = PremultipliedRGBAFromColor(colors[index]);
+  }
+  MDCPremultipliedRGBA background = PremultipliedRGBAFromColor(backgroundColor);
+  MDCPremultipliedRGBABlendArrayOverColor(components, &background, components, count);
 
-  return [UIColor colorWithRed:blendColorChannel(red, bRed, alpha, bAlpha)
-                         green:blendColorChannel(green, bGreen, alpha, bAlpha)
-                          blue:blendColorChannel(blue, bBlue, alpha, bAlpha)
-                         alpha:alpha + bAlpha * (1 - alpha)];
+  NSMutableArray<UIColor *> *blendedColors = [NSMutableArray arrayWithCapacity:count];
+  for (NSUInteger index = 0; index < count; ++index) {
+    [blendedColors addObject:ColorFromPremultipliedRGBA(components[index])];
+  }
+  free(components);
+  return blendedColors;
 }
 
 @end
@@ -29,6 +29,9 @@
 /**
  Returns the version of the current color that takes the specified traits into account.
 
+ Colors created with @c +colorWithUserInterfaceStyleDarkColor:defaultColor: are resolved without
+ running their dynamic provider.
+
  @note On pre-iOS 13 the orginal color is returned.
 
  @param traitCollection The traits to use when resolving the color information.
@@ -14,13 +14,19 @@
 
 #import "UIColor+MaterialDynamic.h"
 
+#import <objc/runtime.h>
+
+// The light and dark colors of a color created with
+// +colorWithUserInterfaceStyleDarkColor:defaultColor:, in that order.
+static const void *kUserInterfaceStyleColorsKey = &kUserInterfaceStyleColorsKey;
+
 @implementation UIColor (MaterialDynamic)
 
 + (UIColor *)colorWithUserInterfaceStyleDarkColor:(UIColor *)darkColor
                                      defaultColor:(UIColor *)defaultColor {
 #if defined(__IPHONE_13_0) && (__IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_13_0)
   if (@available(iOS 13.0, *)) {
-    return [UIColor
+    UIColor *color = [UIColor
         colorWithDynamicProvider:^UIColor *_Nonnull(UITraitCollection *_Nonnull traitCollection) {
           if (traitCollection.userInterfaceStyle == UIUserInterfaceStyleDark) {
             return darkColor;
@@ -28,6 +34,11 @@
             return defaultColor;
           }
         }];
+    // The color only depends on the user interface style, so its resolutions are known up front
+    // and -mdc_resolvedColorWithTraitCollection: can pick one without running the provider.
+    objc_setAssociatedObject(color, kUserInterfaceStyleColorsKey, @[ defaultColor, darkColor ],
+                             OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    return color;
   } else {
     return defaultColor;
   }
@@ -39,6 +50,13 @@
 - (UIColor *)mdc_resolvedColorWithTraitCollection:(UITraitCollection *)traitCollection {
 #if defined(__IPHONE_13_0) && (__IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_13_0)
   if (@available(iOS 13.0, *)) {
+    NSArray<UIColor *> *userInterfaceStyleColors =
+        objc_getAssociatedObject(self, kUserInterfaceStyleColorsKey);
+    if (userInterfaceStyleColors) {
+      BOOL isDark = traitCollection.userInterfaceStyle == UIUserInterfaceStyleDark;
+      UIColor *color = userInterfaceStyleColors[isDark ? 1 : 0];
+      return [color mdc_resolvedColorWithTraitCollection:traitCollection];
+    }
     return [self resolvedColorWithTraitCollection:traitCollection];
   } else {
     return self;
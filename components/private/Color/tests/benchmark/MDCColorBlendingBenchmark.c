@@ -0,0 +1,78 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Benchmarks the color blending kernel. It is plain C so that it runs on any host, e.g.
+// `bazel run //components/private/Color:color_blending_benchmark` on Linux.
+
+// Exposes clock_gettime and CLOCK_MONOTONIC when compiling in strict ISO C mode.
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "MDCColorBlending.h"
+
+static const size_t kColorCount = 4096;
+static const int kIterationCount = 10000;
+
+static double SecondsSince(const struct timespec *start) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double)(now.tv_sec - start->tv_sec) + (double)(now.tv_nsec - start->tv_nsec) * 1e-9;
+}
+
+int main(void) {
+  MDCPremultipliedRGBA *colors = malloc(kColorCount * sizeof(MDCPremultipliedRGBA));
+  MDCPremultipliedRGBA *backgroundColors = malloc(kColorCount * sizeof(MDCPremultipliedRGBA));
+  MDCPremultipliedRGBA *results = malloc(kColorCount * sizeof(MDCPremultipliedRGBA));
+  if (colors == NULL || backgroundColors == NULL || results == NULL) {
+    return EXIT_FAILURE;
+  }
+  for (size_t index = 0; index < kColorCount; ++index) {
+    double value = (double)index / kColorCount;
+    colors[index] = MDCPremultipliedRGBAMake(value, 1 - value, 0.5, value);
+    backgroundColors[index] = MDCPremultipliedRGBAMake(1 - value, value, 0.25, 1);
+  }
+  MDCPremultipliedRGBA background = MDCPremultipliedRGBAMake(0.2, 0.4, 0.6, 1);
+
+  // Accumulate a component of the results so that the blends can't be optimized away.
+  double checksum = 0;
+
+  struct timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (int iteration = 0; iteration < kIterationCount; ++iteration) {
+    MDCPremultipliedRGBABlendArrays(colors, backgroundColors, results, kColorCount);
+    checksum += results[iteration % kColorCount].red;
+  }
+  double arraysSeconds = SecondsSince(&start);
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (int iteration = 0; iteration < kIterationCount; ++iteration) {
+    MDCPremultipliedRGBABlendArrayOverColor(colors, &background, results, kColorCount);
+    checksum += results[iteration % kColorCount].red;
+  }
+  double overColorSeconds = SecondsSince(&start);
+
+  double blendCount = (double)kColorCount * kIterationCount;
+  printf("MDCPremultipliedRGBABlendArrays: %.2f ns per color\n", arraysSeconds * 1e9 / blendCount);
+  printf("MDCPremultipliedRGBABlendArrayOverColor: %.2f ns per color\n",
+         overColorSeconds * 1e9 / blendCount);
+  printf("Checksum: %f\n", checksum);
+
+  free(colors);
+  free(backgroundColors);
+  free(results);
+  return EXIT_SUCCESS;
+}
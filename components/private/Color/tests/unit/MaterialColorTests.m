@@ -14,6 +14,7 @@
 
 #import <XCTest/XCTest.h>
 
+#import "MDCColorBlending.h"
 #import "MaterialMath.h"
 #import "UIColor+MaterialBlending.h"
 #import "UIColor+MaterialDynamic.h"
@@ -89,6 +90,50 @@ static UIImage *fakeImageWithColorAndSize(UIColor *color, CGRect bounds) {
   }
 }
 
+- (void)testMDCResolvedDynamicColorMatchesUIKitResolution {
+#if defined(__IPHONE_13_0) && (__IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_13_0)
+  if (@available(iOS 13.0, *)) {
+    // Given
+    UIColor *dynamicColor = [UIColor colorWithUserInterfaceStyleDarkColor:UIColor.blackColor
+                                                             defaultColor:UIColor.whiteColor];
+    NSArray<UITraitCollection *> *traitCollections = @[
+      [UITraitCollection traitCollectionWithUserInterfaceStyle:UIUserInterfaceStyleDark],
+      [UITraitCollection traitCollectionWithUserInterfaceStyle:UIUserInterfaceStyleLight],
+      [UITraitCollection traitCollectionWithUserInterfaceStyle:UIUserInterfaceStyleUnspecified],
+    ];
+
+    for (UITraitCollection *traitCollection in traitCollections) {
+      // When
+      UIColor *resolvedColor = [dynamicColor mdc_resolvedColorWithTraitCollection:traitCollection];
+
+      // Then
+      XCTAssertEqualObjects(resolvedColor,
+                            [dynamicColor resolvedColorWithTraitCollection:traitCollection]);
+    }
+  }
+#endif
+}
+
+- (void)testMDCResolvedNestedDynamicColorIsFullyResolved {
+#if defined(__IPHONE_13_0) && (__IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_13_0)
+  if (@available(iOS 13.0, *)) {
+    // Given
+    UIColor *innerColor = [UIColor colorWithUserInterfaceStyleDarkColor:UIColor.redColor
+                                                           defaultColor:UIColor.blueColor];
+    UIColor *dynamicColor = [UIColor colorWithUserInterfaceStyleDarkColor:innerColor
+                                                             defaultColor:UIColor.whiteColor];
+    UITraitCollection *traitCollection =
+        [UITraitCollection traitCollectionWithUserInterfaceStyle:UIUserInterfaceStyleDark];
+
+    // When
+    UIColor *resolvedColor = [dynamicColor mdc_resolvedColorWithTraitCollection:traitCollection];
+
+    // Then
+    XCTAssertEqualObjects(resolvedColor, UIColor.redColor);
+  }
+#endif
+}
+
 - (void)testColorMergeForOpaqueColor {
   UIColor *backgroundColor = [UIColor whiteColor];
   UIColor *blendColor = [UIColor colorWithRed:0 green:0 blue:0 alpha:1.0];
@@ -268,6 +313,91 @@ static UIImage *fakeImageWithColorAndSize(UIColor *color, CGRect bounds) {
   XCTAssertEqualObjects(platformColor, mdcColor);
 }
 
+- (void)testBlendKernelMatchesStraightAlphaBlending {
+  // Given
+  MDCPremultipliedRGBA colors[] = {
+      MDCPremultipliedRGBAMake(0.9, 0.82, 0.1, 0.6),
+      MDCPremultipliedRGBAMake(0, 0, 0, 0.5),
+  };
+  MDCPremultipliedRGBA backgroundColors[] = {
+      MDCPremultipliedRGBAMake(0.3, 0.3, 0.3, 0.8),
+      MDCPremultipliedRGBAMake(1, 1, 1, 1),
+  };
+  MDCPremultipliedRGBA results[2];
+
+  // When
+  MDCPremultipliedRGBABlendArrays(colors, backgroundColors, results, 2);
+
+  // Then
+  double red = 0, green = 0, blue = 0, alpha = 0;
+  MDCPremultipliedRGBAGetComponents(results[0], &red, &green, &blue, &alpha);
+  XCTAssertEqualWithAccuracy(red, 0.69130434782608696, 1e-12);
+  XCTAssertEqualWithAccuracy(green, 0.63913043478260867, 1e-12);
+  XCTAssertEqualWithAccuracy(blue, 0.16956521739130434, 1e-12);
+  XCTAssertEqualWithAccuracy(alpha, 0.92, 1e-12);
+  MDCPremultipliedRGBAGetComponents(results[1], &red, &green, &blue, &alpha);
+  XCTAssertEqual(red, 0.5);
+  XCTAssertEqual(alpha, 1);
+}
+
+- (void)testBlendKernelOfTransparentColorsIsTransparentBlack {
+  // Given
+  MDCPremultipliedRGBA transparent = MDCPremultipliedRGBAMake(0.4, 0.5, 0.6, 0);
+
+  // When
+  MDCPremultipliedRGBA result = MDCPremultipliedRGBABlend(transparent, transparent);
+
+  // Then
+  double red = 1, green = 1, blue = 1, alpha = 1;
+  MDCPremultipliedRGBAGetComponents(result, &red, &green, &blue, &alpha);
+  XCTAssertEqual(red, 0);
+  XCTAssertEqual(green, 0);
+  XCTAssertEqual(blue, 0);
+  XCTAssertEqual(alpha, 0);
+}
+
+- (void)testBlendColorsMatchesBlendingEachColor {
+  // Given
+  UIColor *backgroundColor = [UIColor colorWithWhite:(CGFloat)0.3 alpha:(CGFloat)0.8];
+  NSArray<UIColor *> *colors = @[
+    [UIColor colorWithRed:(CGFloat)0.9 green:(CGFloat)0.82 blue:(CGFloat)0.1 alpha:(CGFloat)0.6],
+    [UIColor colorWithWhite:0 alpha:(CGFloat)0.12],
+    UIColor.clearColor,
+    UIColor.blueColor,
+  ];
+
+  // When
+  NSArray<UIColor *> *blendedColors = [UIColor mdc_blendColors:colors
+                                           withBackgroundColor:backgroundColor];
+
+  // Then
+  XCTAssertEqual(blendedColors.count, colors.count);
+  for (NSUInteger index = 0; index < colors.count; ++index) {
+    UIColor *expectedColor = [UIColor mdc_blendColor:colors[index]
+                                 withBackgroundColor:backgroundColor];
+    XCTAssertTrue([self compareColorsWithFloatPrecisionFirstColor:blendedColors[index]
+                                                      secondColor:expectedColor]);
+  }
+}
+
+- (void)testBlendColorsPerformance {
+  // Given
+  UIColor *backgroundColor = [UIColor colorWithWhite:(CGFloat)0.07 alpha:1];
+  NSMutableArray<UIColor *> *colors = [NSMutableArray array];
+  for (NSUInteger index = 0; index < 1000; ++index) {
+    [colors addObject:[UIColor colorWithWhite:1 alpha:(CGFloat)(index % 100) / 100]];
+  }
+  __block NSArray<UIColor *> *blendedColors = nil;
+
+  // When
+  [self measureBlock:^{
+    blendedColors = [UIColor mdc_blendColors:colors withBackgroundColor:backgroundColor];
+  }];
+
+  // Then
+  XCTAssertEqual(blendedColors.count, colors.count);
+}
+
 - (BOOL)compareColorsWithFloatPrecisionFirstColor:(UIColor *)firstColor
                                       secondColor:(UIColor *)secondColor {
   CGFloat fRed = 0.0, fGreen = 0.0, fBlue = 0.0, fAlpha = 0.0;
@@ -0,0 +1,59 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <UIKit/UIKit.h>
+
+/** Draws a glyph into the current graphics context so that it fills @c bounds. */
+typedef void (^MDCGlyphDrawingBlock)(CGRect bounds);
+
+/**
+ A process-wide cache of small glyph images that components draw in code, such as clear buttons.
+
+ Components that draw the same glyph for every instance, like the delete button of each chip in a
+ chip field, share a single bitmap per glyph name, size and scale instead of rendering one each.
+ Images are returned with UIImageRenderingModeAlwaysTemplate, so views tint them with their
+ tintColor; only the alpha of what the drawing block draws is visible.
+
+ MDCGlyphCache is thread safe. Cached images may be evicted under memory pressure, in which case
+ they are drawn again the next time they are requested.
+ */
+@interface MDCGlyphCache : NSObject
+
+/** The cache shared by all components. */
++ (nonnull MDCGlyphCache *)sharedCache;
+
+/**
+ Returns the template image of the glyph named @c name, drawing it with @c drawingBlock if it is not
+ cached yet.
+
+ @param name Identifies what @c drawingBlock draws. Callers that draw different glyphs, or the same
+             glyph with a different opacity, must use different names.
+ @param size The size of the image, in points.
+ @param scale The scale of the image. Zero means the scale of the main screen, in which case this
+              must be called on the main thread.
+ @param drawingBlock Draws the glyph. It is called synchronously, at most once per call.
+ */
+- (nonnull UIImage *)templateImageForGlyphNamed:(nonnull NSString *)name
+                                           size:(CGSize)size
+                                          scale:(CGFloat)scale
+                                   drawingBlock:
+                                       (nonnull NS_NOESCAPE MDCGlyphDrawingBlock)drawingBlock;
+
+/** The number of images that have been drawn, including ones since evicted. */
+@property(nonatomic, readonly) NSUInteger drawCount;
+
+/** Removes all cached images. */
+- (void)removeAllImages;
+
+@end
@@ -0,0 +1,82 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCGlyphCache.h"
+
+@implementation MDCGlyphCache {
+  NSCache<NSString *, UIImage *> *_images;
+  NSUInteger _drawCount;
+}
+
++ (MDCGlyphCache *)sharedCache {
+  static MDCGlyphCache *sharedCache;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    sharedCache = [[MDCGlyphCache alloc] init];
+  });
+  return sharedCache;
+}
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _images = [[NSCache alloc] init];
+    _images.name = @"MDCGlyphCache";
+  }
+  return self;
+}
+
+- (UIImage *)templateImageForGlyphNamed:(NSString *)name
+                                   size:(CGSize)size
+                                  scale:(CGFloat)scale
+                           drawingBlock:(MDCGlyphDrawingBlock)drawingBlock {
+  if (scale <= 0) {
+    scale = [UIScreen mainScreen].scale;
+  }
+  NSString *key = [NSString stringWithFormat:@"%@-%gx%g@%g", name, (double)size.width,
+                                             (double)size.height, (double)scale];
+  UIImage *image = [_images objectForKey:key];
+  if (image) {
+    return image;
+  }
+
+  CGRect bounds = CGRectMake(0, 0, size.width, size.height);
+  UIGraphicsBeginImageContextWithOptions(bounds.size, false, scale);
+  drawingBlock(bounds);
+  image = UIGraphicsGetImageFromCurrentImageContext();
+  UIGraphicsEndImageContext();
+  if (!image) {
+    // Drawing fails for empty sizes.
+    return [[UIImage alloc] init];
+  }
+  image = [image imageWithRenderingMode:UIImageRenderingModeAlwaysTemplate];
+
+  [_images setObject:image forKey:key];
+  @synchronized(self) {
+    ++_drawCount;
+  }
+  return image;
+}
+
+- (NSUInteger)drawCount {
+  @synchronized(self) {
+    return _drawCount;
+  }
+}
+
+- (void)removeAllImages {
+  [_images removeAllObjects];
+}
+
+@end
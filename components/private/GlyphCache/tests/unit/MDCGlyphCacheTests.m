@@ -0,0 +1,117 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialGlyphCache.h"
+
+@interface MDCGlyphCacheTests : XCTestCase
+@property(nonatomic, strong) MDCGlyphCache *cache;
+@end
+
+@implementation MDCGlyphCacheTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.cache = [[MDCGlyphCache alloc] init];
+}
+
+- (void)tearDown {
+  self.cache = nil;
+
+  [super tearDown];
+}
+
+- (UIImage *)imageForGlyphNamed:(NSString *)name size:(CGSize)size scale:(CGFloat)scale {
+  return [self.cache templateImageForGlyphNamed:name
+                                           size:size
+                                          scale:scale
+                                   drawingBlock:^(CGRect bounds) {
+                                     [UIColor.blackColor setFill];
+                                     UIRectFill(bounds);
+                                   }];
+}
+
+- (void)testReturnsTemplateImageOfRequestedSizeAndScale {
+  // When
+  UIImage *image = [self imageForGlyphNamed:@"square" size:CGSizeMake(18, 20) scale:3];
+
+  // Then
+  XCTAssertEqual(image.renderingMode, UIImageRenderingModeAlwaysTemplate);
+  XCTAssertTrue(CGSizeEqualToSize(image.size, CGSizeMake(18, 20)));
+  XCTAssertEqual(image.scale, 3);
+}
+
+- (void)testSameGlyphIsDrawnOnce {
+  // Given
+  UIImage *firstImage = [self imageForGlyphNamed:@"square" size:CGSizeMake(18, 18) scale:2];
+
+  // When
+  UIImage *secondImage = [self imageForGlyphNamed:@"square" size:CGSizeMake(18, 18) scale:2];
+
+  // Then
+  XCTAssertEqual(firstImage, secondImage);
+  XCTAssertEqual(self.cache.drawCount, 1U);
+}
+
+- (void)testNameSizeAndScaleAreAllPartOfTheKey {
+  // Given
+  UIImage *image = [self imageForGlyphNamed:@"square" size:CGSizeMake(18, 18) scale:2];
+
+  // When
+  UIImage *otherName = [self imageForGlyphNamed:@"other" size:CGSizeMake(18, 18) scale:2];
+  UIImage *otherSize = [self imageForGlyphNamed:@"square" size:CGSizeMake(24, 24) scale:2];
+  UIImage *otherScale = [self imageForGlyphNamed:@"square" size:CGSizeMake(18, 18) scale:3];
+
+  // Then
+  XCTAssertNotEqual(image, otherName);
+  XCTAssertNotEqual(image, otherSize);
+  XCTAssertNotEqual(image, otherScale);
+  XCTAssertEqual(self.cache.drawCount, 4U);
+}
+
+- (void)testZeroScaleUsesMainScreenScale {
+  // When
+  UIImage *image = [self imageForGlyphNamed:@"square" size:CGSizeMake(18, 18) scale:0];
+  UIImage *screenScaleImage = [self imageForGlyphNamed:@"square"
+                                                  size:CGSizeMake(18, 18)
+                                                 scale:[UIScreen mainScreen].scale];
+
+  // Then
+  XCTAssertEqual(image, screenScaleImage);
+}
+
+- (void)testRemoveAllImagesCausesRedraw {
+  // Given
+  [self imageForGlyphNamed:@"square" size:CGSizeMake(18, 18) scale:2];
+
+  // When
+  [self.cache removeAllImages];
+  [self imageForGlyphNamed:@"square" size:CGSizeMake(18, 18) scale:2];
+
+  // Then
+  XCTAssertEqual(self.cache.drawCount, 2U);
+}
+
+- (void)testEmptySizeReturnsEmptyImage {
+  // When
+  UIImage *image = [self imageForGlyphNamed:@"square" size:CGSizeZero scale:2];
+
+  // Then
+  XCTAssertNotNil(image);
+  XCTAssertTrue(CGSizeEqualToSize(image.size, CGSizeZero));
+}
+
+@end
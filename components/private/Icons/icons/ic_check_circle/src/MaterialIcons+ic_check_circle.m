@@ -31,8 +31,7 @@ __attribute__((visibility("default"))) char MDCIconsExportToSuppressLibToolWarni
 }
 
 + (nullable UIImage *)imageFor_ic_check_circle {
-  NSBundle *bundle = [self bundleNamed:kBundleName];
-  return [UIImage imageNamed:kIconName inBundle:bundle compatibleWithTraitCollection:nil];
+  return [self imageForIconName:kIconName withBundleName:kBundleName];
 }
 
 @end
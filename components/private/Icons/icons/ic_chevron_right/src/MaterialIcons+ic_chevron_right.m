@@ -31,8 +31,7 @@ __attribute__((
 }
 
 + (nullable UIImage *)imageFor_ic_chevron_right {
-  NSBundle *bundle = [self bundleNamed:kBundleName];
-  return [UIImage imageNamed:kIconName inBundle:bundle compatibleWithTraitCollection:nil];
+  return [self imageForIconName:kIconName withBundleName:kBundleName];
 }
 
 @end
@@ -31,8 +31,7 @@ __attribute__((visibility("default"))) char MDCIconsExportToSuppressLibToolWarni
 }
 
 + (nullable UIImage *)imageFor_ic_color_lens {
-  NSBundle *bundle = [self bundleNamed:kBundleName];
-  return [UIImage imageNamed:kIconName inBundle:bundle compatibleWithTraitCollection:nil];
+  return [self imageForIconName:kIconName withBundleName:kBundleName];
 }
 
 @end
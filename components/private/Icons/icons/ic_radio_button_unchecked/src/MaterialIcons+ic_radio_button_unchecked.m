@@ -31,8 +31,7 @@ __attribute__((visibility(
 }
 
 + (nullable UIImage *)imageFor_ic_radio_button_unchecked {
-  NSBundle *bundle = [self bundleNamed:kBundleName];
-  return [UIImage imageNamed:kIconName inBundle:bundle compatibleWithTraitCollection:nil];
+  return [self imageForIconName:kIconName withBundleName:kBundleName];
 }
 
 @end
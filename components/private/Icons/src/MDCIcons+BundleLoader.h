@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#import <UIKit/UIKit.h>
+
 #import "MDCIcons.h"
 
 /**
@@ -29,4 +31,13 @@
 
 + (nullable NSBundle *)bundleNamed:(nonnull NSString *)bundleName;
 
+/**
+ Returns the image for an icon contained within a bundle of a given name.
+
+ Only the icon's PNG for the main screen's scale is read, memory-mapped rather than copied. The
+ image is decoded once and kept in memory, so later calls for the same icon do not touch the disk.
+ */
++ (nullable UIImage *)imageForIconName:(nonnull NSString *)iconName
+                        withBundleName:(nonnull NSString *)bundleName;
+
 @end
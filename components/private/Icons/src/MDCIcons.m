@@ -14,10 +14,24 @@
 
 #import "MDCIcons.h"
 
+#import <ImageIO/ImageIO.h>
+
 #import "MDCIcons+BundleLoader.h"
 
+// The largest scale that icons are provided at.
+static const NSUInteger kMaximumIconScale = 3;
+
 @implementation MDCIcons
 
++ (NSCache<NSString *, UIImage *> *)iconImageCache {
+  static NSCache<NSString *, UIImage *> *iconImageCache;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    iconImageCache = [[NSCache alloc] init];
+  });
+  return iconImageCache;
+}
+
 + (nullable NSBundle *)bundleNamed:(nonnull NSString *)bundleName {
   static NSCache *bundleCache;
   static dispatch_once_t onceToken;
@@ -44,4 +58,65 @@
   return [bundle pathForResource:iconName ofType:@"png"];
 }
 
++ (nullable UIImage *)imageForIconName:(nonnull NSString *)iconName
+                        withBundleName:(nonnull NSString *)bundleName {
+  NSString *cacheKey = [bundleName stringByAppendingPathComponent:iconName];
+  UIImage *image = [[self iconImageCache] objectForKey:cacheKey];
+  if (image) {
+    return image;
+  }
+
+  NSBundle *bundle = [self bundleNamed:bundleName];
+  if (!bundle) {
+    return nil;
+  }
+  image = [self decodedImageForIconName:iconName inBundle:bundle];
+  if (!image) {
+    // Fall back to UIKit's lookup, e.g. for icons that are not provided at every scale.
+    image = [UIImage imageNamed:iconName inBundle:bundle compatibleWithTraitCollection:nil];
+  }
+  if (image) {
+    [[self iconImageCache] setObject:image forKey:cacheKey];
+  }
+  return image;
+}
+
+/**
+ Returns the icon's image at the main screen's scale, already decoded so that drawing it does not
+ decode it again, or nil if the bundle does not contain the icon at that scale.
+
+ The file is opened directly at its known path instead of being searched for through the bundle.
+ It is decoded in its own pixel format, so gray and alpha icons keep two bytes per pixel instead of
+ being redrawn into a four-byte RGBA bitmap.
+ */
++ (nullable UIImage *)decodedImageForIconName:(nonnull NSString *)iconName
+                                     inBundle:(nonnull NSBundle *)bundle {
+  NSUInteger scale = MIN((NSUInteger)ceil([UIScreen mainScreen].scale), kMaximumIconScale);
+  NSString *fileName = [iconName stringByAppendingPathExtension:@"png"];
+  if (scale > 1) {
+    fileName = [NSString stringWithFormat:@"%@@%lux.png", iconName, (unsigned long)scale];
+  }
+  NSString *path = [bundle.bundlePath stringByAppendingPathComponent:fileName];
+  NSData *data = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedIfSafe error:NULL];
+  if (!data) {
+    return nil;
+  }
+  CGImageSourceRef imageSource = CGImageSourceCreateWithData((__bridge CFDataRef)data, NULL);
+  if (!imageSource) {
+    return nil;
+  }
+  NSDictionary *options = @{(__bridge NSString *)kCGImageSourceShouldCacheImmediately : @YES};
+  CGImageRef cgImage =
+      CGImageSourceCreateImageAtIndex(imageSource, 0, (__bridge CFDictionaryRef)options);
+  CFRelease(imageSource);
+  if (!cgImage) {
+    return nil;
+  }
+  UIImage *image = [UIImage imageWithCGImage:cgImage
+                                       scale:scale
+                                 orientation:UIImageOrientationUp];
+  CGImageRelease(cgImage);
+  return image;
+}
+
 @end
@@ -0,0 +1,183 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialIcons+ic_arrow_back.h"
+#import "MaterialIcons+ic_check.h"
+#import "MaterialIcons+ic_check_circle.h"
+#import "MaterialIcons+ic_chevron_right.h"
+#import "MaterialIcons+ic_color_lens.h"
+#import "MaterialIcons+ic_help_outline.h"
+#import "MaterialIcons+ic_info.h"
+#import "MaterialIcons+ic_more_horiz.h"
+#import "MaterialIcons+ic_radio_button_unchecked.h"
+#import "MaterialIcons+ic_reorder.h"
+#import "MaterialIcons+ic_settings.h"
+
+@interface MDCIcons (Testing)
++ (NSCache<NSString *, UIImage *> *)iconImageCache;
+@end
+
+@interface MDCIconsImageCacheTests : XCTestCase
+@end
+
+@implementation MDCIconsImageCacheTests
+
+- (void)setUp {
+  [super setUp];
+
+  [[MDCIcons iconImageCache] removeAllObjects];
+}
+
+- (void)tearDown {
+  [[MDCIcons iconImageCache] removeAllObjects];
+
+  [super tearDown];
+}
+
+/** Loads every icon the way components do on first use. */
+- (NSArray<UIImage *> *)loadAllIcons {
+  return @[
+    [MDCIcons imageFor_ic_arrow_back],
+    [MDCIcons imageFor_ic_check],
+    [MDCIcons imageFor_ic_check_circle],
+    [MDCIcons imageFor_ic_chevron_right],
+    [MDCIcons imageFor_ic_color_lens],
+    [MDCIcons imageFor_ic_help_outline],
+    [MDCIcons imageFor_ic_info],
+    [MDCIcons imageFor_ic_more_horiz],
+    [MDCIcons imageFor_ic_radio_button_unchecked],
+    [MDCIcons imageFor_ic_reorder],
+    [MDCIcons imageFor_ic_settings],
+  ];
+}
+
+/** Loads every icon from its file, resolving the path through its bundle as before. */
+- (NSArray<UIImage *> *)loadAllIconsFromPaths {
+  NSArray<NSString *> *paths = @[
+    [MDCIcons pathFor_ic_arrow_back],
+    [MDCIcons pathFor_ic_check],
+    [MDCIcons pathFor_ic_check_circle],
+    [MDCIcons pathFor_ic_chevron_right],
+    [MDCIcons pathFor_ic_color_lens],
+    [MDCIcons pathFor_ic_help_outline],
+    [MDCIcons pathFor_ic_info],
+    [MDCIcons pathFor_ic_more_horiz],
+    [MDCIcons pathFor_ic_radio_button_unchecked],
+    [MDCIcons pathFor_ic_reorder],
+    [MDCIcons pathFor_ic_settings],
+  ];
+  NSMutableArray<UIImage *> *images = [NSMutableArray array];
+  for (NSString *path in paths) {
+    [images addObject:[UIImage imageWithContentsOfFile:path]];
+  }
+  return images;
+}
+
+- (void)testImageMatchesTheImageLoadedByUIKit {
+  // Given
+  NSBundle *bundle = [MDCIcons bundleNamed:@"MaterialIcons_ic_check"];
+  UIImage *expectedImage = [UIImage imageNamed:@"ic_check"
+                                      inBundle:bundle
+                 compatibleWithTraitCollection:nil];
+
+  // When
+  UIImage *image = [MDCIcons imageFor_ic_check];
+
+  // Then
+  XCTAssertTrue(CGSizeEqualToSize(image.size, expectedImage.size));
+  XCTAssertEqualWithAccuracy(image.scale, expectedImage.scale, 0.001);
+  XCTAssertEqual(image.renderingMode, UIImageRenderingModeAutomatic);
+}
+
+- (void)testImageKeepsThePixelFormatOfTheIconFile {
+  // Given
+  NSBundle *bundle = [MDCIcons bundleNamed:@"MaterialIcons_ic_check"];
+  UIImage *expectedImage = [UIImage imageNamed:@"ic_check"
+                                      inBundle:bundle
+                 compatibleWithTraitCollection:nil];
+
+  // When
+  UIImage *image = [MDCIcons imageFor_ic_check];
+
+  // Then
+  XCTAssertEqual(CGImageGetBitsPerPixel(image.CGImage),
+                 CGImageGetBitsPerPixel(expectedImage.CGImage));
+}
+
+- (void)testImageIsLoadedOnce {
+  // When
+  UIImage *firstImage = [MDCIcons imageFor_ic_info];
+  UIImage *secondImage = [MDCIcons imageFor_ic_info];
+
+  // Then
+  XCTAssertNotNil(firstImage);
+  XCTAssertEqual(firstImage, secondImage);
+}
+
+- (void)testImagesAreCachedPerIconName {
+  // When
+  [MDCIcons ic_arrow_backUseNewStyle:NO];
+  UIImage *oldStyleImage = [MDCIcons imageFor_ic_arrow_back];
+  [MDCIcons ic_arrow_backUseNewStyle:YES];
+  UIImage *newStyleImage = [MDCIcons imageFor_ic_arrow_back];
+
+  // Then
+  XCTAssertNotNil(oldStyleImage);
+  XCTAssertNotNil(newStyleImage);
+  XCTAssertNotEqual(oldStyleImage, newStyleImage);
+}
+
+- (void)testMissingIconHasNoImage {
+  // When
+  UIImage *image = [MDCIcons imageForIconName:@"ic_does_not_exist"
+                               withBundleName:@"MaterialIcons_ic_check"];
+
+  // Then
+  XCTAssertNil(image);
+}
+
+- (void)testMissingBundleHasNoImage {
+  // When
+  UIImage *image = [MDCIcons imageForIconName:@"ic_check"
+                               withBundleName:@"someNameThatDoesNotExist"];
+
+  // Then
+  XCTAssertNil(image);
+}
+
+- (void)testColdLoadPerformance {
+  // When
+  [self measureBlock:^{
+    [[MDCIcons iconImageCache] removeAllObjects];
+    [self loadAllIcons];
+  }];
+
+  // Then
+  XCTAssertEqual([self loadAllIcons].count, 11U);
+}
+
+- (void)testColdLoadFromPathsPerformance {
+  // When
+  [self measureBlock:^{
+    [self loadAllIconsFromPaths];
+  }];
+
+  // Then
+  XCTAssertEqual([self loadAllIconsFromPaths].count, 11U);
+}
+
+@end
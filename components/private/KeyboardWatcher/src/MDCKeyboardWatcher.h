@@ -22,6 +22,22 @@ OBJC_EXTERN NSString *const MDCKeyboardWatcherKeyboardWillShowNotification;
 OBJC_EXTERN NSString *const MDCKeyboardWatcherKeyboardWillHideNotification;
 OBJC_EXTERN NSString *const MDCKeyboardWatcherKeyboardWillChangeFrameNotification;
 
+/**
+ Posted at most once per run loop turn, after one or more of the notifications above.
+
+ UIKit usually posts several keyboard notifications for a single keyboard change, for example both
+ UIKeyboardWillChangeFrameNotification and UIKeyboardWillShowNotification when the keyboard appears.
+ Observers that treat all of them alike should observe this notification instead, so that they only
+ update their layout once. It is posted before Core Animation commits the run loop's transaction, so
+ animations started in response still run alongside the keyboard's animation.
+
+ The user info dictionary contains the UIKit keyboard keys merged across the coalesced
+ notifications. UIKeyboardFrameBeginUserInfoKey comes from the first of them and
+ UIKeyboardFrameEndUserInfoKey from the last. The animation duration and curve come from the last
+ notification that was animated.
+ */
+OBJC_EXTERN NSString *const MDCKeyboardWatcherKeyboardWillUpdateNotification;
+
 /**
  An object which will watch the state of the keyboard.
 
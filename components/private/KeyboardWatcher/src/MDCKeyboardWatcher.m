@@ -21,16 +21,45 @@ NSString *const MDCKeyboardWatcherKeyboardWillHideNotification =
     @"MDCKeyboardWatcherKeyboardWillHideNotification";
 NSString *const MDCKeyboardWatcherKeyboardWillChangeFrameNotification =
     @"MDCKeyboardWatcherKeyboardWillChangeFrameNotification";
+NSString *const MDCKeyboardWatcherKeyboardWillUpdateNotification =
+    @"MDCKeyboardWatcherKeyboardWillUpdateNotification";
 
 static MDCKeyboardWatcher *_sKeyboardWatcher;
 
-@interface MDCKeyboardWatcher ()
+@interface MDCKeyboardWatcher () {
+ @public
+  /**
+   The merged user info of the keyboard notifications received during the current run loop turn, or
+   nil if there were none. Raw ivar to allow direct access from the runloop observer callback.
+   */
+  NSMutableDictionary *_pendingUpdateUserInfo;
+}
 
 /** The keyboard's frame, in rotation-compensated screen coordinates. */
 @property(nonatomic) CGRect keyboardFrame;
 
+/** Whether any of the notifications merged into @c _pendingUpdateUserInfo was animated. */
+@property(nonatomic) BOOL pendingUpdateIsAnimated;
+
+/** The runloop observer that posts MDCKeyboardWatcherKeyboardWillUpdateNotification. */
+@property(nonatomic, strong) __attribute__((NSObject)) CFRunLoopObserverRef observer;
+
+/** Called by the runloop observer C function. */
+- (void)postPendingUpdate;
+
 @end
 
+#pragma mark - Runloop Observer
+
+static void runloopObserverCallback(__unused CFRunLoopObserverRef observer,
+                                    __unused CFRunLoopActivity activity,
+                                    void *info) {
+  MDCKeyboardWatcher *keyboardWatcher = (__bridge MDCKeyboardWatcher *)info;
+  if (keyboardWatcher != NULL && keyboardWatcher->_pendingUpdateUserInfo != nil) {
+    [keyboardWatcher postPendingUpdate];
+  }
+}
+
 @implementation MDCKeyboardWatcher
 
 // Because at the time of writing, there is no public API for answering the question: "Is the
@@ -65,6 +94,8 @@ static MDCKeyboardWatcher *_sKeyboardWatcher;
                       selector:@selector(keyboardWillChangeFrame:)
                           name:UIKeyboardWillChangeFrameNotification
                         object:nil];
+
+    [self installRunloopObserver];
   }
 
   return self;
@@ -72,6 +103,70 @@ static MDCKeyboardWatcher *_sKeyboardWatcher;
 
 - (void)dealloc {
   [[NSNotificationCenter defaultCenter] removeObserver:self];
+  [self uninstallRunloopObserver];
+}
+
+#pragma mark - Runloop Observer
+
+- (void)installRunloopObserver {
+  CFRunLoopObserverContext context = {0, (__bridge void *)(self), NULL, NULL, NULL};
+
+  // The observer runs before the overlay animation observer and Core Animation's commit observer,
+  // so that animations started by observers of the coalesced notification are reported and
+  // committed together with the keyboard's animation.
+  CFRunLoopObserverRef observer =
+      CFRunLoopObserverCreate(kCFAllocatorDefault, kCFRunLoopBeforeWaiting,
+                              YES,  // Repeats
+                              MDCKeyboardWatcherRunLoopObserverOrder,
+                              &runloopObserverCallback, &context);
+
+  if (observer != NULL) {
+    self.observer = observer;
+    CFRunLoopAddObserver(CFRunLoopGetMain(), observer, kCFRunLoopCommonModes);
+    CFRelease(observer);
+  }
+}
+
+- (void)uninstallRunloopObserver {
+  if (self.observer == NULL) {
+    return;
+  }
+
+  CFRunLoopRemoveObserver(CFRunLoopGetMain(), self.observer, kCFRunLoopCommonModes);
+  self.observer = nil;
+}
+
+- (void)coalesceKeyboardUserInfo:(NSDictionary *)userInfo {
+  BOOL isFirstNotification = _pendingUpdateUserInfo == nil;
+  if (isFirstNotification) {
+    _pendingUpdateUserInfo = [NSMutableDictionary dictionary];
+  }
+
+  // A notification without an animation, such as the one for an undocked keyboard moving, must not
+  // replace the animation of a notification it is coalesced with.
+  BOOL isAnimated = [userInfo[UIKeyboardAnimationDurationUserInfoKey] doubleValue] > 0;
+  BOOL keepsPendingAnimation = !isAnimated && self.pendingUpdateIsAnimated;
+  for (id key in userInfo) {
+    if (!isFirstNotification && [key isEqual:UIKeyboardFrameBeginUserInfoKey]) {
+      continue;
+    }
+    if (keepsPendingAnimation && ([key isEqual:UIKeyboardAnimationDurationUserInfoKey] ||
+                                  [key isEqual:UIKeyboardAnimationCurveUserInfoKey])) {
+      continue;
+    }
+    _pendingUpdateUserInfo[key] = userInfo[key];
+  }
+  self.pendingUpdateIsAnimated = self.pendingUpdateIsAnimated || isAnimated;
+}
+
+- (void)postPendingUpdate {
+  NSDictionary *userInfo = [_pendingUpdateUserInfo copy];
+  _pendingUpdateUserInfo = nil;
+  self.pendingUpdateIsAnimated = NO;
+  [[NSNotificationCenter defaultCenter]
+      postNotificationName:MDCKeyboardWatcherKeyboardWillUpdateNotification
+                    object:self
+                  userInfo:userInfo];
 }
 
 #pragma mark - Keyboard Notifications
@@ -120,10 +215,16 @@ static MDCKeyboardWatcher *_sKeyboardWatcher;
   return self.visibleKeyboardHeight;
 }
 
+static BOOL IsKeyboardWatcherNotification(NSNotification *notification) {
+  NSString *name = notification.name;
+  return [name isEqualToString:MDCKeyboardWatcherKeyboardWillShowNotification] ||
+         [name isEqualToString:MDCKeyboardWatcherKeyboardWillHideNotification] ||
+         [name isEqualToString:MDCKeyboardWatcherKeyboardWillChangeFrameNotification] ||
+         [name isEqualToString:MDCKeyboardWatcherKeyboardWillUpdateNotification];
+}
+
 + (NSTimeInterval)animationDurationFromKeyboardNotification:(NSNotification *)notification {
-  if (![notification.name isEqualToString:MDCKeyboardWatcherKeyboardWillShowNotification] &&
-      ![notification.name isEqualToString:MDCKeyboardWatcherKeyboardWillHideNotification] &&
-      ![notification.name isEqualToString:MDCKeyboardWatcherKeyboardWillChangeFrameNotification]) {
+  if (!IsKeyboardWatcherNotification(notification)) {
     NSAssert(NO, @"Cannot extract the animation duration from a non-keyboard notification.");
 
     return 0.0;
@@ -158,9 +259,7 @@ static UIViewAnimationOptions animationOptionsWithCurve(UIViewAnimationCurve ani
 
 + (UIViewAnimationOptions)animationCurveOptionFromKeyboardNotification:
     (NSNotification *)notification {
-  if (![notification.name isEqualToString:MDCKeyboardWatcherKeyboardWillShowNotification] &&
-      ![notification.name isEqualToString:MDCKeyboardWatcherKeyboardWillHideNotification] &&
-      ![notification.name isEqualToString:MDCKeyboardWatcherKeyboardWillChangeFrameNotification]) {
+  if (!IsKeyboardWatcherNotification(notification)) {
     NSAssert(NO, @"Cannot extract the animation curve option from a non-keyboard notification.");
 
     return UIViewAnimationOptionCurveEaseInOut;
@@ -181,6 +280,7 @@ static UIViewAnimationOptions animationOptionsWithCurve(UIViewAnimationCurve ani
       postNotificationName:MDCKeyboardWatcherKeyboardWillShowNotification
                     object:self
                   userInfo:notification.userInfo];
+  [self coalesceKeyboardUserInfo:notification.userInfo];
 }
 
 - (void)keyboardWillChangeFrame:(NSNotification *)notification {
@@ -189,6 +289,7 @@ static UIViewAnimationOptions animationOptionsWithCurve(UIViewAnimationCurve ani
       postNotificationName:MDCKeyboardWatcherKeyboardWillChangeFrameNotification
                     object:self
                   userInfo:notification.userInfo];
+  [self coalesceKeyboardUserInfo:notification.userInfo];
 }
 
 - (void)keyboardWillHide:(NSNotification *)notification {
@@ -204,6 +305,7 @@ static UIViewAnimationOptions animationOptionsWithCurve(UIViewAnimationCurve ani
       postNotificationName:MDCKeyboardWatcherKeyboardWillHideNotification
                     object:self
                   userInfo:notification.userInfo];
+  [self coalesceKeyboardUserInfo:notification.userInfo];
 }
 
 @end
@@ -0,0 +1,229 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialKeyboardWatcher.h"
+
+static const CGFloat kKeyboardHeight = 291;
+static const CGFloat kKeyboardHeightWithQuickType = 335;
+
+/** The keyboard curve UIKit uses, which is not declared in UIViewAnimationCurve. */
+static const NSInteger kKeyboardAnimationCurve = 7;
+
+@interface KeyboardWatcherCoalescingTests : XCTestCase
+@property(nonatomic, strong, nullable) MDCKeyboardWatcher *watcher;
+@property(nonatomic, strong, nullable) NSMutableArray<NSNotification *> *updates;
+@end
+
+@implementation KeyboardWatcherCoalescingTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.watcher = [[MDCKeyboardWatcher alloc] init];
+  self.updates = [NSMutableArray array];
+  [[NSNotificationCenter defaultCenter] addObserver:self
+                                           selector:@selector(keyboardWillUpdate:)
+                                               name:MDCKeyboardWatcherKeyboardWillUpdateNotification
+                                             object:self.watcher];
+}
+
+- (void)tearDown {
+  [[NSNotificationCenter defaultCenter] removeObserver:self];
+  self.watcher = nil;
+  self.updates = nil;
+
+  [super tearDown];
+}
+
+- (void)keyboardWillUpdate:(NSNotification *)notification {
+  [self.updates addObject:notification];
+}
+
+#pragma mark - Keyboard notification sequences
+
+- (CGRect)onscreenKeyboardFrameWithHeight:(CGFloat)height {
+  CGRect screenBounds = [UIScreen mainScreen].bounds;
+  return CGRectMake(0, CGRectGetMaxY(screenBounds) - height, CGRectGetWidth(screenBounds), height);
+}
+
+- (CGRect)offscreenKeyboardFrameWithHeight:(CGFloat)height {
+  CGRect screenBounds = [UIScreen mainScreen].bounds;
+  return CGRectMake(0, CGRectGetMaxY(screenBounds), CGRectGetWidth(screenBounds), height);
+}
+
+- (NSDictionary *)userInfoFromFrame:(CGRect)beginFrame
+                            toFrame:(CGRect)endFrame
+                           duration:(NSTimeInterval)duration {
+  return @{
+    UIKeyboardFrameBeginUserInfoKey : [NSValue valueWithCGRect:beginFrame],
+    UIKeyboardFrameEndUserInfoKey : [NSValue valueWithCGRect:endFrame],
+    UIKeyboardAnimationDurationUserInfoKey : @(duration),
+    UIKeyboardAnimationCurveUserInfoKey : @(kKeyboardAnimationCurve),
+  };
+}
+
+/** Posts the notifications of one run loop turn, then lets the run loop go to sleep. */
+- (void)replayTurn:(NSArray<NSArray *> *)turn {
+  for (NSArray *notification in turn) {
+    [[NSNotificationCenter defaultCenter] postNotificationName:notification[0]
+                                                        object:nil
+                                                      userInfo:notification[1]];
+  }
+  [[NSRunLoop mainRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.01]];
+}
+
+/** Keyboard appearance on iOS 9 to 12: frame change first, then show, with identical info. */
+- (NSArray<NSArray *> *)showTurnFromiOS9 {
+  NSDictionary *userInfo =
+      [self userInfoFromFrame:[self offscreenKeyboardFrameWithHeight:kKeyboardHeight]
+                      toFrame:[self onscreenKeyboardFrameWithHeight:kKeyboardHeight]
+                     duration:0.25];
+  return @[
+    @[ UIKeyboardWillChangeFrameNotification, userInfo ],
+    @[ UIKeyboardWillShowNotification, userInfo ],
+  ];
+}
+
+/**
+ Keyboard appearance on iOS 13 and later with the QuickType bar: the keyboard shows at its
+ final height immediately, and a second show follows in the same turn once the bar is added.
+ */
+- (NSArray<NSArray *> *)showTurnFromiOS13 {
+  NSDictionary *firstUserInfo =
+      [self userInfoFromFrame:[self offscreenKeyboardFrameWithHeight:kKeyboardHeight]
+                      toFrame:[self onscreenKeyboardFrameWithHeight:kKeyboardHeight]
+                     duration:0.25];
+  NSDictionary *secondUserInfo =
+      [self userInfoFromFrame:[self onscreenKeyboardFrameWithHeight:kKeyboardHeight]
+                      toFrame:[self onscreenKeyboardFrameWithHeight:kKeyboardHeightWithQuickType]
+                     duration:0];
+  return @[
+    @[ UIKeyboardWillChangeFrameNotification, firstUserInfo ],
+    @[ UIKeyboardWillShowNotification, firstUserInfo ],
+    @[ UIKeyboardWillChangeFrameNotification, secondUserInfo ],
+    @[ UIKeyboardWillShowNotification, secondUserInfo ],
+  ];
+}
+
+/** Keyboard dismissal on all supported versions: frame change first, then hide. */
+- (NSArray<NSArray *> *)hideTurn {
+  NSDictionary *userInfo =
+      [self userInfoFromFrame:[self onscreenKeyboardFrameWithHeight:kKeyboardHeight]
+                      toFrame:[self offscreenKeyboardFrameWithHeight:kKeyboardHeight]
+                     duration:0.25];
+  return @[
+    @[ UIKeyboardWillChangeFrameNotification, userInfo ],
+    @[ UIKeyboardWillHideNotification, userInfo ],
+  ];
+}
+
+/** Undocking an iPad keyboard: a single unanimated frame change away from the screen bottom. */
+- (NSArray<NSArray *> *)undockTurn {
+  CGRect dockedFrame = [self onscreenKeyboardFrameWithHeight:kKeyboardHeight];
+  CGRect undockedFrame = CGRectOffset(dockedFrame, 0, -100);
+  return @[
+    @[
+      UIKeyboardWillChangeFrameNotification,
+      [self userInfoFromFrame:dockedFrame toFrame:undockedFrame duration:0]
+    ],
+  ];
+}
+
+#pragma mark - Tests
+
+- (void)testShowFromiOS9IsCoalescedIntoOneUpdate {
+  // When
+  [self replayTurn:[self showTurnFromiOS9]];
+
+  // Then
+  XCTAssertEqual(self.updates.count, 1U);
+  XCTAssertEqualWithAccuracy(self.watcher.visibleKeyboardHeight, kKeyboardHeight, 0.001);
+  XCTAssertEqualWithAccuracy(
+      [MDCKeyboardWatcher animationDurationFromKeyboardNotification:self.updates.firstObject], 0.25,
+      0.001);
+}
+
+- (void)testShowFromiOS13KeepsFirstBeginFrameLastEndFrameAndTheAnimation {
+  // When
+  [self replayTurn:[self showTurnFromiOS13]];
+
+  // Then
+  XCTAssertEqual(self.updates.count, 1U);
+  NSDictionary *userInfo = self.updates.firstObject.userInfo;
+  XCTAssertTrue(CGRectEqualToRect([userInfo[UIKeyboardFrameBeginUserInfoKey] CGRectValue],
+                                  [self offscreenKeyboardFrameWithHeight:kKeyboardHeight]));
+  XCTAssertTrue(
+      CGRectEqualToRect([userInfo[UIKeyboardFrameEndUserInfoKey] CGRectValue],
+                        [self onscreenKeyboardFrameWithHeight:kKeyboardHeightWithQuickType]));
+  XCTAssertEqualWithAccuracy([userInfo[UIKeyboardAnimationDurationUserInfoKey] doubleValue], 0.25,
+                             0.001);
+  XCTAssertEqualWithAccuracy(self.watcher.visibleKeyboardHeight, kKeyboardHeightWithQuickType,
+                             0.001);
+}
+
+- (void)testShowThenHideInSeparateTurnsPostsOneUpdateEach {
+  // When
+  [self replayTurn:[self showTurnFromiOS9]];
+  CGFloat shownHeight = self.watcher.visibleKeyboardHeight;
+  [self replayTurn:[self hideTurn]];
+
+  // Then
+  XCTAssertEqual(self.updates.count, 2U);
+  XCTAssertEqualWithAccuracy(shownHeight, kKeyboardHeight, 0.001);
+  XCTAssertEqualWithAccuracy(self.watcher.visibleKeyboardHeight, 0, 0.001);
+}
+
+- (void)testUndockingIsASingleUpdateWithNoVisibleKeyboard {
+  // Given
+  [self replayTurn:[self showTurnFromiOS9]];
+
+  // When
+  [self replayTurn:[self undockTurn]];
+
+  // Then
+  XCTAssertEqual(self.updates.count, 2U);
+  XCTAssertEqualWithAccuracy(self.watcher.visibleKeyboardHeight, 0, 0.001);
+}
+
+- (void)testIndividualNotificationsAreStillPosted {
+  // Given
+  __block NSUInteger individualNotificationCount = 0;
+  id observer = [[NSNotificationCenter defaultCenter]
+      addObserverForName:MDCKeyboardWatcherKeyboardWillShowNotification
+                  object:self.watcher
+                   queue:nil
+              usingBlock:^(__unused NSNotification *notification) {
+                individualNotificationCount += 1;
+              }];
+
+  // When
+  [self replayTurn:[self showTurnFromiOS13]];
+  [[NSNotificationCenter defaultCenter] removeObserver:observer];
+
+  // Then
+  XCTAssertEqual(individualNotificationCount, 2U);
+  XCTAssertEqual(self.updates.count, 1U);
+}
+
+- (void)testNoUpdateIsPostedWithoutKeyboardNotifications {
+  // When
+  [[NSRunLoop mainRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.01]];
+
+  // Then
+  XCTAssertEqual(self.updates.count, 0U);
+}
+
+@end
@@ -69,7 +69,9 @@ static NSString *const MDCOverlayTransitionTimingFunctionKey = @"timingFunction"
 /**
  This key indicates that the given overlay change needs to animate immediately.
 
- Some animations, such as the iOS keyboard animation, need to run immediately (and cannot be
- coalesced). Should be an NSNumber containing a BOOL.
+ Some animations, such as the iOS keyboard animation, need to run immediately. The change is still
+ merged with the other changes of the same runloop, which are all delivered before Core Animation
+ commits, but its animation parameters take precedence over theirs. Should be an NSNumber
+ containing a BOOL.
  */
 static NSString *const MDCOverlayTransitionImmediacyKey = @"runImmediately";
@@ -31,14 +31,62 @@
 #define MDC_UNUSED_IN_RELEASE
 #endif
 
+/** The signature of the actions registered with @c -addTarget:action:. */
+typedef void (*MDCOverlayObserverActionFunction)(id, SEL, id<MDCOverlayTransitioning>);
+
+/** A registered action, with the implementation resolved once at registration. */
+@interface MDCOverlayObserverAction : NSObject
+
+@property(nonatomic, readonly) SEL action;
+
+/** Calls the action on the target, unless the target has been deallocated. */
+@property(nonatomic, readonly) void (^handler)(id<MDCOverlayTransitioning> transition);
+
+- (instancetype)initWithTarget:(id)target action:(SEL)action;
+
+@end
+
+@implementation MDCOverlayObserverAction
+
+- (instancetype)initWithTarget:(id)target action:(SEL)action {
+  self = [super init];
+  if (self != nil) {
+    _action = action;
+    __weak id weakTarget = target;
+    MDCOverlayObserverActionFunction function =
+        (MDCOverlayObserverActionFunction)[target methodForSelector:action];
+    _handler = ^(id<MDCOverlayTransitioning> transition) {
+      id strongTarget = weakTarget;
+      if (strongTarget != nil) {
+        function(strongTarget, action, transition);
+      }
+    };
+  }
+  return self;
+}
+
+@end
+
 @interface MDCOverlayObserver () <MDCOverlayAnimationObserverDelegate>
 
-/** The list of overlays currently known to this observer. */
+/** The overlays currently known to this observer, keyed by identifier. */
 @property(nonatomic) NSMutableDictionary *overlays;
 
+/** The overlays currently known to this observer, kept sorted by identifier. */
+@property(nonatomic) NSMutableArray<MDCOverlayObserverOverlay *> *mutableSortedOverlays;
+
+/** An immutable copy of @c mutableSortedOverlays, or nil if the overlays changed since. */
+@property(nonatomic, copy) NSArray<MDCOverlayObserverOverlay *> *sortedOverlaysSnapshot;
+
 /** The currently-pending transition. */
 @property(nonatomic) MDCOverlayObserverTransition *pendingTransition;
 
+/**
+ Whether the timing of @c pendingTransition came from a change that asked to run immediately, in
+ which case later changes in the same runloop don't override it.
+ */
+@property(nonatomic) BOOL pendingTransitionHasImmediateTiming;
+
 /** The table holding the target-action mapping. */
 @property(nonatomic) NSMapTable *actionTable;
 
@@ -68,6 +116,7 @@ static MDCOverlayObserver *_sOverlayObserver;
   self = [super init];
   if (self != nil) {
     _overlays = [NSMutableDictionary dictionary];
+    _mutableSortedOverlays = [NSMutableArray array];
     _observer = [[MDCOverlayAnimationObserver alloc] init];
     _observer.delegate = self;
 
@@ -105,24 +154,49 @@ static MDCOverlayObserver *_sOverlayObserver;
     overlay = [[MDCOverlayObserverOverlay alloc] init];
     overlay.identifier = identifier;
     self.overlays[identifier] = overlay;
+
+    NSUInteger index = [self indexOfSortedOverlay:overlay
+                                          options:NSBinarySearchingInsertionIndex];
+    [self.mutableSortedOverlays insertObject:overlay atIndex:index];
+    self.sortedOverlaysSnapshot = nil;
   }
 
   return overlay;
 }
 
 - (void)removeOverlayWithIdentifier:(NSString *)identifier {
+  MDCOverlayObserverOverlay *overlay = self.overlays[identifier];
+  if (overlay == nil) {
+    return;
+  }
+
+  NSUInteger index = [self indexOfSortedOverlay:overlay options:NSBinarySearchingFirstEqual];
+  if (index != NSNotFound) {
+    [self.mutableSortedOverlays removeObjectAtIndex:index];
+    self.sortedOverlaysSnapshot = nil;
+  }
   [self.overlays removeObjectForKey:identifier];
 }
 
-- (NSArray *)sortedOverlays {
-  NSArray *sortedKeys = [[self.overlays allKeys] sortedArrayUsingSelector:@selector(compare:)];
+- (NSUInteger)indexOfSortedOverlay:(MDCOverlayObserverOverlay *)overlay
+                           options:(NSBinarySearchingOptions)options {
+  return [self.mutableSortedOverlays
+        indexOfObject:overlay
+        inSortedRange:NSMakeRange(0, self.mutableSortedOverlays.count)
+              options:options
+      usingComparator:^NSComparisonResult(MDCOverlayObserverOverlay *overlay1,
+                                          MDCOverlayObserverOverlay *overlay2) {
+        return [overlay1.identifier compare:overlay2.identifier];
+      }];
+}
 
-  NSMutableArray *result = [NSMutableArray array];
-  for (NSString *key in sortedKeys) {
-    [result addObject:self.overlays[key]];
+- (NSArray *)sortedOverlays {
+  // Overlays are only added or removed when they appear or disappear, so the same snapshot is
+  // usually handed to many transitions in a row.
+  if (self.sortedOverlaysSnapshot == nil) {
+    self.sortedOverlaysSnapshot = self.mutableSortedOverlays;
   }
-
-  return result;
+  return self.sortedOverlaysSnapshot;
 }
 
 #pragma mark - Input Sources
@@ -175,72 +249,54 @@ static MDCOverlayObserver *_sOverlayObserver;
     }
   }
 
-  // If we were given a duration, then update the animation parameters.
-  if (self.pendingTransition != nil && duration != nil) {
+  // If we were given a duration, then update the animation parameters. Changes that have to run
+  // immediately, such as the keyboard's, dictate the timing of the merged transition. The
+  // transition itself still runs once at the end of the runloop, before Core Animation commits, so
+  // it animates together with them.
+  BOOL runImmediately = ((NSNumber *)userInfo[MDCOverlayTransitionImmediacyKey]).boolValue;
+  if (self.pendingTransition != nil && duration != nil &&
+      (runImmediately || !self.pendingTransitionHasImmediateTiming)) {
     self.pendingTransition.duration = duration.doubleValue;
     self.pendingTransition.customTimingFunction = userInfo[MDCOverlayTransitionTimingFunctionKey];
     self.pendingTransition.animationCurve =
         ((NSNumber *)userInfo[MDCOverlayTransitionCurveKey]).integerValue;
-
-    // If this update requires us to run the animation immediately, go ahead and fire it off.
-    NSNumber *runImmediately = userInfo[MDCOverlayTransitionImmediacyKey];
-    if (runImmediately.boolValue) {
-      [self fireTransition];
-    }
+    self.pendingTransitionHasImmediateTiming = runImmediately;
   }
 }
 
 #pragma mark - Target/Action
 
-- (NSInvocation *)buildInvocationForTarget:(id)target action:(SEL)action {
-  NSMethodSignature *signature = [target methodSignatureForSelector:action];
-  NSInvocation *invocation = [NSInvocation invocationWithMethodSignature:signature];
-  [invocation setTarget:target];
-  [invocation setSelector:action];
-
-  return invocation;
-}
-
-- (void)invokeTarget:(NSInvocation *)invocation
-      withTransition:(MDCOverlayObserverTransition *)transition {
-  NSParameterAssert(invocation != nil);
-  NSParameterAssert(transition != nil);
+- (NSUInteger)indexOfActionForTarget:(id)target action:(SEL)action {
+  NSMutableArray<MDCOverlayObserverAction *> *actions = [self.actionTable objectForKey:target];
 
-  [invocation setArgument:&transition atIndex:2];
-  [invocation invoke];
-}
-
-- (NSUInteger)indexOfInvocationForTarget:(id)target action:(SEL)action {
-  NSMutableArray *invocations = [self.actionTable objectForKey:target];
-
-  if (invocations == nil) {
+  if (actions == nil) {
     return NSNotFound;
   }
 
-  return [invocations indexOfObjectPassingTest:^BOOL(NSInvocation *invocation,
-                                                     __unused NSUInteger idx, __unused BOOL *stop) {
-    return invocation.selector == action;
+  return [actions indexOfObjectPassingTest:^BOOL(MDCOverlayObserverAction *registeredAction,
+                                                 __unused NSUInteger idx, __unused BOOL *stop) {
+    return registeredAction.action == action;
   }];
 }
 
 - (void)addTarget:(id)target action:(SEL)action {
   NSParameterAssert(target != nil);
 
-  NSUInteger foundIndex = [self indexOfInvocationForTarget:target action:action];
+  NSUInteger foundIndex = [self indexOfActionForTarget:target action:action];
   if (foundIndex != NSNotFound) {
     return;
   }
 
-  NSInvocation *invocation = [self buildInvocationForTarget:target action:action];
-  NSParameterAssert(invocation != nil);
+  MDCOverlayObserverAction *registeredAction =
+      [[MDCOverlayObserverAction alloc] initWithTarget:target action:action];
 
-  NSMutableArray *invocations = [self.actionTable objectForKey:target];
-  if (invocations == nil) {
-    invocations = [NSMutableArray array];
-    [self.actionTable setObject:invocations forKey:target];
+  NSMutableArray<MDCOverlayObserverAction *> *actions = [self.actionTable objectForKey:target];
+  if (actions == nil) {
+    actions = [NSMutableArray array];
+    [self.actionTable setObject:actions forKey:target];
   }
 
-  [invocations addObject:invocation];
+  [actions addObject:registeredAction];
 
   if (self.overlays.count > 0) {
     // If there's already a pending transition, let the runloop take care of it, otherwise create
@@ -250,7 +306,7 @@ static MDCOverlayObserver *_sOverlayObserver;
       MDCOverlayObserverTransition *transition = [[MDCOverlayObserverTransition alloc] init];
       transition.overlays = [self sortedOverlays];
 
-      [self invokeTarget:invocation withTransition:transition];
+      registeredAction.handler(transition);
 
       // Run the (non-animated) transition.
       [transition runAnimation];
@@ -267,17 +323,17 @@ static MDCOverlayObserver *_sOverlayObserver;
 - (void)removeTarget:(id)target action:(SEL)action {
   NSParameterAssert(target != nil);
 
-  NSUInteger foundIndex = [self indexOfInvocationForTarget:target action:action];
+  NSUInteger foundIndex = [self indexOfActionForTarget:target action:action];
 
   if (foundIndex != NSNotFound) {
-    NSMutableArray *invocations = [self.actionTable objectForKey:target];
+    NSMutableArray<MDCOverlayObserverAction *> *actions = [self.actionTable objectForKey:target];
 
-    if (invocations.count == 1) {
-      // Clean up all the invocations if this was the only one.
+    if (actions.count == 1) {
+      // Clean up all the actions if this was the only one.
       [self removeTarget:target];
     } else {
-      // Otherwise remove this single invocation.
-      [invocations removeObjectAtIndex:foundIndex];
+      // Otherwise remove this single action.
+      [actions removeObjectAtIndex:foundIndex];
     }
   }
 }
@@ -289,21 +345,28 @@ static MDCOverlayObserver *_sOverlayObserver;
     return;
   }
 
+  MDCOverlayObserverTransition *transition = self.pendingTransition;
+  self.pendingTransition = nil;
+  self.pendingTransitionHasImmediateTiming = NO;
+
   // Update the transition with the latest set of overlays.
-  self.pendingTransition.overlays = [self sortedOverlays];
+  transition.overlays = [self sortedOverlays];
 
-  // Call all of our targets and let them know a transition has happened.
+  // Collect the handlers first, since targets may add or remove targets when they are called.
+  NSMutableArray *handlers = [NSMutableArray array];
   for (id target in self.actionTable) {
-    NSArray *invocations = [self.actionTable objectForKey:target];
-    for (NSInvocation *invocation in invocations) {
-      [self invokeTarget:invocation withTransition:self.pendingTransition];
+    for (MDCOverlayObserverAction *registeredAction in [self.actionTable objectForKey:target]) {
+      [handlers addObject:registeredAction.handler];
     }
   }
 
-  // Actually run the transition animation.
-  [self.pendingTransition runAnimation];
+  // Call all of our targets and let them know a transition has happened.
+  for (void (^handler)(id<MDCOverlayTransitioning>) in handlers) {
+    handler(transition);
+  }
 
-  self.pendingTransition = nil;
+  // Actually run the transition animation.
+  [transition runAnimation];
 }
 
 - (void)animationObserverDidEndRunloop:(__unused MDCOverlayAnimationObserver *)observer {
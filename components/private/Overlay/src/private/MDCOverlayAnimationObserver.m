@@ -14,6 +14,8 @@
 
 #import "MDCOverlayAnimationObserver.h"
 
+#import "MaterialApplication.h"
+
 @interface MDCOverlayAnimationObserver () {
  @public
   /** Whether or not the observer has been primed and should report a runloop end event. */
@@ -74,7 +76,7 @@ static void runloopObserverCallback(__unused CFRunLoopObserverRef observer,
   CFRunLoopObserverRef observer =
       CFRunLoopObserverCreate(kCFAllocatorDefault, kCFRunLoopBeforeWaiting,
                               YES,  // Repeats
-                              0,    // Order. Lower == earlier.
+                              MDCOverlayAnimationRunLoopObserverOrder,
                               &runloopObserverCallback, &context);
 
   if (observer != NULL) {
@@ -98,8 +100,9 @@ static void runloopObserverCallback(__unused CFRunLoopObserverRef observer,
 }
 
 - (void)handleObserverFired {
-  [self.delegate animationObserverDidEndRunloop:self];
+  // Unprime first, so that the delegate can prime the observer again for the next runloop.
   _primed = NO;
+  [self.delegate animationObserverDidEndRunloop:self];
 }
 
 @end
@@ -0,0 +1,198 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialOverlay.h"
+
+/** Records the transitions it is called with. */
+@interface OverlayObserverTestTarget : NSObject
+@property(nonatomic, strong) NSMutableArray<id<MDCOverlayTransitioning>> *transitions;
+@property(nonatomic, strong) NSMutableArray<NSArray<NSString *> *> *overlayIdentifiers;
+@end
+
+@implementation OverlayObserverTestTarget
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _transitions = [NSMutableArray array];
+    _overlayIdentifiers = [NSMutableArray array];
+  }
+  return self;
+}
+
+- (void)overlaysDidChange:(id<MDCOverlayTransitioning>)transition {
+  [self.transitions addObject:transition];
+  NSMutableArray<NSString *> *identifiers = [NSMutableArray array];
+  [transition enumerateOverlays:^(id<MDCOverlay> overlay, __unused NSUInteger idx,
+                                  __unused BOOL *stop) {
+    [identifiers addObject:overlay.identifier];
+  }];
+  [self.overlayIdentifiers addObject:identifiers];
+}
+
+@end
+
+@interface OverlayObserverTests : XCTestCase
+@property(nonatomic, strong, nullable) MDCOverlayObserver *observer;
+@property(nonatomic, strong, nullable) OverlayObserverTestTarget *target;
+@end
+
+@implementation OverlayObserverTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.observer = [[MDCOverlayObserver alloc] init];
+  self.target = [[OverlayObserverTestTarget alloc] init];
+  [self.observer addTarget:self.target action:@selector(overlaysDidChange:)];
+}
+
+- (void)tearDown {
+  [self.observer removeTarget:self.target];
+  self.observer = nil;
+  self.target = nil;
+
+  [super tearDown];
+}
+
+- (void)postChangeForOverlay:(NSString *)identifier
+                       frame:(CGRect)frame
+                    duration:(NSTimeInterval)duration
+              runImmediately:(BOOL)runImmediately {
+  [[NSNotificationCenter defaultCenter]
+      postNotificationName:MDCOverlayDidChangeNotification
+                    object:nil
+                  userInfo:@{
+                    MDCOverlayIdentifierKey : identifier,
+                    MDCOverlayFrameKey : [NSValue valueWithCGRect:frame],
+                    MDCOverlayTransitionDurationKey : @(duration),
+                    MDCOverlayTransitionImmediacyKey : @(runImmediately),
+                  }];
+}
+
+/** Lets the runloop finish the current turn, which is when transitions are delivered. */
+- (void)endFrame {
+  [[NSRunLoop mainRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:0.01]];
+}
+
+- (void)testChangesWithinOneFrameAreDeliveredAsOneTransition {
+  // When
+  [self postChangeForOverlay:@"snackbar"
+                       frame:CGRectMake(0, 500, 320, 48)
+                    duration:0.2
+              runImmediately:NO];
+  [self postChangeForOverlay:@"keyboard"
+                       frame:CGRectMake(0, 300, 320, 260)
+                    duration:0.25
+              runImmediately:YES];
+  [self postChangeForOverlay:@"bottomSheet"
+                       frame:CGRectMake(0, 400, 320, 160)
+                    duration:0.3
+              runImmediately:NO];
+  [self postChangeForOverlay:@"snackbar"
+                       frame:CGRectMake(0, 252, 320, 48)
+                    duration:0.2
+              runImmediately:NO];
+  NSUInteger callbacksBeforeEndOfFrame = self.target.transitions.count;
+  [self endFrame];
+
+  // Then
+  XCTAssertEqual(callbacksBeforeEndOfFrame, 0U);
+  XCTAssertEqual(self.target.transitions.count, 1U);
+  NSArray<NSString *> *expectedIdentifiers = @[ @"bottomSheet", @"keyboard", @"snackbar" ];
+  XCTAssertEqualObjects(self.target.overlayIdentifiers.firstObject, expectedIdentifiers);
+  XCTAssertEqualWithAccuracy(self.target.transitions.firstObject.duration, 0.25, 0.001);
+}
+
+- (void)testEachFrameWithChangesDeliversOneTransition {
+  // When
+  for (NSUInteger frame = 0; frame < 3; ++frame) {
+    CGFloat offset = 10 * (CGFloat)frame;
+    [self postChangeForOverlay:@"snackbar"
+                         frame:CGRectMake(0, 500 - offset, 320, 48)
+                      duration:0
+                runImmediately:NO];
+    [self postChangeForOverlay:@"bottomSheet"
+                         frame:CGRectMake(0, 400 - offset, 320, 160)
+                      duration:0
+                runImmediately:NO];
+    [self endFrame];
+  }
+  [self endFrame];
+
+  // Then
+  XCTAssertEqual(self.target.transitions.count, 3U);
+}
+
+- (void)testUnchangedFramesDeliverNoTransition {
+  // Given
+  [self postChangeForOverlay:@"snackbar"
+                       frame:CGRectMake(0, 500, 320, 48)
+                    duration:0
+              runImmediately:NO];
+  [self endFrame];
+
+  // When
+  [self postChangeForOverlay:@"snackbar"
+                       frame:CGRectMake(0, 500, 320, 48)
+                    duration:0
+              runImmediately:NO];
+  [self endFrame];
+
+  // Then
+  XCTAssertEqual(self.target.transitions.count, 1U);
+}
+
+- (void)testRemovedOverlaysAreNotReported {
+  // Given
+  [self postChangeForOverlay:@"snackbar"
+                       frame:CGRectMake(0, 500, 320, 48)
+                    duration:0
+              runImmediately:NO];
+  [self postChangeForOverlay:@"keyboard"
+                       frame:CGRectMake(0, 300, 320, 260)
+                    duration:0
+              runImmediately:NO];
+  [self endFrame];
+
+  // When
+  [self postChangeForOverlay:@"keyboard" frame:CGRectZero duration:0 runImmediately:NO];
+  [self endFrame];
+
+  // Then
+  XCTAssertEqualObjects(self.target.overlayIdentifiers.lastObject, @[ @"snackbar" ]);
+}
+
+- (void)testRemovedTargetIsNotCalled {
+  // Given
+  OverlayObserverTestTarget *secondTarget = [[OverlayObserverTestTarget alloc] init];
+  [self.observer addTarget:secondTarget action:@selector(overlaysDidChange:)];
+  [self.observer removeTarget:self.target];
+
+  // When
+  [self postChangeForOverlay:@"snackbar"
+                       frame:CGRectMake(0, 500, 320, 48)
+                    duration:0
+              runImmediately:NO];
+  [self endFrame];
+
+  // Then
+  XCTAssertEqual(self.target.transitions.count, 0U);
+  XCTAssertEqual(secondTarget.transitions.count, 1U);
+  [self.observer removeTarget:secondTarget];
+}
+
+@end
@@ -0,0 +1,118 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <UIKit/UIKit.h>
+
+/** The error domain of errors returned when decoding a scroll trace. */
+FOUNDATION_EXTERN NSString *_Nonnull const MDCScrollTraceErrorDomain;
+
+/** Error codes in MDCScrollTraceErrorDomain. */
+typedef NS_ENUM(NSInteger, MDCScrollTraceErrorCode) {
+  /** The data does not start with the scroll trace magic number. */
+  MDCScrollTraceErrorCodeInvalidFormat = 1,
+
+  /** The data was written by a newer, incompatible version of the format. */
+  MDCScrollTraceErrorCodeUnsupportedVersion = 2,
+
+  /** The data is shorter than its header claims. */
+  MDCScrollTraceErrorCodeTruncated = 3,
+};
+
+/** A single scroll view state captured while recording. */
+typedef struct MDCScrollTraceSample {
+  /** Seconds since the first sample of the trace. */
+  CFTimeInterval timestamp;
+
+  /** The scroll view's content offset. */
+  CGPoint contentOffset;
+
+  /** The rate of change of the content offset, in points per second. */
+  CGPoint velocity;
+} MDCScrollTraceSample;
+
+/**
+ An immutable, time-ordered sequence of scroll view content offsets and velocities.
+
+ Traces are recorded with MDCScrollTraceRecorder, stored with @c dataRepresentation and replayed
+ against scroll-driven components with MDCScrollTraceReplayer.
+
+ ## Binary format
+
+ All values are little-endian. A 16 byte header holds the magic number @c 'MDST', a 16 bit format
+ version, 16 reserved bits, a 32 bit sample count and 32 reserved bits. It is followed by one
+ 20 byte record per sample holding the timestamp, content offset x and y and velocity x and y as
+ 32 bit floats.
+ */
+@interface MDCScrollTrace : NSObject
+
+/**
+ Creates a trace from @c count samples. Samples must be ordered by timestamp.
+ */
+- (nonnull instancetype)initWithSamples:(nonnull const MDCScrollTraceSample *)samples
+                                  count:(NSUInteger)count NS_DESIGNATED_INITIALIZER;
+
+/**
+ Decodes a trace from data produced by @c dataRepresentation.
+
+ Returns nil and sets @c error if the data isn't a valid scroll trace.
+ */
+- (nullable instancetype)initWithData:(nonnull NSData *)data
+                                error:(NSError *_Nullable *_Nullable)error;
+
+/** Decodes the trace stored at @c url. */
++ (nullable instancetype)traceWithContentsOfURL:(nonnull NSURL *)url
+                                          error:(NSError *_Nullable *_Nullable)error;
+
+/**
+ Creates a trace of a scroll view decelerating from @c contentOffset after being released at
+ @c velocity, sampled every @c sampleInterval seconds until the velocity drops below 1pt/s.
+
+ @c decelerationRate has the same meaning as UIScrollView's decelerationRate.
+ */
++ (nonnull instancetype)decelerationTraceFromContentOffset:(CGPoint)contentOffset
+                                                  velocity:(CGPoint)velocity
+                                          decelerationRate:(CGFloat)decelerationRate
+                                            sampleInterval:(NSTimeInterval)sampleInterval;
+
+/**
+ Creates a trace that visits each of @c contentOffsetYs, one every @c sampleInterval seconds.
+ Velocities are derived from consecutive offsets.
+ */
++ (nonnull instancetype)traceWithContentOffsetYs:(nonnull NSArray<NSNumber *> *)contentOffsetYs
+                                  sampleInterval:(NSTimeInterval)sampleInterval;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+/** The number of samples in the trace. */
+@property(nonatomic, readonly) NSUInteger count;
+
+/** The timestamp of the last sample. */
+@property(nonatomic, readonly) CFTimeInterval duration;
+
+/** Returns the sample at @c index. */
+- (MDCScrollTraceSample)sampleAtIndex:(NSUInteger)index;
+
+/**
+ Returns the state of the scroll view at @c time, linearly interpolated between the surrounding
+ samples. Times outside of the trace are clamped to its first or last sample.
+ */
+- (MDCScrollTraceSample)sampleAtTime:(CFTimeInterval)time;
+
+/** Encodes the trace in the binary format described above. */
+- (nonnull NSData *)dataRepresentation;
+
+/** Writes @c dataRepresentation to @c url. */
+- (BOOL)writeToURL:(nonnull NSURL *)url error:(NSError *_Nullable *_Nullable)error;
+
+@end
@@ -0,0 +1,238 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCScrollTrace.h"
+
+NSString *const MDCScrollTraceErrorDomain = @"MDCScrollTraceErrorDomain";
+
+// 'MDST' in little-endian byte order.
+static const uint32_t kMagic = 0x5453444D;
+static const uint16_t kVersion = 1;
+static const NSUInteger kHeaderLength = 16;
+static const NSUInteger kFieldsPerSample = 5;
+static const NSUInteger kSampleLength = kFieldsPerSample * sizeof(uint32_t);
+
+// The maximum number of samples generated for a synthetic deceleration trace.
+static const NSUInteger kMaximumDecelerationSampleCount = 10000;
+
+static void AppendUInt32(NSMutableData *data, uint32_t value) {
+  uint32_t littleEndianValue = CFSwapInt32HostToLittle(value);
+  [data appendBytes:&littleEndianValue length:sizeof(littleEndianValue)];
+}
+
+static void AppendUInt16(NSMutableData *data, uint16_t value) {
+  uint16_t littleEndianValue = CFSwapInt16HostToLittle(value);
+  [data appendBytes:&littleEndianValue length:sizeof(littleEndianValue)];
+}
+
+static void AppendFloat(NSMutableData *data, double value) {
+  Float32 floatValue = (Float32)value;
+  uint32_t bits;
+  memcpy(&bits, &floatValue, sizeof(bits));
+  AppendUInt32(data, bits);
+}
+
+static uint32_t ReadUInt32(const uint8_t *bytes) {
+  uint32_t value;
+  memcpy(&value, bytes, sizeof(value));
+  return CFSwapInt32LittleToHost(value);
+}
+
+static uint16_t ReadUInt16(const uint8_t *bytes) {
+  uint16_t value;
+  memcpy(&value, bytes, sizeof(value));
+  return CFSwapInt16LittleToHost(value);
+}
+
+static CGFloat ReadFloat(const uint8_t *bytes) {
+  uint32_t bits = ReadUInt32(bytes);
+  Float32 value;
+  memcpy(&value, &bits, sizeof(value));
+  return (CGFloat)value;
+}
+
+static NSError *TraceError(MDCScrollTraceErrorCode code, NSString *description) {
+  return [NSError errorWithDomain:MDCScrollTraceErrorDomain
+                             code:code
+                         userInfo:@{NSLocalizedDescriptionKey : description}];
+}
+
+static CGFloat Interpolate(CGFloat from, CGFloat to, CGFloat progress) {
+  return from + (to - from) * progress;
+}
+
+@implementation MDCScrollTrace {
+  NSData *_samples;  // [MDCScrollTraceSample]
+}
+
+- (instancetype)initWithSamples:(const MDCScrollTraceSample *)samples count:(NSUInteger)count {
+  self = [super init];
+  if (self) {
+    _samples = [NSData dataWithBytes:samples length:count * sizeof(MDCScrollTraceSample)];
+    _count = count;
+    _duration = count > 0 ? samples[count - 1].timestamp : 0;
+  }
+  return self;
+}
+
+- (instancetype)initWithData:(NSData *)data error:(NSError **)error {
+  const uint8_t *bytes = data.bytes;
+  if (data.length < kHeaderLength || ReadUInt32(bytes) != kMagic) {
+    if (error) {
+      *error = TraceError(MDCScrollTraceErrorCodeInvalidFormat, @"Not a scroll trace.");
+    }
+    return nil;
+  }
+  if (ReadUInt16(bytes + 4) > kVersion) {
+    if (error) {
+      *error = TraceError(MDCScrollTraceErrorCodeUnsupportedVersion,
+                          @"The scroll trace was written by a newer version of the format.");
+    }
+    return nil;
+  }
+  NSUInteger count = ReadUInt32(bytes + 8);
+  if (data.length < kHeaderLength + count * kSampleLength) {
+    if (error) {
+      *error = TraceError(MDCScrollTraceErrorCodeTruncated, @"The scroll trace is truncated.");
+    }
+    return nil;
+  }
+
+  NSMutableData *samples = [NSMutableData dataWithLength:count * sizeof(MDCScrollTraceSample)];
+  MDCScrollTraceSample *sampleBytes = samples.mutableBytes;
+  for (NSUInteger i = 0; i < count; ++i) {
+    const uint8_t *record = bytes + kHeaderLength + i * kSampleLength;
+    sampleBytes[i].timestamp = ReadFloat(record);
+    sampleBytes[i].contentOffset = CGPointMake(ReadFloat(record + 4), ReadFloat(record + 8));
+    sampleBytes[i].velocity = CGPointMake(ReadFloat(record + 12), ReadFloat(record + 16));
+  }
+  return [self initWithSamples:sampleBytes count:count];
+}
+
++ (instancetype)traceWithContentsOfURL:(NSURL *)url error:(NSError **)error {
+  NSData *data = [NSData dataWithContentsOfURL:url options:0 error:error];
+  if (!data) {
+    return nil;
+  }
+  return [[self alloc] initWithData:data error:error];
+}
+
++ (instancetype)decelerationTraceFromContentOffset:(CGPoint)contentOffset
+                                          velocity:(CGPoint)velocity
+                                  decelerationRate:(CGFloat)decelerationRate
+                                    sampleInterval:(NSTimeInterval)sampleInterval {
+  // UIScrollView multiplies the velocity by decelerationRate every millisecond, so
+  // v(t) = v0 * rate^(1000t) and the offset is the integral of v(t).
+  CGFloat decayPerSecond = 1000 * (CGFloat)log(decelerationRate);
+  NSMutableData *samples = [NSMutableData data];
+  for (NSUInteger i = 0; i < kMaximumDecelerationSampleCount; ++i) {
+    CFTimeInterval time = i * sampleInterval;
+    CGFloat decay = (CGFloat)pow(decelerationRate, 1000 * time);
+    MDCScrollTraceSample sample;
+    sample.timestamp = time;
+    sample.velocity = CGPointMake(velocity.x * decay, velocity.y * decay);
+    sample.contentOffset = CGPointMake(contentOffset.x + velocity.x * (decay - 1) / decayPerSecond,
+                                       contentOffset.y + velocity.y * (decay - 1) / decayPerSecond);
+    [samples appendBytes:&sample length:sizeof(sample)];
+    if (hypot(sample.velocity.x, sample.velocity.y) < 1) {
+      break;
+    }
+  }
+  return [[self alloc] initWithSamples:samples.bytes
+                                 count:samples.length / sizeof(MDCScrollTraceSample)];
+}
+
++ (instancetype)traceWithContentOffsetYs:(NSArray<NSNumber *> *)contentOffsetYs
+                          sampleInterval:(NSTimeInterval)sampleInterval {
+  NSUInteger count = contentOffsetYs.count;
+  NSMutableData *samples = [NSMutableData dataWithLength:count * sizeof(MDCScrollTraceSample)];
+  MDCScrollTraceSample *sampleBytes = samples.mutableBytes;
+  for (NSUInteger i = 0; i < count; ++i) {
+    CGFloat offsetY = (CGFloat)contentOffsetYs[i].doubleValue;
+    CGFloat previousOffsetY = i > 0 ? (CGFloat)contentOffsetYs[i - 1].doubleValue : offsetY;
+    sampleBytes[i].timestamp = i * sampleInterval;
+    sampleBytes[i].contentOffset = CGPointMake(0, offsetY);
+    sampleBytes[i].velocity =
+        CGPointMake(0, (CGFloat)((offsetY - previousOffsetY) / sampleInterval));
+  }
+  return [[self alloc] initWithSamples:sampleBytes count:count];
+}
+
+- (MDCScrollTraceSample)sampleAtIndex:(NSUInteger)index {
+  NSAssert(index < _count, @"Sample index %lu is out of bounds.", (unsigned long)index);
+  return ((const MDCScrollTraceSample *)_samples.bytes)[index];
+}
+
+- (MDCScrollTraceSample)sampleAtTime:(CFTimeInterval)time {
+  const MDCScrollTraceSample *samples = _samples.bytes;
+  if (_count == 0) {
+    return (MDCScrollTraceSample){.timestamp = time};
+  }
+  if (time <= samples[0].timestamp) {
+    return samples[0];
+  }
+  if (time >= samples[_count - 1].timestamp) {
+    return samples[_count - 1];
+  }
+
+  // Binary search for the first sample after time.
+  NSUInteger low = 1;
+  NSUInteger high = _count - 1;
+  while (low < high) {
+    NSUInteger middle = low + (high - low) / 2;
+    if (samples[middle].timestamp <= time) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  MDCScrollTraceSample before = samples[low - 1];
+  MDCScrollTraceSample after = samples[low];
+  CFTimeInterval interval = after.timestamp - before.timestamp;
+  CGFloat progress = interval > 0 ? (CGFloat)((time - before.timestamp) / interval) : 1;
+
+  MDCScrollTraceSample sample;
+  sample.timestamp = time;
+  sample.contentOffset =
+      CGPointMake(Interpolate(before.contentOffset.x, after.contentOffset.x, progress),
+                  Interpolate(before.contentOffset.y, after.contentOffset.y, progress));
+  sample.velocity = CGPointMake(Interpolate(before.velocity.x, after.velocity.x, progress),
+                                Interpolate(before.velocity.y, after.velocity.y, progress));
+  return sample;
+}
+
+- (NSData *)dataRepresentation {
+  NSMutableData *data = [NSMutableData dataWithCapacity:kHeaderLength + _count * kSampleLength];
+  AppendUInt32(data, kMagic);
+  AppendUInt16(data, kVersion);
+  AppendUInt16(data, 0);
+  AppendUInt32(data, (uint32_t)_count);
+  AppendUInt32(data, 0);
+
+  const MDCScrollTraceSample *samples = _samples.bytes;
+  for (NSUInteger i = 0; i < _count; ++i) {
+    AppendFloat(data, samples[i].timestamp);
+    AppendFloat(data, samples[i].contentOffset.x);
+    AppendFloat(data, samples[i].contentOffset.y);
+    AppendFloat(data, samples[i].velocity.x);
+    AppendFloat(data, samples[i].velocity.y);
+  }
+  return data;
+}
+
+- (BOOL)writeToURL:(NSURL *)url error:(NSError **)error {
+  return [[self dataRepresentation] writeToURL:url options:NSDataWritingAtomic error:error];
+}
+
+@end
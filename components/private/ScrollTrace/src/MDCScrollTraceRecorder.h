@@ -0,0 +1,51 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <UIKit/UIKit.h>
+
+@class MDCScrollTrace;
+
+/**
+ Records the content offset and velocity of a scroll view as the user interacts with it.
+
+ A typical use is to record a trace in an example app and store its @c dataRepresentation as a test
+ resource:
+
+ @code
+ self.recorder = [[MDCScrollTraceRecorder alloc] initWithScrollView:self.collectionView];
+ [self.recorder startRecording];
+ // ...interact with the scroll view...
+ [[self.recorder stopRecording] writeToURL:url error:NULL];
+ @endcode
+
+ Must only be used on the main thread.
+ */
+@interface MDCScrollTraceRecorder : NSObject
+
+/** Creates a recorder for @c scrollView. The scroll view is not retained. */
+- (nonnull instancetype)initWithScrollView:(nonnull UIScrollView *)scrollView
+    NS_DESIGNATED_INITIALIZER;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+/** Whether the recorder is currently recording. */
+@property(nonatomic, readonly, getter=isRecording) BOOL recording;
+
+/** Starts recording, discarding any samples from a previous recording. */
+- (void)startRecording;
+
+/** Stops recording and returns the recorded trace. */
+- (nonnull MDCScrollTrace *)stopRecording;
+
+@end
@@ -0,0 +1,111 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCScrollTraceRecorder.h"
+
+#import <QuartzCore/QuartzCore.h>
+
+#import "MDCScrollTrace.h"
+
+static void *const kKVOContextMDCScrollTraceRecorder = (void *)&kKVOContextMDCScrollTraceRecorder;
+static NSString *const kContentOffsetKeyPath = @"contentOffset";
+
+@implementation MDCScrollTraceRecorder {
+  __weak UIScrollView *_scrollView;
+  // The scroll view that is being observed. Retained while recording so that KVO can be removed.
+  UIScrollView *_observedScrollView;
+  NSMutableData *_samples;  // [MDCScrollTraceSample]
+  CFTimeInterval _startTime;
+}
+
+- (instancetype)initWithScrollView:(UIScrollView *)scrollView {
+  self = [super init];
+  if (self) {
+    _scrollView = scrollView;
+    _samples = [NSMutableData data];
+  }
+  return self;
+}
+
+- (void)dealloc {
+  [self stopObserving];
+}
+
+- (BOOL)isRecording {
+  return _observedScrollView != nil;
+}
+
+- (void)startRecording {
+  [self stopObserving];
+  _samples = [NSMutableData data];
+  _startTime = CACurrentMediaTime();
+
+  _observedScrollView = _scrollView;
+  [_observedScrollView addObserver:self
+                        forKeyPath:kContentOffsetKeyPath
+                           options:NSKeyValueObservingOptionInitial
+                           context:kKVOContextMDCScrollTraceRecorder];
+}
+
+- (MDCScrollTrace *)stopRecording {
+  [self stopObserving];
+  return [[MDCScrollTrace alloc] initWithSamples:_samples.bytes
+                                           count:_samples.length / sizeof(MDCScrollTraceSample)];
+}
+
+#pragma mark - Private
+
+- (void)stopObserving {
+  [_observedScrollView removeObserver:self
+                           forKeyPath:kContentOffsetKeyPath
+                              context:kKVOContextMDCScrollTraceRecorder];
+  _observedScrollView = nil;
+}
+
+- (void)observeValueForKeyPath:(NSString *)keyPath
+                      ofObject:(id)object
+                        change:(NSDictionary<NSKeyValueChangeKey, id> *)change
+                       context:(void *)context {
+  if (context != kKVOContextMDCScrollTraceRecorder) {
+    [super observeValueForKeyPath:keyPath ofObject:object change:change context:context];
+    return;
+  }
+
+  UIScrollView *scrollView = _observedScrollView;
+  MDCScrollTraceSample sample;
+  sample.timestamp = CACurrentMediaTime() - _startTime;
+  sample.contentOffset = scrollView.contentOffset;
+
+  NSUInteger count = _samples.length / sizeof(MDCScrollTraceSample);
+  if (scrollView.isTracking) {
+    // The pan velocity is in the opposite direction of the content offset's movement.
+    CGPoint panVelocity = [scrollView.panGestureRecognizer velocityInView:scrollView];
+    sample.velocity = CGPointMake(-panVelocity.x, -panVelocity.y);
+  } else if (count > 0) {
+    MDCScrollTraceSample previous = ((const MDCScrollTraceSample *)_samples.bytes)[count - 1];
+    CFTimeInterval interval = sample.timestamp - previous.timestamp;
+    if (interval > 0) {
+      sample.velocity =
+          CGPointMake((CGFloat)((sample.contentOffset.x - previous.contentOffset.x) / interval),
+                      (CGFloat)((sample.contentOffset.y - previous.contentOffset.y) / interval));
+    } else {
+      sample.velocity = previous.velocity;
+    }
+  } else {
+    sample.velocity = CGPointZero;
+  }
+  [_samples appendBytes:&sample length:sizeof(sample)];
+}
+
+@end
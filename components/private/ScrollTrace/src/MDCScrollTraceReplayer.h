@@ -0,0 +1,67 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <Foundation/Foundation.h>
+
+#import "MDCScrollTrace.h"
+
+@class MDCScrollTraceReport;
+
+/**
+ Replays a scroll trace against a scroll-driven component at a fixed frame rate, without a display
+ link or run loop, and measures each frame.
+
+ The trace is resampled at @c frameRate; the frame handler is expected to apply the sample to the
+ component, e.g. by setting a scroll view's content offset and forwarding the scroll event, and to
+ flush layout with -layoutIfNeeded. The thread CPU time spent in the handler is measured for every
+ frame. Components report layout passes and frame commits while the handler runs by calling
+ @c recordLayoutPass and @c recordFrameCommit, typically from a layoutSubviews override in a test
+ subclass and from a delegate callback.
+
+ @code
+ MDCScrollTraceReplayer *replayer = [[MDCScrollTraceReplayer alloc] initWithTrace:trace];
+ replayer.frameRate = 120;
+ MDCScrollTraceReport *report = [replayer replayWithFrameHandler:^(MDCScrollTraceSample sample) {
+   scrollView.contentOffset = sample.contentOffset;
+   [headerView trackingScrollViewDidScroll];
+   [headerView layoutIfNeeded];
+ }];
+ @endcode
+ */
+@interface MDCScrollTraceReplayer : NSObject
+
+- (nonnull instancetype)initWithTrace:(nonnull MDCScrollTrace *)trace NS_DESIGNATED_INITIALIZER;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+/** The replayed trace. */
+@property(nonatomic, readonly, nonnull) MDCScrollTrace *trace;
+
+/** The name of the scenario, used to name reports. Defaults to "trace". */
+@property(nonatomic, copy, nonnull) NSString *name;
+
+/** The number of frames replayed per second of the trace. Defaults to 60. */
+@property(nonatomic) NSInteger frameRate;
+
+/** Records a layout pass in the frame being replayed. Ignored outside of a replay. */
+- (void)recordLayoutPass;
+
+/** Records a frame commit in the frame being replayed. Ignored outside of a replay. */
+- (void)recordFrameCommit;
+
+/** Replays the trace, calling @c frameHandler once per frame, and returns the measurements. */
+- (nonnull MDCScrollTraceReport *)replayWithFrameHandler:
+    (nonnull void (^)(MDCScrollTraceSample sample))frameHandler;
+
+@end
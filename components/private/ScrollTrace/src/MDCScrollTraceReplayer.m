@@ -0,0 +1,100 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCScrollTraceReplayer.h"
+
+#import <mach/mach.h>
+
+#import "MDCScrollTraceReport.h"
+
+/** Returns the CPU time consumed by the calling thread, in seconds. */
+static NSTimeInterval CurrentThreadCPUTime(void) {
+  mach_port_t thread = mach_thread_self();
+  thread_basic_info_data_t info;
+  mach_msg_type_number_t count = THREAD_BASIC_INFO_COUNT;
+  kern_return_t result = thread_info(thread, THREAD_BASIC_INFO, (thread_info_t)&info, &count);
+  mach_port_deallocate(mach_task_self(), thread);
+  if (result != KERN_SUCCESS) {
+    return 0;
+  }
+  return info.user_time.seconds + info.user_time.microseconds / 1e6 + info.system_time.seconds +
+         info.system_time.microseconds / 1e6;
+}
+
+@implementation MDCScrollTraceReplayer {
+  BOOL _isReplaying;
+  NSUInteger _currentFrameLayoutPassCount;
+  NSUInteger _currentFrameCommitCount;
+}
+
+- (instancetype)initWithTrace:(MDCScrollTrace *)trace {
+  self = [super init];
+  if (self) {
+    _trace = trace;
+    _name = @"trace";
+    _frameRate = 60;
+  }
+  return self;
+}
+
+- (void)recordLayoutPass {
+  if (_isReplaying) {
+    ++_currentFrameLayoutPassCount;
+  }
+}
+
+- (void)recordFrameCommit {
+  if (_isReplaying) {
+    ++_currentFrameCommitCount;
+  }
+}
+
+- (MDCScrollTraceReport *)replayWithFrameHandler:(void (^)(MDCScrollTraceSample))frameHandler {
+  NSInteger frameRate = MAX(1, self.frameRate);
+  // The epsilon keeps a frame that lands on the last sample from being lost to rounding.
+  NSUInteger frameCount = (NSUInteger)floor(self.trace.duration * frameRate + 1e-6) + 1;
+  if (self.trace.count == 0) {
+    frameCount = 0;
+  }
+
+  NSMutableArray<NSNumber *> *cpuTimes = [NSMutableArray arrayWithCapacity:frameCount];
+  NSMutableArray<NSNumber *> *layoutPassCounts = [NSMutableArray arrayWithCapacity:frameCount];
+  NSMutableArray<NSNumber *> *frameCommitCounts = [NSMutableArray arrayWithCapacity:frameCount];
+
+  _isReplaying = YES;
+  for (NSUInteger frame = 0; frame < frameCount; ++frame) {
+    // Frame times are computed from the frame index rather than accumulated so that replays at
+    // different frame rates sample the trace at exactly the same times where they coincide.
+    MDCScrollTraceSample sample = [self.trace sampleAtTime:(CFTimeInterval)frame / frameRate];
+    _currentFrameLayoutPassCount = 0;
+    _currentFrameCommitCount = 0;
+
+    NSTimeInterval startTime = CurrentThreadCPUTime();
+    frameHandler(sample);
+    NSTimeInterval cpuTime = CurrentThreadCPUTime() - startTime;
+
+    [cpuTimes addObject:@(cpuTime)];
+    [layoutPassCounts addObject:@(_currentFrameLayoutPassCount)];
+    [frameCommitCounts addObject:@(_currentFrameCommitCount)];
+  }
+  _isReplaying = NO;
+
+  return [[MDCScrollTraceReport alloc] initWithName:self.name
+                                          frameRate:frameRate
+                                      frameCPUTimes:cpuTimes
+                                   layoutPassCounts:layoutPassCounts
+                                  frameCommitCounts:frameCommitCounts];
+}
+
+@end
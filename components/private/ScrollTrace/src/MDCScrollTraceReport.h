@@ -0,0 +1,94 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <Foundation/Foundation.h>
+
+/**
+ The environment variable naming the directory scroll trace reports are written to, e.g. by CI jobs
+ that compare reports against a baseline.
+ */
+FOUNDATION_EXTERN NSString *_Nonnull const MDCScrollTraceReportDirectoryEnvironmentKey;
+
+/**
+ Per-frame measurements taken while replaying a scroll trace with MDCScrollTraceReplayer.
+
+ All arrays have @c frameCount elements.
+ */
+@interface MDCScrollTraceReport : NSObject
+
+- (nonnull instancetype)initWithName:(nonnull NSString *)name
+                           frameRate:(NSInteger)frameRate
+                       frameCPUTimes:(nonnull NSArray<NSNumber *> *)frameCPUTimes
+                    layoutPassCounts:(nonnull NSArray<NSNumber *> *)layoutPassCounts
+                   frameCommitCounts:(nonnull NSArray<NSNumber *> *)frameCommitCounts
+    NS_DESIGNATED_INITIALIZER;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+/** The name of the replayed scenario. */
+@property(nonatomic, readonly, copy, nonnull) NSString *name;
+
+/** The rate at which frames were replayed, in frames per second. */
+@property(nonatomic, readonly) NSInteger frameRate;
+
+/** The number of replayed frames. */
+@property(nonatomic, readonly) NSUInteger frameCount;
+
+/** The thread CPU time spent in each frame, in seconds. */
+@property(nonatomic, readonly, nonnull) NSArray<NSNumber *> *frameCPUTimes;
+
+/** The number of layout passes recorded in each frame. */
+@property(nonatomic, readonly, nonnull) NSArray<NSNumber *> *layoutPassCounts;
+
+/** The number of frame commits recorded in each frame. */
+@property(nonatomic, readonly, nonnull) NSArray<NSNumber *> *frameCommitCounts;
+
+/** The sum of @c layoutPassCounts. */
+@property(nonatomic, readonly) NSUInteger totalLayoutPassCount;
+
+/** The sum of @c frameCommitCounts. */
+@property(nonatomic, readonly) NSUInteger totalFrameCommitCount;
+
+/**
+ Returns the per-frame CPU time, in seconds, below which @c percentile (between 0 and 1) of the
+ frames fall.
+ */
+- (NSTimeInterval)frameCPUTimeAtPercentile:(double)percentile;
+
+/**
+ A JSON-compatible summary of the report, with CPU times in milliseconds:
+
+ @code
+ {
+   "name": "...", "frameRate": 120, "frameCount": 90,
+   "cpuTimeMs": {"total": ..., "mean": ..., "p50": ..., "p95": ..., "max": ...},
+   "layoutPasses": {"total": ..., "max": ...},
+   "frameCommits": {"total": ..., "max": ...},
+   "frames": [{"cpuTimeMs": ..., "layoutPasses": ..., "frameCommits": ...}, ...]
+ }
+ @endcode
+ */
+- (nonnull NSDictionary<NSString *, id> *)JSONObject;
+
+/** @c JSONObject serialized as UTF-8 JSON. */
+- (nonnull NSData *)JSONData;
+
+/**
+ Writes @c JSONData to "<name>-<frameRate>hz.json" in the directory named by
+ MDCScrollTraceReportDirectoryEnvironmentKey. Does nothing and returns YES if the variable isn't
+ set.
+ */
+- (BOOL)writeToReportDirectoryIfRequested:(NSError *_Nullable *_Nullable)error;
+
+@end
@@ -0,0 +1,134 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCScrollTraceReport.h"
+
+NSString *const MDCScrollTraceReportDirectoryEnvironmentKey = @"MDC_SCROLL_TRACE_REPORT_DIR";
+
+static const double kMillisecondsPerSecond = 1000;
+
+static NSUInteger Sum(NSArray<NSNumber *> *values) {
+  NSUInteger sum = 0;
+  for (NSNumber *value in values) {
+    sum += value.unsignedIntegerValue;
+  }
+  return sum;
+}
+
+static NSUInteger Maximum(NSArray<NSNumber *> *values) {
+  NSUInteger maximum = 0;
+  for (NSNumber *value in values) {
+    maximum = MAX(maximum, value.unsignedIntegerValue);
+  }
+  return maximum;
+}
+
+@implementation MDCScrollTraceReport {
+  NSArray<NSNumber *> *_sortedFrameCPUTimes;
+}
+
+- (instancetype)initWithName:(NSString *)name
+                   frameRate:(NSInteger)frameRate
+               frameCPUTimes:(NSArray<NSNumber *> *)frameCPUTimes
+            layoutPassCounts:(NSArray<NSNumber *> *)layoutPassCounts
+           frameCommitCounts:(NSArray<NSNumber *> *)frameCommitCounts {
+  NSParameterAssert(frameCPUTimes.count == layoutPassCounts.count &&
+                    frameCPUTimes.count == frameCommitCounts.count);
+  self = [super init];
+  if (self) {
+    _name = [name copy];
+    _frameRate = frameRate;
+    _frameCount = frameCPUTimes.count;
+    _frameCPUTimes = [frameCPUTimes copy];
+    _layoutPassCounts = [layoutPassCounts copy];
+    _frameCommitCounts = [frameCommitCounts copy];
+    _totalLayoutPassCount = Sum(layoutPassCounts);
+    _totalFrameCommitCount = Sum(frameCommitCounts);
+    _sortedFrameCPUTimes = [frameCPUTimes sortedArrayUsingSelector:@selector(compare:)];
+  }
+  return self;
+}
+
+- (NSTimeInterval)frameCPUTimeAtPercentile:(double)percentile {
+  if (_frameCount == 0) {
+    return 0;
+  }
+  double clampedPercentile = MAX(0, MIN(1, percentile));
+  NSUInteger index = (NSUInteger)ceil(clampedPercentile * _frameCount);
+  index = MIN(_frameCount - 1, index > 0 ? index - 1 : 0);
+  return _sortedFrameCPUTimes[index].doubleValue;
+}
+
+- (NSDictionary<NSString *, id> *)JSONObject {
+  double totalCPUTime = 0;
+  NSMutableArray<NSDictionary<NSString *, id> *> *frames =
+      [NSMutableArray arrayWithCapacity:_frameCount];
+  for (NSUInteger i = 0; i < _frameCount; ++i) {
+    double cpuTime = _frameCPUTimes[i].doubleValue;
+    totalCPUTime += cpuTime;
+    [frames addObject:@{
+      @"cpuTimeMs" : @(cpuTime * kMillisecondsPerSecond),
+      @"layoutPasses" : _layoutPassCounts[i],
+      @"frameCommits" : _frameCommitCounts[i],
+    }];
+  }
+
+  return @{
+    @"name" : _name,
+    @"frameRate" : @(_frameRate),
+    @"frameCount" : @(_frameCount),
+    @"cpuTimeMs" : @{
+      @"total" : @(totalCPUTime * kMillisecondsPerSecond),
+      @"mean" : @(_frameCount > 0 ? totalCPUTime / _frameCount * kMillisecondsPerSecond : 0),
+      @"p50" : @([self frameCPUTimeAtPercentile:0.5] * kMillisecondsPerSecond),
+      @"p95" : @([self frameCPUTimeAtPercentile:0.95] * kMillisecondsPerSecond),
+      @"max" : @([self frameCPUTimeAtPercentile:1] * kMillisecondsPerSecond),
+    },
+    @"layoutPasses" : @{
+      @"total" : @(_totalLayoutPassCount),
+      @"max" : @(Maximum(_layoutPassCounts)),
+    },
+    @"frameCommits" : @{
+      @"total" : @(_totalFrameCommitCount),
+      @"max" : @(Maximum(_frameCommitCounts)),
+    },
+    @"frames" : frames,
+  };
+}
+
+- (NSData *)JSONData {
+  return [NSJSONSerialization dataWithJSONObject:[self JSONObject]
+                                         options:NSJSONWritingPrettyPrinted
+                                           error:NULL];
+}
+
+- (BOOL)writeToReportDirectoryIfRequested:(NSError **)error {
+  NSString *directory =
+      NSProcessInfo.processInfo.environment[MDCScrollTraceReportDirectoryEnvironmentKey];
+  if (directory.length == 0) {
+    return YES;
+  }
+  if (![[NSFileManager defaultManager] createDirectoryAtPath:directory
+                                 withIntermediateDirectories:YES
+                                                  attributes:nil
+                                                       error:error]) {
+    return NO;
+  }
+  NSString *fileName = [NSString stringWithFormat:@"%@-%ldhz.json", _name, (long)_frameRate];
+  return [[self JSONData] writeToFile:[directory stringByAppendingPathComponent:fileName]
+                              options:NSDataWritingAtomic
+                                error:error];
+}
+
+@end
@@ -0,0 +1,165 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialScrollTrace.h"
+
+@interface MDCScrollTraceTests : XCTestCase
+@end
+
+@implementation MDCScrollTraceTests
+
+- (void)testDataRepresentationRoundTrips {
+  // Given
+  MDCScrollTrace *trace =
+      [MDCScrollTrace decelerationTraceFromContentOffset:CGPointMake(0, 100)
+                                                velocity:CGPointMake(0, 2000)
+                                        decelerationRate:UIScrollViewDecelerationRateNormal
+                                          sampleInterval:1.0 / 120.0];
+
+  // When
+  NSError *error;
+  MDCScrollTrace *decodedTrace = [[MDCScrollTrace alloc] initWithData:[trace dataRepresentation]
+                                                                error:&error];
+
+  // Then
+  XCTAssertNil(error);
+  XCTAssertEqual(decodedTrace.count, trace.count);
+  XCTAssertEqual([trace dataRepresentation].length, 16 + 20 * trace.count);
+  for (NSUInteger i = 0; i < trace.count; ++i) {
+    MDCScrollTraceSample sample = [trace sampleAtIndex:i];
+    MDCScrollTraceSample decodedSample = [decodedTrace sampleAtIndex:i];
+    XCTAssertEqualWithAccuracy(decodedSample.timestamp, sample.timestamp, 0.0001);
+    XCTAssertEqualWithAccuracy(decodedSample.contentOffset.y, sample.contentOffset.y, 0.001);
+    XCTAssertEqualWithAccuracy(decodedSample.velocity.y, sample.velocity.y, 0.01);
+  }
+}
+
+- (void)testInvalidDataIsRejected {
+  // Given
+  NSData *data = [@"not a scroll trace" dataUsingEncoding:NSUTF8StringEncoding];
+
+  // When
+  NSError *error;
+  MDCScrollTrace *trace = [[MDCScrollTrace alloc] initWithData:data error:&error];
+
+  // Then
+  XCTAssertNil(trace);
+  XCTAssertEqualObjects(error.domain, MDCScrollTraceErrorDomain);
+  XCTAssertEqual(error.code, MDCScrollTraceErrorCodeInvalidFormat);
+}
+
+- (void)testTruncatedDataIsRejected {
+  // Given
+  MDCScrollTrace *trace = [MDCScrollTrace traceWithContentOffsetYs:@[ @0, @10, @20 ]
+                                                    sampleInterval:0.1];
+  NSData *data = [trace dataRepresentation];
+  NSData *truncatedData = [data subdataWithRange:NSMakeRange(0, data.length - 1)];
+
+  // When
+  NSError *error;
+  MDCScrollTrace *decodedTrace = [[MDCScrollTrace alloc] initWithData:truncatedData error:&error];
+
+  // Then
+  XCTAssertNil(decodedTrace);
+  XCTAssertEqual(error.code, MDCScrollTraceErrorCodeTruncated);
+}
+
+- (void)testDecelerationTraceSlowsDownAndStops {
+  // When
+  MDCScrollTrace *trace =
+      [MDCScrollTrace decelerationTraceFromContentOffset:CGPointZero
+                                                velocity:CGPointMake(0, 1000)
+                                        decelerationRate:UIScrollViewDecelerationRateNormal
+                                          sampleInterval:1.0 / 60.0];
+
+  // Then
+  MDCScrollTraceSample lastSample = [trace sampleAtIndex:trace.count - 1];
+  XCTAssertGreaterThan(trace.count, 2U);
+  XCTAssertLessThan(lastSample.velocity.y, 1);
+  XCTAssertGreaterThan(lastSample.contentOffset.y, [trace sampleAtIndex:1].contentOffset.y);
+}
+
+- (void)testSampleAtTimeInterpolatesAndClamps {
+  // Given
+  MDCScrollTrace *trace = [MDCScrollTrace traceWithContentOffsetYs:@[ @0, @10, @30 ]
+                                                    sampleInterval:0.1];
+
+  // Then
+  XCTAssertEqualWithAccuracy([trace sampleAtTime:0.05].contentOffset.y, 5, 0.0001);
+  XCTAssertEqualWithAccuracy([trace sampleAtTime:0.15].contentOffset.y, 20, 0.0001);
+  XCTAssertEqualWithAccuracy([trace sampleAtTime:-1].contentOffset.y, 0, 0.0001);
+  XCTAssertEqualWithAccuracy([trace sampleAtTime:1].contentOffset.y, 30, 0.0001);
+}
+
+- (void)testReplayFrameCountFollowsFrameRate {
+  // Given
+  MDCScrollTrace *trace = [MDCScrollTrace traceWithContentOffsetYs:@[ @0, @100 ]
+                                                    sampleInterval:0.5];
+  MDCScrollTraceReplayer *replayer = [[MDCScrollTraceReplayer alloc] initWithTrace:trace];
+  __block NSUInteger handledFrameCount = 0;
+
+  // When
+  replayer.frameRate = 60;
+  MDCScrollTraceReport *report60Hz =
+      [replayer replayWithFrameHandler:^(__unused MDCScrollTraceSample sample) {
+        ++handledFrameCount;
+      }];
+  replayer.frameRate = 120;
+  MDCScrollTraceReport *report120Hz =
+      [replayer replayWithFrameHandler:^(__unused MDCScrollTraceSample sample){
+      }];
+
+  // Then
+  XCTAssertEqual(report60Hz.frameCount, 31U);
+  XCTAssertEqual(handledFrameCount, 31U);
+  XCTAssertEqual(report120Hz.frameCount, 61U);
+  XCTAssertEqual(report120Hz.frameRate, 120);
+}
+
+- (void)testReplayCountsRecordedEventsPerFrame {
+  // Given
+  MDCScrollTrace *trace = [MDCScrollTrace traceWithContentOffsetYs:@[ @0, @10, @20 ]
+                                                    sampleInterval:1.0 / 60.0];
+  MDCScrollTraceReplayer *replayer = [[MDCScrollTraceReplayer alloc] initWithTrace:trace];
+  replayer.name = @"events";
+  __weak MDCScrollTraceReplayer *weakReplayer = replayer;
+
+  // When
+  [replayer recordFrameCommit];  // Outside of a replay, ignored.
+  MDCScrollTraceReport *report = [replayer replayWithFrameHandler:^(MDCScrollTraceSample sample) {
+    [weakReplayer recordLayoutPass];
+    if (sample.contentOffset.y > 0) {
+      [weakReplayer recordFrameCommit];
+      [weakReplayer recordFrameCommit];
+    }
+  }];
+
+  // Then
+  XCTAssertEqualObjects(report.layoutPassCounts, (@[ @1, @1, @1 ]));
+  XCTAssertEqualObjects(report.frameCommitCounts, (@[ @0, @2, @2 ]));
+  XCTAssertEqual(report.totalFrameCommitCount, 4U);
+
+  NSDictionary<NSString *, id> *json =
+      [NSJSONSerialization JSONObjectWithData:[report JSONData] options:0 error:NULL];
+  XCTAssertEqualObjects(json[@"name"], @"events");
+  XCTAssertEqualObjects(json[@"frameCount"], @3);
+  XCTAssertEqualObjects(json[@"frameCommits"][@"max"], @2);
+  XCTAssertEqualObjects(json[@"layoutPasses"][@"total"], @3);
+  XCTAssertEqual([json[@"frames"] count], 3U);
+  XCTAssertNotNil(json[@"cpuTimeMs"][@"p95"]);
+}
+
+@end
@@ -212,6 +212,39 @@
  */
 @property(nonatomic, assign) BOOL continuousUpdateEvents;
 
+/**
+ Whether the continuous update events sent while the user drags the thumb are coalesced to at most
+ one per display frame.
+
+ When YES, the thumb, track and value label still follow every touch, but
+ @c UIControlEventValueChanged is only sent from a display link callback, and only if the value
+ changed since the last event. A final event is always sent when the touch ends or is cancelled, so
+ targets are guaranteed to observe the value the user released the thumb at. Has no effect when
+ @c continuousUpdateEvents is NO.
+
+ The default value of this property is NO.
+ */
+@property(nonatomic, assign) BOOL coalescesValueChangeEvents;
+
+/**
+ The minimum time, in seconds, between two coalesced continuous update events. Use this to throttle
+ targets that do expensive work for every value, such as rendering a preview. The final event at the
+ end of a drag is sent regardless of this interval.
+
+ Only used when @c coalescesValueChangeEvents is YES. The default value of this property is 0, which
+ allows one event per display frame.
+ */
+@property(nonatomic, assign) NSTimeInterval minimumValueChangeEventInterval;
+
+/** The number of @c UIControlEventValueChanged events the receiver has sent. */
+@property(nonatomic, assign, readonly) NSUInteger valueChangeEventCount;
+
+/**
+ The number of user value changes that were folded into a later coalesced event, or dropped because
+ the value returned to the last sent value before the event was due.
+ */
+@property(nonatomic, assign, readonly) NSUInteger coalescedValueChangeEventCount;
+
 /**
  Whether the control should react to pan gestures all along the track, or just on the thumb.
 
@@ -58,7 +58,19 @@ static UIColor *InkColorDefault() {
   return [UIColor.blueColor colorWithAlphaComponent:kTrackOnAlpha];
 }
 
-@implementation MDCDiscreteDotView
+@implementation MDCDiscreteDotView {
+  // Every dot is drawn twice, by a replicator layer per color. Masks then reveal the active dots of
+  // one and the inactive dots of the other, so moving the active segment only moves the masks and
+  // never redraws a dot.
+  CAReplicatorLayer *_inactiveDotsLayer;
+  CALayer *_inactiveDotLayer;
+  CAReplicatorLayer *_activeDotsLayer;
+  CALayer *_activeDotLayer;
+  CALayer *_activeDotsMaskLayer;
+  CALayer *_inactiveDotsMaskLayer;
+  CALayer *_leadingInactiveDotsMaskLayer;
+  CALayer *_trailingInactiveDotsMaskLayer;
+}
 
 - (instancetype)init {
   self = [super init];
@@ -67,23 +79,49 @@ static UIColor *InkColorDefault() {
     _inactiveDotColor = UIColor.blackColor;
     _activeDotColor = UIColor.blackColor;
     _activeDotsSegment = CGRectMake(CGFLOAT_MIN, 0, 0, 0);
+
+    _inactiveDotLayer = [CALayer layer];
+    _inactiveDotsLayer = [CAReplicatorLayer layer];
+    [_inactiveDotsLayer addSublayer:_inactiveDotLayer];
+    _leadingInactiveDotsMaskLayer = [self createMaskLayer];
+    _trailingInactiveDotsMaskLayer = [self createMaskLayer];
+    _inactiveDotsMaskLayer = [CALayer layer];
+    [_inactiveDotsMaskLayer addSublayer:_leadingInactiveDotsMaskLayer];
+    [_inactiveDotsMaskLayer addSublayer:_trailingInactiveDotsMaskLayer];
+    _inactiveDotsLayer.mask = _inactiveDotsMaskLayer;
+    [self.layer addSublayer:_inactiveDotsLayer];
+
+    _activeDotLayer = [CALayer layer];
+    _activeDotsLayer = [CAReplicatorLayer layer];
+    [_activeDotsLayer addSublayer:_activeDotLayer];
+    _activeDotsMaskLayer = [self createMaskLayer];
+    _activeDotsLayer.mask = _activeDotsMaskLayer;
+    [self.layer addSublayer:_activeDotsLayer];
+
+    [self updateDotColors];
   }
   return self;
 }
 
+- (CALayer *)createMaskLayer {
+  CALayer *maskLayer = [CALayer layer];
+  maskLayer.backgroundColor = UIColor.blackColor.CGColor;
+  return maskLayer;
+}
+
 - (void)setFrame:(CGRect)frame {
   [super setFrame:frame];
-  [self setNeedsDisplay];
+  [self setNeedsLayout];
 }
 
 - (void)setActiveDotColor:(UIColor *)activeDotColor {
   _activeDotColor = activeDotColor;
-  [self setNeedsDisplay];
+  [self updateDotColors];
 }
 
 - (void)setInactiveDotColor:(UIColor *)inactiveDotColor {
   _inactiveDotColor = inactiveDotColor;
-  [self setNeedsDisplay];
+  [self updateDotColors];
 }
 
 - (void)setActiveDotsSegment:(CGRect)activeDotsSegment {
@@ -91,42 +129,105 @@ static UIColor *InkColorDefault() {
   CGFloat newMaxX = MIN(1, MAX(0, CGRectGetMaxX(activeDotsSegment)));
 
   _activeDotsSegment = CGRectMake(newMinX, 0, (newMaxX - newMinX), 0);
-  [self setNeedsDisplay];
-}
-
-- (void)drawRect:(CGRect)rect {
-  [super drawRect:rect];
-
-  if (_numDiscreteDots >= 2) {
-    CGContextRef contextRef = UIGraphicsGetCurrentContext();
-
-    CGRect circleRect = CGRectMake(0, 0, self.bounds.size.height, self.bounds.size.height);
-    // Increment within the bounds
-    CGFloat absoluteIncrement =
-        (self.bounds.size.width - self.bounds.size.height) / (_numDiscreteDots - 1);
-    // Increment within 0..1
-    CGFloat relativeIncrement = (CGFloat)1.0 / (_numDiscreteDots - 1);
-
-    // Allow an extra 10% of the increment to guard against rounding errors excluding dots that
-    // should genuinely be within the active segment.
-    CGFloat minActiveX = CGRectGetMinX(self.activeDotsSegment) - relativeIncrement * (CGFloat)0.1;
-    CGFloat maxActiveX = CGRectGetMaxX(self.activeDotsSegment) + relativeIncrement * (CGFloat)0.1;
-    for (NSUInteger i = 0; i < _numDiscreteDots; i++) {
-      CGFloat relativePosition = i * relativeIncrement;
-      if (minActiveX <= relativePosition && maxActiveX >= relativePosition) {
-        [self.activeDotColor setFill];
-      } else {
-        [self.inactiveDotColor setFill];
-      }
-      circleRect.origin.x = (i * absoluteIncrement);
-      CGContextFillEllipseInRect(contextRef, circleRect);
-    }
-  }
+  [self updateMasks];
 }
 
 - (void)setNumDiscreteDots:(NSUInteger)numDiscreteDots {
   _numDiscreteDots = numDiscreteDots;
-  [self setNeedsDisplay];
+  [self setNeedsLayout];
+}
+
+- (void)traitCollectionDidChange:(UITraitCollection *)previousTraitCollection {
+  [super traitCollectionDidChange:previousTraitCollection];
+
+  // Layers hold resolved CGColors, which have to be resolved again for dynamic colors.
+  [self updateDotColors];
+}
+
+- (void)layoutSubviews {
+  [super layoutSubviews];
+
+  [CATransaction begin];
+  [CATransaction setDisableActions:YES];
+  CGFloat dotDiameter = CGRectGetHeight(self.bounds);
+  NSInteger instanceCount = _numDiscreteDots >= 2 ? (NSInteger)_numDiscreteDots : 0;
+  CATransform3D instanceTransform =
+      CATransform3DMakeTranslation([self absoluteIncrement], 0, 0);
+  for (CAReplicatorLayer *dotsLayer in @[ _inactiveDotsLayer, _activeDotsLayer ]) {
+    dotsLayer.frame = self.bounds;
+    dotsLayer.instanceCount = instanceCount;
+    dotsLayer.instanceTransform = instanceTransform;
+  }
+  for (CALayer *dotLayer in @[ _inactiveDotLayer, _activeDotLayer ]) {
+    dotLayer.frame = CGRectMake(0, 0, dotDiameter, dotDiameter);
+    dotLayer.cornerRadius = dotDiameter / 2;
+  }
+  _inactiveDotsMaskLayer.frame = self.bounds;
+  [CATransaction commit];
+
+  [self updateMasks];
+}
+
+#pragma mark - Private
+
+/** The distance between the origins of adjacent dots. */
+- (CGFloat)absoluteIncrement {
+  if (_numDiscreteDots < 2) {
+    return 0;
+  }
+  return (CGRectGetWidth(self.bounds) - CGRectGetHeight(self.bounds)) / (_numDiscreteDots - 1);
+}
+
+- (NSRange)activeDotRange {
+  if (_numDiscreteDots < 2) {
+    return NSMakeRange(0, 0);
+  }
+  // Increment within 0..1
+  CGFloat relativeIncrement = (CGFloat)1.0 / (_numDiscreteDots - 1);
+
+  // Allow an extra 10% of the increment to guard against rounding errors excluding dots that
+  // should genuinely be within the active segment.
+  CGFloat minActiveX = CGRectGetMinX(self.activeDotsSegment) - relativeIncrement * (CGFloat)0.1;
+  CGFloat maxActiveX = CGRectGetMaxX(self.activeDotsSegment) + relativeIncrement * (CGFloat)0.1;
+  CGFloat firstActiveDot = MAX(0, MDCCeil(minActiveX / relativeIncrement));
+  CGFloat lastActiveDot =
+      MIN((CGFloat)(_numDiscreteDots - 1), MDCFloor(maxActiveX / relativeIncrement));
+  if (lastActiveDot < firstActiveDot) {
+    return NSMakeRange(0, 0);
+  }
+  return NSMakeRange((NSUInteger)firstActiveDot, (NSUInteger)(lastActiveDot - firstActiveDot) + 1);
+}
+
+- (void)updateDotColors {
+  [CATransaction begin];
+  [CATransaction setDisableActions:YES];
+  _activeDotLayer.backgroundColor = self.activeDotColor.CGColor;
+  _inactiveDotLayer.backgroundColor = self.inactiveDotColor.CGColor;
+  [CATransaction commit];
+}
+
+/** Moves the masks so that exactly the dots in @c activeDotRange are shown in the active color. */
+- (void)updateMasks {
+  CGFloat width = CGRectGetWidth(self.bounds);
+  CGFloat height = CGRectGetHeight(self.bounds);
+  CGFloat absoluteIncrement = [self absoluteIncrement];
+  NSRange activeDotRange = [self activeDotRange];
+
+  // The mask edges fall on the leading edges of dots, so that no dot is split between colors.
+  CGFloat activeMinX = 0;
+  CGFloat activeMaxX = 0;
+  if (activeDotRange.length > 0) {
+    activeMinX = activeDotRange.location * absoluteIncrement;
+    activeMaxX = (NSMaxRange(activeDotRange) - 1) * absoluteIncrement + height;
+  }
+
+  [CATransaction begin];
+  [CATransaction setDisableActions:YES];
+  _activeDotsMaskLayer.frame = CGRectMake(activeMinX, 0, activeMaxX - activeMinX, height);
+  _leadingInactiveDotsMaskLayer.frame = CGRectMake(0, 0, activeMinX, height);
+  _trailingInactiveDotsMaskLayer.frame =
+      CGRectMake(activeMaxX, 0, MAX(0, width - activeMaxX), height);
+  [CATransaction commit];
 }
 
 @end
@@ -174,6 +275,12 @@ static inline CGFloat DistanceFromPointToPoint(CGPoint point1, CGPoint point2) {
   BOOL _isDraggingThumb;
   BOOL _didChangeValueDuringPan;
   CGFloat _panThumbGrabPosition;
+
+  // Coalesced value change events. The display link is only scheduled during a drag, and is paused
+  // whenever no value change is pending.
+  CADisplayLink *_valueChangeEventDisplayLink;
+  NSUInteger _pendingValueChangeCount;
+  CFTimeInterval _lastValueChangeEventTime;
 }
 
 @synthesize thumbEnabledColor = _thumbEnabledColor;
@@ -565,12 +672,22 @@ static inline CGFloat DistanceFromPointToPoint(CGPoint point1, CGPoint point2) {
 
 - (void)setEnabled:(BOOL)enabled {
   [super setEnabled:enabled];
+  if (!enabled) {
+    [self stopCoalescingValueChangeEvents];
+  }
   if (enabled) {
     [self setPrimaryColor:_primaryColor];
   }
   [self setNeedsLayout];
 }
 
+- (void)setCoalescesValueChangeEvents:(BOOL)coalescesValueChangeEvents {
+  _coalescesValueChangeEvents = coalescesValueChangeEvents;
+  if (!coalescesValueChangeEvents) {
+    [self stopCoalescingValueChangeEvents];
+  }
+}
+
 - (void)setEnableRippleBehavior:(BOOL)enableRippleBehavior {
   if (_enableRippleBehavior == enableRippleBehavior) {
     return;
@@ -1162,13 +1279,20 @@ static inline CGFloat DistanceFromPointToPoint(CGPoint point1, CGPoint point2) {
       animateThumbAfterMove:YES
               userGenerated:YES
                  completion:NULL];
-  [self sendContinuousChangeAction];
 
   if (_value != previousValue) {
     // We made a move, now this action can't later count as a tap
     _didChangeValueDuringPan = YES;
   }
 
+  if (_coalescesValueChangeEvents && _continuousUpdateEvents) {
+    if (_value != previousValue) {
+      [self coalesceValueChange];
+    }
+  } else {
+    [self sendContinuousChangeAction];
+  }
+
   if ([self pointInside:touchLoc withEvent:nil]) {
     [self sendActionsForControlEvents:UIControlEventTouchDragInside];
   } else {
@@ -1182,6 +1306,7 @@ static inline CGFloat DistanceFromPointToPoint(CGPoint point1, CGPoint point2) {
     BOOL wasDragging = _isDraggingThumb;
     _isDraggingThumb = NO;
     _currentTouch = nil;
+    [self stopCoalescingValueChangeEvents];
 
     if (wasDragging) {
       // Shrink the thumb
@@ -1209,6 +1334,7 @@ static inline CGFloat DistanceFromPointToPoint(CGPoint point1, CGPoint point2) {
   BOOL wasDragging = _isDraggingThumb;
   _isDraggingThumb = NO;
   _currentTouch = nil;
+  [self stopCoalescingValueChangeEvents];
 
   if (wasDragging) {
     // Shrink the thumb
@@ -1279,16 +1405,69 @@ static inline CGFloat DistanceFromPointToPoint(CGPoint point1, CGPoint point2) {
 
 - (void)sendContinuousChangeAction {
   if (_continuousUpdateEvents && _value != _lastDispatchedValue) {
-    [self sendActionsForControlEvents:UIControlEventValueChanged];
-    _lastDispatchedValue = _value;
+    [self sendValueChangedAction];
   }
 }
 
 - (void)sendDiscreteChangeAction {
   if (_value != _lastDispatchedValue) {
-    [self sendActionsForControlEvents:UIControlEventValueChanged];
-    _lastDispatchedValue = _value;
+    [self sendValueChangedAction];
+  }
+}
+
+- (void)sendValueChangedAction {
+  _lastDispatchedValue = _value;
+  _lastValueChangeEventTime = CACurrentMediaTime();
+  _valueChangeEventCount += 1;
+  [self sendActionsForControlEvents:UIControlEventValueChanged];
+}
+
+/** Records a user value change whose event is sent on the next display link callback. */
+- (void)coalesceValueChange {
+  _pendingValueChangeCount += 1;
+  if (!_valueChangeEventDisplayLink) {
+    _valueChangeEventDisplayLink =
+        [CADisplayLink displayLinkWithTarget:self
+                                    selector:@selector(valueChangeEventDisplayLinkDidFire:)];
+    [_valueChangeEventDisplayLink addToRunLoop:[NSRunLoop mainRunLoop]
+                                       forMode:NSRunLoopCommonModes];
   }
+  _valueChangeEventDisplayLink.paused = NO;
+}
+
+- (void)valueChangeEventDisplayLinkDidFire:(__unused CADisplayLink *)displayLink {
+  if (_pendingValueChangeCount == 0) {
+    _valueChangeEventDisplayLink.paused = YES;
+    return;
+  }
+  if (CACurrentMediaTime() - _lastValueChangeEventTime < _minimumValueChangeEventInterval) {
+    return;
+  }
+  [self sendPendingValueChangeAction];
+  _valueChangeEventDisplayLink.paused = YES;
+}
+
+- (void)sendPendingValueChangeAction {
+  if (_pendingValueChangeCount == 0) {
+    return;
+  }
+  NSUInteger coalescedCount = _pendingValueChangeCount;
+  _pendingValueChangeCount = 0;
+  if (_value != _lastDispatchedValue) {
+    coalescedCount -= 1;
+    [self sendValueChangedAction];
+  }
+  _coalescedValueChangeEventCount += coalescedCount;
+}
+
+/**
+ Sends the event for any pending value change and unschedules the display link, which would
+ otherwise retain the receiver.
+ */
+- (void)stopCoalescingValueChangeEvents {
+  [_valueChangeEventDisplayLink invalidate];
+  _valueChangeEventDisplayLink = nil;
+  [self sendPendingValueChangeAction];
 }
 
 #pragma mark - UIControl methods
@@ -36,6 +36,9 @@
  */
 @property(nonatomic, assign) CGRect activeDotsSegment;
 
+/** The range of dots that are drawn in @c activeDotColor. */
+@property(nonatomic, readonly) NSRange activeDotRange;
+
 @end
 
 @interface MDCThumbTrack (Private)
@@ -44,4 +47,7 @@
 @property(nonatomic, nonnull, readonly) MDCInkTouchController *touchController;
 @property(nonatomic, nonnull, readonly) MDCDiscreteDotView *discreteDotView;
 
+/** Sends a coalesced value change event if one is pending and allowed by the throttle interval. */
+- (void)valueChangeEventDisplayLinkDidFire:(nullable CADisplayLink *)displayLink;
+
 @end
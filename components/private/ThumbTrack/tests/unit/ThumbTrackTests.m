@@ -13,9 +13,13 @@
 // limitations under the License.
 
 #import <XCTest/XCTest.h>
+#import <objc/runtime.h>
 #import "../../src/private/MDCThumbTrack+Private.h"
 #import "MaterialThumbTrack.h"
 
+/** The number of value changes in a simulated drag across a discrete track. */
+static const NSUInteger kDragMoveCount = 200;
+
 @interface ThumbTrackTests : XCTestCase
 
 @end
@@ -361,4 +365,84 @@
   XCTAssertEqualObjects(thumbTrack.numericValueLabel.backgroundColor, UIColor.cyanColor);
 }
 
+#pragma mark - Discrete dots
+
+- (void)testActiveDotRangeIncludesDotsOnSegmentEdges {
+  // Given
+  MDCDiscreteDotView *dotView = [[MDCDiscreteDotView alloc] initWithFrame:CGRectMake(0, 0, 202, 2)];
+  dotView.numDiscreteDots = 11;
+
+  // When
+  dotView.activeDotsSegment = CGRectMake((CGFloat)0.3, 0, (CGFloat)0.4, 0);
+
+  // Then
+  XCTAssertTrue(NSEqualRanges(dotView.activeDotRange, NSMakeRange(3, 5)));
+}
+
+- (void)testActiveDotRangeOfEmptySegmentAtStartContainsFirstDot {
+  // Given
+  MDCDiscreteDotView *dotView = [[MDCDiscreteDotView alloc] initWithFrame:CGRectMake(0, 0, 202, 2)];
+  dotView.numDiscreteDots = 11;
+
+  // When
+  dotView.activeDotsSegment = CGRectZero;
+
+  // Then
+  XCTAssertTrue(NSEqualRanges(dotView.activeDotRange, NSMakeRange(0, 1)));
+}
+
+- (void)testActiveDotRangeIsEmptyBetweenDots {
+  // Given
+  MDCDiscreteDotView *dotView = [[MDCDiscreteDotView alloc] initWithFrame:CGRectMake(0, 0, 202, 2)];
+  dotView.numDiscreteDots = 11;
+
+  // When
+  dotView.activeDotsSegment = CGRectMake((CGFloat)0.44, 0, (CGFloat)0.02, 0);
+
+  // Then
+  XCTAssertEqual(dotView.activeDotRange.length, 0U);
+}
+
+- (void)testDiscreteDotViewDoesNotDrawOnTheCPU {
+  // Given
+  MDCDiscreteDotView *dotView = [[MDCDiscreteDotView alloc] initWithFrame:CGRectMake(0, 0, 202, 2)];
+  dotView.numDiscreteDots = 11;
+
+  // When
+  dotView.activeDotsSegment = CGRectMake(0, 0, (CGFloat)0.5, 0);
+  [dotView layoutIfNeeded];
+  [dotView.layer displayIfNeeded];
+
+  // Then
+  Method viewDrawRect = class_getInstanceMethod([UIView class], @selector(drawRect:));
+  Method dotViewDrawRect =
+      class_getInstanceMethod([MDCDiscreteDotView class], @selector(drawRect:));
+  XCTAssertEqual(method_getImplementation(dotViewDrawRect), method_getImplementation(viewDrawRect));
+  XCTAssertNil(dotView.layer.contents);
+}
+
+- (void)testDraggingAcrossDiscreteDotsPerformance {
+  // Given
+  UIWindow *window = [[UIWindow alloc] initWithFrame:CGRectMake(0, 0, 320, 100)];
+  MDCThumbTrack *thumbTrack = [[MDCThumbTrack alloc] initWithFrame:CGRectMake(0, 0, 320, 48)];
+  thumbTrack.numDiscreteValues = 100;
+  thumbTrack.shouldDisplayDiscreteDots = YES;
+  [window addSubview:thumbTrack];
+  window.hidden = NO;
+  [thumbTrack layoutIfNeeded];
+
+  // When
+  [self measureBlock:^{
+    for (NSUInteger move = 0; move <= kDragMoveCount; ++move) {
+      thumbTrack.value = (CGFloat)move / kDragMoveCount;
+      [thumbTrack layoutIfNeeded];
+      [CATransaction flush];
+    }
+  }];
+
+  // Then
+  XCTAssertEqual(thumbTrack.discreteDotView.activeDotRange.length, 100U);
+  window.hidden = YES;
+}
+
 @end
@@ -0,0 +1,195 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "../../src/private/MDCThumbTrack+Private.h"
+#import "MaterialThumbTrack.h"
+
+/** The number of touch moves in a simulated drag. */
+static const NSUInteger kDragMoveCount = 10;
+
+/** A touch whose location can be set. */
+@interface ThumbTrackFakeTouch : UITouch
+@property(nonatomic, assign) CGPoint location;
+@end
+
+@implementation ThumbTrackFakeTouch
+
+- (CGPoint)locationInView:(__unused UIView *)view {
+  return self.location;
+}
+
+@end
+
+/** Counts the value changed events sent by a control. */
+@interface ThumbTrackValueChangedTarget : NSObject
+@property(nonatomic, assign) NSUInteger eventCount;
+@property(nonatomic, assign) CGFloat lastValue;
+@end
+
+@implementation ThumbTrackValueChangedTarget
+
+- (void)valueChanged:(MDCThumbTrack *)thumbTrack {
+  self.eventCount += 1;
+  self.lastValue = thumbTrack.value;
+}
+
+@end
+
+@interface ThumbTrackValueChangeEventTests : XCTestCase
+@property(nonatomic, strong, nullable) MDCThumbTrack *thumbTrack;
+@property(nonatomic, strong, nullable) ThumbTrackValueChangedTarget *target;
+@property(nonatomic, strong, nullable) ThumbTrackFakeTouch *touch;
+@end
+
+@implementation ThumbTrackValueChangeEventTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.thumbTrack = [[MDCThumbTrack alloc] initWithFrame:CGRectMake(0, 0, 300, 48)];
+  self.thumbTrack.panningAllowedOnEntireControl = YES;
+  self.target = [[ThumbTrackValueChangedTarget alloc] init];
+  [self.thumbTrack addTarget:self.target
+                      action:@selector(valueChanged:)
+            forControlEvents:UIControlEventValueChanged];
+  self.touch = [[ThumbTrackFakeTouch alloc] init];
+}
+
+- (void)tearDown {
+  self.thumbTrack = nil;
+  self.target = nil;
+  self.touch = nil;
+
+  [super tearDown];
+}
+
+- (NSSet<UITouch *> *)touches {
+  return [NSSet setWithObject:self.touch];
+}
+
+- (void)beginDrag {
+  self.touch.location = CGPointMake(20, 24);
+  [self.thumbTrack touchesBegan:[self touches] withEvent:nil];
+}
+
+- (void)moveTouchBy:(CGFloat)distance {
+  self.touch.location = CGPointMake(self.touch.location.x + distance, self.touch.location.y);
+  [self.thumbTrack touchesMoved:[self touches] withEvent:nil];
+}
+
+- (void)testDraggingSendsAnEventForEveryMoveByDefault {
+  // Given
+  [self beginDrag];
+
+  // When
+  for (NSUInteger move = 0; move < kDragMoveCount; ++move) {
+    [self moveTouchBy:20];
+  }
+  [self.thumbTrack touchesEnded:[self touches] withEvent:nil];
+
+  // Then
+  XCTAssertEqual(self.target.eventCount, kDragMoveCount);
+  XCTAssertEqual(self.thumbTrack.valueChangeEventCount, kDragMoveCount);
+  XCTAssertEqual(self.thumbTrack.coalescedValueChangeEventCount, 0U);
+}
+
+- (void)testCoalescedDragSendsOneFinalEventOnTouchUp {
+  // Given
+  self.thumbTrack.coalescesValueChangeEvents = YES;
+  [self beginDrag];
+
+  // When
+  for (NSUInteger move = 0; move < kDragMoveCount; ++move) {
+    [self moveTouchBy:20];
+  }
+  NSUInteger eventCountBeforeTouchUp = self.target.eventCount;
+  [self.thumbTrack touchesEnded:[self touches] withEvent:nil];
+
+  // Then
+  XCTAssertEqual(eventCountBeforeTouchUp, 0U);
+  XCTAssertEqual(self.target.eventCount, 1U);
+  XCTAssertEqual(self.target.lastValue, self.thumbTrack.value);
+  XCTAssertEqual(self.thumbTrack.valueChangeEventCount, 1U);
+  XCTAssertEqual(self.thumbTrack.coalescedValueChangeEventCount, kDragMoveCount - 1);
+}
+
+- (void)testCoalescedDragSendsOneEventPerDisplayFrame {
+  // Given
+  self.thumbTrack.coalescesValueChangeEvents = YES;
+  [self beginDrag];
+
+  // When
+  [self moveTouchBy:20];
+  [self moveTouchBy:20];
+  [self.thumbTrack valueChangeEventDisplayLinkDidFire:nil];
+  [self moveTouchBy:20];
+  [self.thumbTrack valueChangeEventDisplayLinkDidFire:nil];
+  [self.thumbTrack valueChangeEventDisplayLinkDidFire:nil];
+
+  // Then
+  XCTAssertEqual(self.target.eventCount, 2U);
+  XCTAssertEqual(self.thumbTrack.coalescedValueChangeEventCount, 1U);
+}
+
+- (void)testCoalescedDragIsThrottledButStillSendsTheFinalValue {
+  // Given
+  self.thumbTrack.coalescesValueChangeEvents = YES;
+  self.thumbTrack.minimumValueChangeEventInterval = 60;
+  [self beginDrag];
+
+  // When
+  [self moveTouchBy:20];
+  [self.thumbTrack valueChangeEventDisplayLinkDidFire:nil];
+  [self moveTouchBy:20];
+  [self.thumbTrack valueChangeEventDisplayLinkDidFire:nil];
+  NSUInteger eventCountBeforeTouchUp = self.target.eventCount;
+  [self.thumbTrack touchesCancelled:[self touches] withEvent:nil];
+
+  // Then
+  XCTAssertEqual(eventCountBeforeTouchUp, 1U);
+  XCTAssertEqual(self.target.eventCount, 2U);
+  XCTAssertEqual(self.target.lastValue, self.thumbTrack.value);
+}
+
+- (void)testCoalescedChangesThatReturnToTheSentValueSendNoEvent {
+  // Given
+  self.thumbTrack.coalescesValueChangeEvents = YES;
+  [self beginDrag];
+
+  // When
+  [self moveTouchBy:20];
+  [self moveTouchBy:-20];
+  [self.thumbTrack touchesEnded:[self touches] withEvent:nil];
+
+  // Then
+  XCTAssertEqual(self.target.eventCount, 0U);
+  XCTAssertEqual(self.thumbTrack.coalescedValueChangeEventCount, 2U);
+}
+
+- (void)testTurningOffCoalescingSendsThePendingEvent {
+  // Given
+  self.thumbTrack.coalescesValueChangeEvents = YES;
+  [self beginDrag];
+  [self moveTouchBy:20];
+
+  // When
+  self.thumbTrack.coalescesValueChangeEvents = NO;
+
+  // Then
+  XCTAssertEqual(self.target.eventCount, 1U);
+}
+
+@end
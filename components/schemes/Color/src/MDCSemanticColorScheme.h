@@ -146,4 +146,20 @@ typedef NS_ENUM(NSInteger, MDCColorSchemeDefaults) {
 + (nonnull UIColor *)blendColor:(nonnull UIColor *)color
             withBackgroundColor:(nonnull UIColor *)backgroundColor;
 
+/**
+ Returns a color scheme with the colors of @c colorScheme resolved for @c traitCollection.
+
+ Resolved schemes are cached per color scheme and per user interface style, accessibility contrast
+ and user interface level. Views that resolve the same scheme for the same traits, e.g. after a
+ change to Dark Mode, share one resolved scheme, so each color is resolved once. A color scheme is
+ resolved again once any of its colors has been replaced.
+
+ @note On pre-iOS 13 the colors of @c colorScheme are returned unchanged.
+
+ @param colorScheme The color scheme whose colors should be resolved.
+ @param traitCollection The traits to use when resolving the colors.
+ */
++ (nonnull id<MDCColorScheming>)resolvedColorScheme:(nonnull id<MDCColorScheming>)colorScheme
+                                withTraitCollection:(nonnull UITraitCollection *)traitCollection;
+
 @end
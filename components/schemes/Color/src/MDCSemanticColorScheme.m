@@ -14,8 +14,13 @@
 
 #import "MDCSemanticColorScheme.h"
 
+#import <objc/runtime.h>
+
 #import "MaterialColor.h"
 
+/** The key of the resolved schemes by traits key that a color scheme holds on to. */
+static char MDCResolvedColorSchemesKey;
+
 static UIColor *ColorFromRGB(uint32_t colorValue) {
   return [UIColor colorWithRed:(CGFloat)(((colorValue >> 16) & 0xFF) / 255.0)
                          green:(CGFloat)(((colorValue >> 8) & 0xFF) / 255.0)
@@ -23,20 +28,102 @@ static UIColor *ColorFromRGB(uint32_t colorValue) {
                          alpha:1];
 }
 
-/**
- Helper method to blend a color channel with a background color channel using alpha composition.
- More info about Alpha compositing: https://en.wikipedia.org/wiki/Alpha_compositing
+/** Returns the colors of @c colorScheme in the order they are declared in MDCColorScheming. */
+static NSArray<UIColor *> *MDCColorSchemeColors(id<MDCColorScheming> colorScheme) {
+  return @[
+    colorScheme.primaryColor,
+    colorScheme.primaryColorVariant,
+    colorScheme.secondaryColor,
+    colorScheme.errorColor,
+    colorScheme.surfaceColor,
+    colorScheme.backgroundColor,
+    colorScheme.onPrimaryColor,
+    colorScheme.onSecondaryColor,
+    colorScheme.onSurfaceColor,
+    colorScheme.onBackgroundColor,
+    colorScheme.elevationOverlayColor,
+  ];
+}
+
+/** Returns a key for the traits that a color's resolution can depend on. */
+static NSNumber *MDCColorSchemeTraitsKey(UITraitCollection *traitCollection) {
+  NSInteger key = 0;
+#if defined(__IPHONE_13_0) && (__IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_13_0)
+  if (@available(iOS 13.0, *)) {
+    // The contrast and the level range from -1 (unspecified) to 1.
+    key = traitCollection.userInterfaceStyle * 9 + (traitCollection.accessibilityContrast + 1) * 3 +
+          (traitCollection.userInterfaceLevel + 1);
+  }
+#endif
+  return @(key);
+}
+
+/** An immutable color scheme with the colors of another color scheme resolved for some traits. */
+__attribute__((objc_subclassing_restricted)) @interface MDCResolvedColorScheme
+    : NSObject <MDCColorScheming>
 
- @params value is the value of color channel
- @params bValue is the value of background color channel
- @params alpha is the alpha of color channel
- @params bAlpha is the alpha of background color channel
- */
+/** The colors of the color scheme that was resolved, used to tell whether it has changed since. */
+@property(nonatomic, readonly, nonnull) NSArray<UIColor *> *sourceColors;
+
+@end
+
+@implementation MDCResolvedColorScheme
+
+@synthesize primaryColor = _primaryColor;
+@synthesize primaryColorVariant = _primaryColorVariant;
+@synthesize secondaryColor = _secondaryColor;
+@synthesize errorColor = _errorColor;
+@synthesize surfaceColor = _surfaceColor;
+@synthesize backgroundColor = _backgroundColor;
+@synthesize onPrimaryColor = _onPrimaryColor;
+@synthesize onSecondaryColor = _onSecondaryColor;
+@synthesize onSurfaceColor = _onSurfaceColor;
+@synthesize onBackgroundColor = _onBackgroundColor;
+@synthesize elevationOverlayColor = _elevationOverlayColor;
+@synthesize elevationOverlayEnabledForDarkMode = _elevationOverlayEnabledForDarkMode;
+
+- (instancetype)initWithColorScheme:(id<MDCColorScheming>)colorScheme
+                       sourceColors:(NSArray<UIColor *> *)sourceColors
+                    traitCollection:(UITraitCollection *)traitCollection {
+  self = [super init];
+  if (self) {
+    _sourceColors = sourceColors;
+    NSMutableArray<UIColor *> *colors = [NSMutableArray arrayWithCapacity:sourceColors.count];
+    for (UIColor *color in sourceColors) {
+      [colors addObject:[color mdc_resolvedColorWithTraitCollection:traitCollection]];
+    }
+    _primaryColor = colors[0];
+    _primaryColorVariant = colors[1];
+    _secondaryColor = colors[2];
+    _errorColor = colors[3];
+    _surfaceColor = colors[4];
+    _backgroundColor = colors[5];
+    _onPrimaryColor = colors[6];
+    _onSecondaryColor = colors[7];
+    _onSurfaceColor = colors[8];
+    _onBackgroundColor = colors[9];
+    _elevationOverlayColor = colors[10];
+    _elevationOverlayEnabledForDarkMode = colorScheme.elevationOverlayEnabledForDarkMode;
+  }
+  return self;
+}
 
-static CGFloat blendColorChannel(CGFloat value, CGFloat bValue, CGFloat alpha, CGFloat bAlpha) {
-  return ((1 - alpha) * bValue * bAlpha + alpha * value) / (alpha + bAlpha * (1 - alpha));
+/** Returns YES if resolving @c colorScheme again would produce the receiver's colors. */
+- (BOOL)isResolutionOfColorScheme:(id<MDCColorScheming>)colorScheme
+                     sourceColors:(NSArray<UIColor *> *)sourceColors {
+  if (colorScheme.elevationOverlayEnabledForDarkMode != self.elevationOverlayEnabledForDarkMode) {
+    return NO;
+  }
+  for (NSUInteger index = 0; index < sourceColors.count; ++index) {
+    if (sourceColors[index] != self.sourceColors[index]) {
+      return NO;
+    }
+  }
+  return YES;
 }
 
+@end
+
 @implementation MDCSemanticColorScheme
 
 - (instancetype)init {
@@ -108,15 +195,31 @@ static CGFloat blendColorChannel(CGFloat value, CGFloat bValue, CGFloat alpha, C
 }
 
 + (UIColor *)blendColor:(UIColor *)color withBackgroundColor:(UIColor *)backgroundColor {
-  CGFloat red = 0.0, green = 0.0, blue = 0.0, alpha = 0.0;
-  [color getRed:&red green:&green blue:&blue alpha:&alpha];
-  CGFloat bRed = 0.0, bGreen = 0.0, bBlue = 0.0, bAlpha = 0.0;
-  [backgroundColor getRed:&bRed green:&bGreen blue:&bBlue alpha:&bAlpha];
-
-  return [UIColor colorWithRed:blendColorChannel(red, bRed, alpha, bAlpha)
-                         green:blendColorChannel(green, bGreen, alpha, bAlpha)
-                          blue:blendColorChannel(blue, bBlue, alpha, bAlpha)
-                         alpha:alpha + bAlpha * (1 - alpha)];
+  return [UIColor mdc_blendColor:color withBackgroundColor:backgroundColor];
+}
+
++ (id<MDCColorScheming>)resolvedColorScheme:(id<MDCColorScheming>)colorScheme
+                        withTraitCollection:(UITraitCollection *)traitCollection {
+  NSNumber *traitsKey = MDCColorSchemeTraitsKey(traitCollection);
+  NSArray<UIColor *> *sourceColors = MDCColorSchemeColors(colorScheme);
+  @synchronized(colorScheme) {
+    // The resolved schemes live as long as the scheme they were resolved from.
+    NSMutableDictionary<NSNumber *, MDCResolvedColorScheme *> *resolvedColorSchemesByTraits =
+        objc_getAssociatedObject(colorScheme, &MDCResolvedColorSchemesKey);
+    if (!resolvedColorSchemesByTraits) {
+      resolvedColorSchemesByTraits = [NSMutableDictionary dictionary];
+      objc_setAssociatedObject(colorScheme, &MDCResolvedColorSchemesKey,
+                               resolvedColorSchemesByTraits, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    }
+    MDCResolvedColorScheme *resolvedColorScheme = resolvedColorSchemesByTraits[traitsKey];
+    if (![resolvedColorScheme isResolutionOfColorScheme:colorScheme sourceColors:sourceColors]) {
+      resolvedColorScheme = [[MDCResolvedColorScheme alloc] initWithColorScheme:colorScheme
+                                                                   sourceColors:sourceColors
+                                                                traitCollection:traitCollection];
+      resolvedColorSchemesByTraits[traitsKey] = resolvedColorScheme;
+    }
+    return resolvedColorScheme;
+  }
 }
 
 #pragma mark - NSCopying
@@ -0,0 +1,203 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialColorScheme.h"
+
+@interface MDCSemanticColorSchemeResolutionTests : XCTestCase
+@property(nonatomic, strong, nullable) MDCSemanticColorScheme *colorScheme;
+@property(nonatomic, assign) NSUInteger resolutionCount;
+@end
+
+@implementation MDCSemanticColorSchemeResolutionTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.colorScheme =
+      [[MDCSemanticColorScheme alloc] initWithDefaults:MDCColorSchemeDefaultsMaterial201907];
+  self.resolutionCount = 0;
+}
+
+- (void)tearDown {
+  self.colorScheme = nil;
+
+  [super tearDown];
+}
+
+/** Returns a dynamic color that counts how many times it is resolved. */
+- (UIColor *)countingColorWithDarkColor:(UIColor *)darkColor lightColor:(UIColor *)lightColor {
+#if defined(__IPHONE_13_0) && (__IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_13_0)
+  if (@available(iOS 13.0, *)) {
+    __weak MDCSemanticColorSchemeResolutionTests *weakSelf = self;
+    return [UIColor colorWithDynamicProvider:^UIColor *(UITraitCollection *traitCollection) {
+      weakSelf.resolutionCount += 1;
+      return traitCollection.userInterfaceStyle == UIUserInterfaceStyleDark ? darkColor
+                                                                            : lightColor;
+    }];
+  }
+#endif
+  return lightColor;
+}
+
+- (void)testResolvingForManyViewsResolvesEachColorOnce {
+#if defined(__IPHONE_13_0) && (__IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_13_0)
+  if (@available(iOS 13.0, *)) {
+    // Given
+    self.colorScheme.surfaceColor = [self countingColorWithDarkColor:UIColor.blackColor
+                                                          lightColor:UIColor.whiteColor];
+    UITraitCollection *darkTraits =
+        [UITraitCollection traitCollectionWithUserInterfaceStyle:UIUserInterfaceStyleDark];
+
+    // When
+    NSMutableSet<UIColor *> *surfaceColors = [NSMutableSet set];
+    for (NSUInteger view = 0; view < 100; ++view) {
+      id<MDCColorScheming> resolvedColorScheme =
+          [MDCSemanticColorScheme resolvedColorScheme:self.colorScheme
+                                  withTraitCollection:darkTraits];
+      [surfaceColors addObject:resolvedColorScheme.surfaceColor];
+    }
+
+    // Then
+    XCTAssertEqual(self.resolutionCount, 1U);
+    XCTAssertEqualObjects(surfaceColors, [NSSet setWithObject:UIColor.blackColor]);
+  }
+#endif
+}
+
+- (void)testTogglingDarkModeResolvesOncePerStyle {
+#if defined(__IPHONE_13_0) && (__IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_13_0)
+  if (@available(iOS 13.0, *)) {
+    // Given
+    self.colorScheme.surfaceColor = [self countingColorWithDarkColor:UIColor.blackColor
+                                                          lightColor:UIColor.whiteColor];
+    UITraitCollection *darkTraits =
+        [UITraitCollection traitCollectionWithUserInterfaceStyle:UIUserInterfaceStyleDark];
+    UITraitCollection *lightTraits =
+        [UITraitCollection traitCollectionWithUserInterfaceStyle:UIUserInterfaceStyleLight];
+
+    // When
+    id<MDCColorScheming> darkColorScheme;
+    id<MDCColorScheming> lightColorScheme;
+    for (NSUInteger toggle = 0; toggle < 3; ++toggle) {
+      darkColorScheme = [MDCSemanticColorScheme resolvedColorScheme:self.colorScheme
+                                                withTraitCollection:darkTraits];
+      lightColorScheme = [MDCSemanticColorScheme resolvedColorScheme:self.colorScheme
+                                                 withTraitCollection:lightTraits];
+    }
+
+    // Then
+    XCTAssertEqual(self.resolutionCount, 2U);
+    XCTAssertEqualObjects(darkColorScheme.surfaceColor, UIColor.blackColor);
+    XCTAssertEqualObjects(lightColorScheme.surfaceColor, UIColor.whiteColor);
+  }
+#endif
+}
+
+- (void)testHighContrastIsResolvedSeparately {
+#if defined(__IPHONE_13_0) && (__IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_13_0)
+  if (@available(iOS 13.0, *)) {
+    // Given
+    self.colorScheme.surfaceColor = [self countingColorWithDarkColor:UIColor.blackColor
+                                                          lightColor:UIColor.whiteColor];
+    UITraitCollection *darkTraits =
+        [UITraitCollection traitCollectionWithUserInterfaceStyle:UIUserInterfaceStyleDark];
+    UITraitCollection *highContrastDarkTraits =
+        [UITraitCollection traitCollectionWithTraitsFromCollections:@[
+          darkTraits,
+          [UITraitCollection traitCollectionWithAccessibilityContrast:UIAccessibilityContrastHigh]
+        ]];
+
+    // When
+    id<MDCColorScheming> resolvedColorScheme =
+        [MDCSemanticColorScheme resolvedColorScheme:self.colorScheme
+                                withTraitCollection:darkTraits];
+    id<MDCColorScheming> highContrastColorScheme =
+        [MDCSemanticColorScheme resolvedColorScheme:self.colorScheme
+                                withTraitCollection:highContrastDarkTraits];
+
+    // Then
+    XCTAssertEqual(self.resolutionCount, 2U);
+    XCTAssertNotEqual(resolvedColorScheme, highContrastColorScheme);
+  }
+#endif
+}
+
+- (void)testReplacingAColorResolvesTheSchemeAgain {
+#if defined(__IPHONE_13_0) && (__IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_13_0)
+  if (@available(iOS 13.0, *)) {
+    // Given
+    UITraitCollection *darkTraits =
+        [UITraitCollection traitCollectionWithUserInterfaceStyle:UIUserInterfaceStyleDark];
+    [MDCSemanticColorScheme resolvedColorScheme:self.colorScheme withTraitCollection:darkTraits];
+
+    // When
+    self.colorScheme.primaryColor = UIColor.redColor;
+    self.colorScheme.elevationOverlayEnabledForDarkMode = NO;
+    id<MDCColorScheming> resolvedColorScheme =
+        [MDCSemanticColorScheme resolvedColorScheme:self.colorScheme
+                                withTraitCollection:darkTraits];
+
+    // Then
+    XCTAssertEqualObjects(resolvedColorScheme.primaryColor, UIColor.redColor);
+    XCTAssertFalse(resolvedColorScheme.elevationOverlayEnabledForDarkMode);
+  }
+#endif
+}
+
+- (void)testResolvedSchemeMatchesResolvingEachColor {
+#if defined(__IPHONE_13_0) && (__IPHONE_OS_VERSION_MAX_ALLOWED >= __IPHONE_13_0)
+  if (@available(iOS 13.0, *)) {
+    // Given
+    UITraitCollection *darkTraits =
+        [UITraitCollection traitCollectionWithUserInterfaceStyle:UIUserInterfaceStyleDark];
+
+    // When
+    id<MDCColorScheming> resolvedColorScheme =
+        [MDCSemanticColorScheme resolvedColorScheme:self.colorScheme
+                                withTraitCollection:darkTraits];
+
+    // Then
+    XCTAssertEqualObjects(
+        resolvedColorScheme.primaryColor,
+        [self.colorScheme.primaryColor resolvedColorWithTraitCollection:darkTraits]);
+    XCTAssertEqualObjects(
+        resolvedColorScheme.surfaceColor,
+        [self.colorScheme.surfaceColor resolvedColorWithTraitCollection:darkTraits]);
+    XCTAssertEqualObjects(
+        resolvedColorScheme.onSurfaceColor,
+        [self.colorScheme.onSurfaceColor resolvedColorWithTraitCollection:darkTraits]);
+    XCTAssertEqual(resolvedColorScheme.elevationOverlayEnabledForDarkMode,
+                   self.colorScheme.elevationOverlayEnabledForDarkMode);
+  }
+#endif
+}
+
+- (void)testResolvingPreiOS13KeepsTheColors {
+  if (@available(iOS 13.0, *)) {
+  } else {
+    // When
+    id<MDCColorScheming> resolvedColorScheme =
+        [MDCSemanticColorScheme resolvedColorScheme:self.colorScheme
+                                withTraitCollection:[[UITraitCollection alloc] init]];
+
+    // Then
+    XCTAssertEqualObjects(resolvedColorScheme.primaryColor, self.colorScheme.primaryColor);
+    XCTAssertEqualObjects(resolvedColorScheme.surfaceColor, self.colorScheme.surfaceColor);
+  }
+}
+
+@end
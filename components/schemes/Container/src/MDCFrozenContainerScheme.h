@@ -0,0 +1,45 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#import <Foundation/Foundation.h>
+
+#import "MDCContainerScheme.h"
+
+/**
+ An immutable snapshot of a container scheme.
+
+ Frozen schemes are interned: while a frozen scheme is alive, freezing a scheme with equal values
+ returns the same instance. Two frozen schemes with equal values are therefore usually the same
+ object, and comparing them is a pointer comparison. The hash is computed once, when the scheme
+ is frozen.
+
+ Theming extensions may skip re-theming a component that was last themed with the same frozen
+ scheme, e.g. when a collection view cell is reused. Components themed this way keep any
+ customizations made after theming them when the same frozen scheme is applied again.
+ */
+__attribute__((objc_subclassing_restricted)) @interface MDCFrozenContainerScheme
+    : NSObject<MDCContainerScheming, NSCopying>
+
+/**
+ Returns a frozen snapshot of the values of @c scheme.
+
+ Later changes to @c scheme or its subsystem schemes do not affect the snapshot. If @c scheme is
+ already frozen, it is returned.
+ */
++ (nonnull instancetype)schemeWithScheme:(nonnull id<MDCContainerScheming>)scheme;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+@end
@@ -0,0 +1,324 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#import "MDCFrozenContainerScheme.h"
+
+#import "MaterialTypography.h"
+
+/** Mixes @c value into @c hash. */
+static inline NSUInteger MDCFrozenSchemeHashCombine(NSUInteger hash, NSUInteger value) {
+  return hash * 31 + value;
+}
+
+/** Returns YES if both objects are nil or equal. */
+static inline BOOL MDCFrozenSchemeObjectsEqual(id first, id second) {
+  return first == second || [first isEqual:second];
+}
+
+#pragma mark - Frozen subsystem schemes
+
+@interface MDCFrozenColorScheme : NSObject <MDCColorScheming>
+@end
+
+@implementation MDCFrozenColorScheme {
+  NSUInteger _hash;
+}
+
+@synthesize primaryColor = _primaryColor;
+@synthesize primaryColorVariant = _primaryColorVariant;
+@synthesize secondaryColor = _secondaryColor;
+@synthesize errorColor = _errorColor;
+@synthesize surfaceColor = _surfaceColor;
+@synthesize backgroundColor = _backgroundColor;
+@synthesize onPrimaryColor = _onPrimaryColor;
+@synthesize onSecondaryColor = _onSecondaryColor;
+@synthesize onSurfaceColor = _onSurfaceColor;
+@synthesize onBackgroundColor = _onBackgroundColor;
+@synthesize elevationOverlayColor = _elevationOverlayColor;
+@synthesize elevationOverlayEnabledForDarkMode = _elevationOverlayEnabledForDarkMode;
+
+- (instancetype)initWithColorScheme:(id<MDCColorScheming>)colorScheme {
+  self = [super init];
+  if (self) {
+    _primaryColor = [colorScheme.primaryColor copy];
+    _primaryColorVariant = [colorScheme.primaryColorVariant copy];
+    _secondaryColor = [colorScheme.secondaryColor copy];
+    _errorColor = [colorScheme.errorColor copy];
+    _surfaceColor = [colorScheme.surfaceColor copy];
+    _backgroundColor = [colorScheme.backgroundColor copy];
+    _onPrimaryColor = [colorScheme.onPrimaryColor copy];
+    _onSecondaryColor = [colorScheme.onSecondaryColor copy];
+    _onSurfaceColor = [colorScheme.onSurfaceColor copy];
+    _onBackgroundColor = [colorScheme.onBackgroundColor copy];
+    _elevationOverlayColor = [colorScheme.elevationOverlayColor copy];
+    _elevationOverlayEnabledForDarkMode = colorScheme.elevationOverlayEnabledForDarkMode;
+
+    for (UIColor *color in [self colors]) {
+      _hash = MDCFrozenSchemeHashCombine(_hash, color.hash);
+    }
+    _hash = MDCFrozenSchemeHashCombine(_hash, _elevationOverlayEnabledForDarkMode);
+  }
+  return self;
+}
+
+/** The colors of the scheme, in a fixed order. */
+- (NSArray<UIColor *> *)colors {
+  return @[
+    _primaryColor, _primaryColorVariant, _secondaryColor, _errorColor, _surfaceColor,
+    _backgroundColor, _onPrimaryColor, _onSecondaryColor, _onSurfaceColor, _onBackgroundColor,
+    _elevationOverlayColor
+  ];
+}
+
+- (NSUInteger)hash {
+  return _hash;
+}
+
+- (BOOL)isEqual:(id)object {
+  if (self == object) {
+    return YES;
+  }
+  if (![object isKindOfClass:[MDCFrozenColorScheme class]]) {
+    return NO;
+  }
+  MDCFrozenColorScheme *other = (MDCFrozenColorScheme *)object;
+  return _hash == other->_hash &&
+         _elevationOverlayEnabledForDarkMode == other->_elevationOverlayEnabledForDarkMode &&
+         [[self colors] isEqualToArray:[other colors]];
+}
+
+@end
+
+@interface MDCFrozenTypographyScheme : NSObject <MDCTypographyScheming>
+@end
+
+@implementation MDCFrozenTypographyScheme {
+  NSUInteger _hash;
+
+  // The scaling curve of each font when the scheme was frozen, in the order of -fonts, or NSNull
+  // for fonts without one. Fonts are shared instances, so their curves can change after freezing.
+  NSArray *_scalingCurves;
+}
+
+@synthesize headline1 = _headline1;
+@synthesize headline2 = _headline2;
+@synthesize headline3 = _headline3;
+@synthesize headline4 = _headline4;
+@synthesize headline5 = _headline5;
+@synthesize headline6 = _headline6;
+@synthesize subtitle1 = _subtitle1;
+@synthesize subtitle2 = _subtitle2;
+@synthesize body1 = _body1;
+@synthesize body2 = _body2;
+@synthesize caption = _caption;
+@synthesize button = _button;
+@synthesize overline = _overline;
+@synthesize useCurrentContentSizeCategoryWhenApplied = _useCurrentContentSizeCategoryWhenApplied;
+
+- (instancetype)initWithTypographyScheme:(id<MDCTypographyScheming>)typographyScheme {
+  self = [super init];
+  if (self) {
+    _headline1 = [typographyScheme.headline1 copy];
+    _headline2 = [typographyScheme.headline2 copy];
+    _headline3 = [typographyScheme.headline3 copy];
+    _headline4 = [typographyScheme.headline4 copy];
+    _headline5 = [typographyScheme.headline5 copy];
+    _headline6 = [typographyScheme.headline6 copy];
+    _subtitle1 = [typographyScheme.subtitle1 copy];
+    _subtitle2 = [typographyScheme.subtitle2 copy];
+    _body1 = [typographyScheme.body1 copy];
+    _body2 = [typographyScheme.body2 copy];
+    _caption = [typographyScheme.caption copy];
+    _button = [typographyScheme.button copy];
+    _overline = [typographyScheme.overline copy];
+    _useCurrentContentSizeCategoryWhenApplied =
+        typographyScheme.useCurrentContentSizeCategoryWhenApplied;
+
+    NSArray<UIFont *> *fonts = [self fonts];
+    NSMutableArray *scalingCurves = [NSMutableArray arrayWithCapacity:fonts.count];
+    for (UIFont *font in fonts) {
+      MDCScalingCurve scalingCurve = [font.mdc_scalingCurve copy];
+      [scalingCurves addObject:scalingCurve ?: [NSNull null]];
+      _hash = MDCFrozenSchemeHashCombine(_hash, font.hash);
+      // NSDictionary's own hash is its count, so mix in the entries to tell curves apart.
+      for (UIContentSizeCategory sizeCategory in
+           [scalingCurve.allKeys sortedArrayUsingSelector:@selector(compare:)]) {
+        _hash = MDCFrozenSchemeHashCombine(_hash, sizeCategory.hash);
+        _hash = MDCFrozenSchemeHashCombine(_hash, scalingCurve[sizeCategory].hash);
+      }
+    }
+    _scalingCurves = [scalingCurves copy];
+    _hash = MDCFrozenSchemeHashCombine(_hash, _useCurrentContentSizeCategoryWhenApplied);
+  }
+  return self;
+}
+
+/** The fonts of the scheme, in a fixed order. */
+- (NSArray<UIFont *> *)fonts {
+  return @[
+    _headline1, _headline2, _headline3, _headline4, _headline5, _headline6, _subtitle1,
+    _subtitle2, _body1, _body2, _caption, _button, _overline
+  ];
+}
+
+- (NSUInteger)hash {
+  return _hash;
+}
+
+- (BOOL)isEqual:(id)object {
+  if (self == object) {
+    return YES;
+  }
+  if (![object isKindOfClass:[MDCFrozenTypographyScheme class]]) {
+    return NO;
+  }
+  MDCFrozenTypographyScheme *other = (MDCFrozenTypographyScheme *)object;
+  return _hash == other->_hash &&
+         _useCurrentContentSizeCategoryWhenApplied ==
+             other->_useCurrentContentSizeCategoryWhenApplied &&
+         [[self fonts] isEqualToArray:[other fonts]] &&
+         [_scalingCurves isEqualToArray:other->_scalingCurves];
+}
+
+@end
+
+@interface MDCFrozenShapeScheme : NSObject <MDCShapeScheming>
+@end
+
+@implementation MDCFrozenShapeScheme {
+  NSUInteger _hash;
+}
+
+@synthesize smallComponentShape = _smallComponentShape;
+@synthesize mediumComponentShape = _mediumComponentShape;
+@synthesize largeComponentShape = _largeComponentShape;
+
+- (instancetype)initWithShapeScheme:(id<MDCShapeScheming>)shapeScheme {
+  self = [super init];
+  if (self) {
+    _smallComponentShape = [shapeScheme.smallComponentShape copy];
+    _mediumComponentShape = [shapeScheme.mediumComponentShape copy];
+    _largeComponentShape = [shapeScheme.largeComponentShape copy];
+
+    _hash = MDCFrozenSchemeHashCombine(_smallComponentShape.hash, _mediumComponentShape.hash);
+    _hash = MDCFrozenSchemeHashCombine(_hash, _largeComponentShape.hash);
+  }
+  return self;
+}
+
+- (NSUInteger)hash {
+  return _hash;
+}
+
+- (BOOL)isEqual:(id)object {
+  if (self == object) {
+    return YES;
+  }
+  if (![object isKindOfClass:[MDCFrozenShapeScheme class]]) {
+    return NO;
+  }
+  MDCFrozenShapeScheme *other = (MDCFrozenShapeScheme *)object;
+  return _hash == other->_hash &&
+         [_smallComponentShape isEqual:other->_smallComponentShape] &&
+         [_mediumComponentShape isEqual:other->_mediumComponentShape] &&
+         [_largeComponentShape isEqual:other->_largeComponentShape];
+}
+
+@end
+
+#pragma mark - MDCFrozenContainerScheme
+
+@implementation MDCFrozenContainerScheme {
+  MDCFrozenColorScheme *_colorScheme;
+  MDCFrozenTypographyScheme *_typographyScheme;
+  MDCFrozenShapeScheme *_shapeScheme;
+  NSUInteger _hash;
+}
+
++ (instancetype)schemeWithScheme:(id<MDCContainerScheming>)scheme {
+  if ([(id)scheme isKindOfClass:[MDCFrozenContainerScheme class]]) {
+    return (MDCFrozenContainerScheme *)scheme;
+  }
+
+  // Weakly holds every live frozen scheme, so that equal snapshots share one instance.
+  static NSHashTable<MDCFrozenContainerScheme *> *internedSchemes;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    internedSchemes = [NSHashTable weakObjectsHashTable];
+  });
+
+  MDCFrozenContainerScheme *frozenScheme = [[self alloc] initWithScheme:scheme];
+  @synchronized(internedSchemes) {
+    MDCFrozenContainerScheme *internedScheme = [internedSchemes member:frozenScheme];
+    if (internedScheme) {
+      return internedScheme;
+    }
+    [internedSchemes addObject:frozenScheme];
+  }
+  return frozenScheme;
+}
+
+- (instancetype)initWithScheme:(id<MDCContainerScheming>)scheme {
+  self = [super init];
+  if (self) {
+    _colorScheme = [[MDCFrozenColorScheme alloc] initWithColorScheme:scheme.colorScheme];
+    _typographyScheme =
+        [[MDCFrozenTypographyScheme alloc] initWithTypographyScheme:scheme.typographyScheme];
+    if (scheme.shapeScheme) {
+      _shapeScheme = [[MDCFrozenShapeScheme alloc] initWithShapeScheme:scheme.shapeScheme];
+    }
+
+    _hash = MDCFrozenSchemeHashCombine(_colorScheme.hash, _typographyScheme.hash);
+    _hash = MDCFrozenSchemeHashCombine(_hash, _shapeScheme.hash);
+  }
+  return self;
+}
+
+- (id<MDCColorScheming>)colorScheme {
+  return _colorScheme;
+}
+
+- (id<MDCTypographyScheming>)typographyScheme {
+  return _typographyScheme;
+}
+
+- (id<MDCShapeScheming>)shapeScheme {
+  return _shapeScheme;
+}
+
+- (NSUInteger)hash {
+  return _hash;
+}
+
+- (BOOL)isEqual:(id)object {
+  if (self == object) {
+    return YES;
+  }
+  if (![object isKindOfClass:[MDCFrozenContainerScheme class]]) {
+    return NO;
+  }
+  MDCFrozenContainerScheme *other = (MDCFrozenContainerScheme *)object;
+  return _hash == other->_hash && [_colorScheme isEqual:other->_colorScheme] &&
+         [_typographyScheme isEqual:other->_typographyScheme] &&
+         MDCFrozenSchemeObjectsEqual(_shapeScheme, other->_shapeScheme);
+}
+
+#pragma mark - NSCopying
+
+- (id)copyWithZone:(__unused NSZone *)zone {
+  return self;
+}
+
+@end
@@ -13,3 +13,4 @@
 // limitations under the License.
 
 #import "MDCContainerScheme.h"
+#import "MDCFrozenContainerScheme.h"
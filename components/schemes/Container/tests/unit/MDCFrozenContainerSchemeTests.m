@@ -0,0 +1,125 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialContainerScheme.h"
+#import "MaterialTypography.h"
+
+@interface MDCFrozenContainerSchemeTests : XCTestCase
+@end
+
+@implementation MDCFrozenContainerSchemeTests
+
+- (void)testFreezingEqualSchemesReturnsTheSameInstance {
+  // Given
+  MDCContainerScheme *firstScheme = [[MDCContainerScheme alloc] init];
+  MDCContainerScheme *secondScheme = [[MDCContainerScheme alloc] init];
+  firstScheme.shapeScheme = [[MDCShapeScheme alloc] init];
+  secondScheme.shapeScheme = [[MDCShapeScheme alloc] init];
+
+  // When
+  MDCFrozenContainerScheme *firstFrozenScheme =
+      [MDCFrozenContainerScheme schemeWithScheme:firstScheme];
+  MDCFrozenContainerScheme *secondFrozenScheme =
+      [MDCFrozenContainerScheme schemeWithScheme:secondScheme];
+
+  // Then
+  XCTAssertEqual(firstFrozenScheme, secondFrozenScheme);
+  XCTAssertEqualObjects(firstFrozenScheme, secondFrozenScheme);
+  XCTAssertEqual(firstFrozenScheme.hash, secondFrozenScheme.hash);
+}
+
+- (void)testFreezingDifferentSchemesReturnsDifferentInstances {
+  // Given
+  MDCContainerScheme *firstScheme = [[MDCContainerScheme alloc] init];
+  MDCContainerScheme *secondScheme = [[MDCContainerScheme alloc] init];
+  secondScheme.colorScheme.primaryColor = UIColor.orangeColor;
+  MDCContainerScheme *thirdScheme = [[MDCContainerScheme alloc] init];
+  thirdScheme.shapeScheme = [[MDCShapeScheme alloc] init];
+
+  // When
+  MDCFrozenContainerScheme *firstFrozenScheme =
+      [MDCFrozenContainerScheme schemeWithScheme:firstScheme];
+  MDCFrozenContainerScheme *secondFrozenScheme =
+      [MDCFrozenContainerScheme schemeWithScheme:secondScheme];
+  MDCFrozenContainerScheme *thirdFrozenScheme =
+      [MDCFrozenContainerScheme schemeWithScheme:thirdScheme];
+
+  // Then
+  XCTAssertNotEqualObjects(firstFrozenScheme, secondFrozenScheme);
+  XCTAssertNotEqualObjects(firstFrozenScheme, thirdFrozenScheme);
+  XCTAssertNotEqualObjects(secondFrozenScheme, thirdFrozenScheme);
+}
+
+- (void)testFreezingSchemesThatDifferOnlyInScalingCurvesReturnsDifferentInstances {
+  // Given
+  UIFont *buttonFont = [UIFont systemFontOfSize:14];
+  MDCContainerScheme *firstScheme = [[MDCContainerScheme alloc] init];
+  firstScheme.typographyScheme.button = buttonFont;
+  MDCContainerScheme *secondScheme = [[MDCContainerScheme alloc] init];
+  secondScheme.typographyScheme.button = buttonFont;
+
+  // When
+  buttonFont.mdc_scalingCurve = @{UIContentSizeCategoryLarge : @14};
+  MDCFrozenContainerScheme *firstFrozenScheme =
+      [MDCFrozenContainerScheme schemeWithScheme:firstScheme];
+  buttonFont.mdc_scalingCurve = @{UIContentSizeCategoryLarge : @20};
+  MDCFrozenContainerScheme *secondFrozenScheme =
+      [MDCFrozenContainerScheme schemeWithScheme:secondScheme];
+
+  // Then
+  XCTAssertNotEqual(firstFrozenScheme, secondFrozenScheme);
+  XCTAssertNotEqualObjects(firstFrozenScheme.typographyScheme, secondFrozenScheme.typographyScheme);
+  XCTAssertNotEqual(firstFrozenScheme.typographyScheme.hash,
+                    secondFrozenScheme.typographyScheme.hash);
+
+  buttonFont.mdc_scalingCurve = nil;
+}
+
+- (void)testFrozenSchemeKeepsTheValuesItWasFrozenWith {
+  // Given
+  MDCContainerScheme *scheme = [[MDCContainerScheme alloc] init];
+  scheme.shapeScheme = [[MDCShapeScheme alloc] init];
+  UIColor *primaryColor = scheme.colorScheme.primaryColor;
+  UIFont *buttonFont = scheme.typographyScheme.button;
+  MDCShapeCategory *smallComponentShape = [scheme.shapeScheme.smallComponentShape copy];
+  MDCFrozenContainerScheme *frozenScheme = [MDCFrozenContainerScheme schemeWithScheme:scheme];
+
+  // When
+  scheme.colorScheme.primaryColor = UIColor.orangeColor;
+  scheme.typographyScheme.button = [UIFont systemFontOfSize:40];
+  scheme.shapeScheme.smallComponentShape =
+      [[MDCShapeCategory alloc] initCornersWithFamily:MDCShapeCornerFamilyCut andSize:8];
+
+  // Then
+  XCTAssertEqualObjects(frozenScheme.colorScheme.primaryColor, primaryColor);
+  XCTAssertEqualObjects(frozenScheme.typographyScheme.button, buttonFont);
+  XCTAssertEqualObjects(frozenScheme.shapeScheme.smallComponentShape, smallComponentShape);
+  XCTAssertNotEqual([MDCFrozenContainerScheme schemeWithScheme:scheme], frozenScheme);
+}
+
+- (void)testFreezingAFrozenSchemeReturnsIt {
+  // Given
+  MDCFrozenContainerScheme *frozenScheme =
+      [MDCFrozenContainerScheme schemeWithScheme:[[MDCContainerScheme alloc] init]];
+
+  // Then
+  XCTAssertEqual([MDCFrozenContainerScheme schemeWithScheme:frozenScheme], frozenScheme);
+  XCTAssertEqual([frozenScheme copy], frozenScheme);
+  XCTAssertNil(frozenScheme.shapeScheme);
+}
+
+@end
@@ -6,6 +6,7 @@ def registerIcons(s)
     iss.subspec "Base" do |ss|
       ss.public_header_files = "components/private/Icons/src/*.h"
       ss.source_files = "components/private/Icons/src/*.{h,m}"
+      ss.framework = "ImageIO"
     end
 
     iss.test_spec 'UnitTests' do |unit_tests|
@@ -96,6 +96,7 @@ def registerIcons(s)
     iss.subspec "Base" do |ss|
       ss.public_header_files = "$ICONS_COMPONENT_RELATIVE_PATH/src/*.h"
       ss.source_files = "$ICONS_COMPONENT_RELATIVE_PATH/src/*.{h,m}"
+      ss.framework = "ImageIO"
     end
 
     iss.test_spec 'UnitTests' do |unit_tests|
@@ -237,8 +238,7 @@ __attribute__((
 }
 
 + (nullable UIImage *)imageFor_$icon_name {
-  NSBundle *bundle = [self bundleNamed:kBundleName];
-  return [UIImage imageNamed:kIconName inBundle:bundle compatibleWithTraitCollection:nil];
+  return [self imageForIconName:kIconName withBundleName:kBundleName];
 }
 
 @end